@@ -0,0 +1,57 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.agrona;
+
+import static org.assertj.core.api.Assertions.*;
+
+import com.axonops.libre2.api.Pattern;
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import org.agrona.concurrent.UnsafeBuffer;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for {@link AgronaBuffers}. */
+@DisplayName("AgronaBuffers")
+class AgronaBuffersIT {
+
+  private static final byte[] MESSAGE = "hdr|id=42|trailer".getBytes(StandardCharsets.UTF_8);
+
+  @Test
+  @DisplayName("Off-heap and heap buffers match the requested range")
+  void offHeapAndHeap() {
+    Pattern pattern = Pattern.compile("id=\\d+");
+    UnsafeBuffer offHeap = new UnsafeBuffer(ByteBuffer.allocateDirect(64));
+    offHeap.putBytes(8, MESSAGE);
+    UnsafeBuffer heap = new UnsafeBuffer(new byte[64], 4, 32);
+    heap.putBytes(0, MESSAGE);
+
+    assertThat(AgronaBuffers.matches(pattern, offHeap, 8 + 4, 5)).isTrue();
+    assertThat(AgronaBuffers.find(pattern, offHeap, 8, MESSAGE.length)).isTrue();
+    assertThat(AgronaBuffers.matches(pattern, heap, 4, 5)).isTrue();
+    assertThat(AgronaBuffers.find(pattern, heap, 0, 4)).isFalse();
+  }
+
+  @Test
+  @DisplayName("Ranges outside the buffer throw")
+  void outOfBounds() {
+    UnsafeBuffer buffer = new UnsafeBuffer(new byte[8]);
+
+    assertThatThrownBy(() -> AgronaBuffers.find(Pattern.compile("a"), buffer, 4, 5))
+        .isInstanceOf(IndexOutOfBoundsException.class);
+  }
+}
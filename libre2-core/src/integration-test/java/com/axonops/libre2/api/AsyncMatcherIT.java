@@ -0,0 +1,210 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CompletionException;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for {@link AsyncMatcher}. */
+@DisplayName("AsyncMatcher")
+class AsyncMatcherIT {
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  @Test
+  @DisplayName("Requests from many threads complete with the synchronous results")
+  void concurrentSubmitters_agreeWithSync() throws Exception {
+    Pattern digits = Pattern.compile("\\d+");
+    Pattern word = Pattern.compile("[a-z]+");
+    ExecutorService submitters = Executors.newFixedThreadPool(8);
+
+    try (AsyncMatcher async = AsyncMatcher.create(2, 100_000)) {
+      List<Future<List<Boolean>>> tasks = new ArrayList<>();
+      for (int t = 0; t < 8; t++) {
+        int thread = t;
+        tasks.add(
+            submitters.submit(
+                () -> {
+                  List<CompletableFuture<Boolean>> futures = new ArrayList<>();
+                  for (int i = 0; i < 1000; i++) {
+                    String input = (i % 3 == 0 ? "abc" : "") + (thread * 1000 + i);
+                    futures.add(
+                        i % 2 == 0 ? async.matches(digits, input) : async.find(word, input));
+                  }
+                  List<Boolean> results = new ArrayList<>();
+                  for (CompletableFuture<Boolean> future : futures) {
+                    results.add(future.get(10, TimeUnit.SECONDS));
+                  }
+                  return results;
+                }));
+      }
+
+      for (int t = 0; t < 8; t++) {
+        List<Boolean> results = tasks.get(t).get();
+        for (int i = 0; i < 1000; i++) {
+          String input = (i % 3 == 0 ? "abc" : "") + (t * 1000 + i);
+          boolean expected =
+              i % 2 == 0 ? digits.matches(input) : word.findAll(new String[] {input})[0];
+          assertThat(results.get(i)).as(input).isEqualTo(expected);
+        }
+      }
+    } finally {
+      submitters.shutdown();
+    }
+  }
+
+  @Test
+  @DisplayName("Address and buffer requests complete like their synchronous variants")
+  void zeroCopyRequests() throws Exception {
+    Pattern pattern = Pattern.compile("id=\\d+");
+    ByteBuffer buffer = direct("id=42");
+    long address = ((sun.nio.ch.DirectBuffer) buffer).address();
+
+    try (AsyncMatcher async = AsyncMatcher.create(1, 16)) {
+      CompletableFuture<Boolean> byAddress = async.matches(pattern, address, buffer.remaining());
+      CompletableFuture<Boolean> heap =
+          async.find(pattern, ByteBuffer.wrap("x id=7 y".getBytes(StandardCharsets.UTF_8)));
+      CompletableFuture<Boolean> noMatch = async.matches(pattern, direct("id="));
+
+      assertThat(byAddress.get(10, TimeUnit.SECONDS)).isTrue();
+      assertThat(heap.get(10, TimeUnit.SECONDS)).isTrue();
+      assertThat(noMatch.get(10, TimeUnit.SECONDS)).isFalse();
+    }
+  }
+
+  @Test
+  @DisplayName("close() completes queued requests and rejects later ones")
+  void close_drainsThenRejects() throws Exception {
+    Pattern pattern = Pattern.compileWithoutCache("a+");
+    AsyncMatcher async = AsyncMatcher.create(1, 10_000);
+    List<CompletableFuture<Boolean>> futures = new ArrayList<>();
+    for (int i = 0; i < 5000; i++) {
+      futures.add(async.matches(pattern, "aaa"));
+    }
+
+    async.close();
+
+    for (CompletableFuture<Boolean> future : futures) {
+      assertThat(future).isDone();
+      assertThat(future.get()).isTrue();
+    }
+    assertThat(pattern.getRefCount()).isZero();
+    assertThatThrownBy(() -> async.matches(pattern, "a").join())
+        .isInstanceOf(CompletionException.class)
+        .hasCauseInstanceOf(RejectedExecutionException.class);
+    pattern.close();
+  }
+
+  @Test
+  @DisplayName("Requests racing with close() all complete and release their pattern")
+  void submitRacingClose_allComplete() throws Exception {
+    Pattern pattern = Pattern.compileWithoutCache("a+");
+    ExecutorService submitters = Executors.newFixedThreadPool(4);
+    try {
+      for (int round = 0; round < 50; round++) {
+        AsyncMatcher async = AsyncMatcher.create(1, 100_000);
+        CountDownLatch started = new CountDownLatch(4);
+        List<Future<List<CompletableFuture<Boolean>>>> tasks = new ArrayList<>();
+        for (int t = 0; t < 4; t++) {
+          tasks.add(
+              submitters.submit(
+                  () -> {
+                    List<CompletableFuture<Boolean>> futures = new ArrayList<>();
+                    started.countDown();
+                    CompletableFuture<Boolean> future;
+                    do {
+                      future = async.matches(pattern, "aaa");
+                      futures.add(future);
+                    } while (!future.isCompletedExceptionally() && futures.size() < 20_000);
+                    return futures;
+                  }));
+        }
+
+        started.await();
+        async.close();
+
+        for (Future<List<CompletableFuture<Boolean>>> task : tasks) {
+          for (CompletableFuture<Boolean> future : task.get(10, TimeUnit.SECONDS)) {
+            assertThatCode(() -> future.handle((r, e) -> r).get(10, TimeUnit.SECONDS))
+                .doesNotThrowAnyException();
+          }
+        }
+        assertThat(pattern.getRefCount()).isZero();
+      }
+    } finally {
+      submitters.shutdown();
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("close() from a continuation on a worker does not deadlock")
+  void close_fromContinuation() throws Exception {
+    Pattern pattern = Pattern.compileWithoutCache("a+");
+    AsyncMatcher async = AsyncMatcher.create(2, 16);
+
+    CompletableFuture<Boolean> closedFromWorker =
+        async
+            .matches(pattern, "aaa")
+            .thenApply(
+                matched -> {
+                  async.close();
+                  return matched;
+                });
+
+    assertThat(closedFromWorker.get(10, TimeUnit.SECONDS)).isTrue();
+    assertThatThrownBy(() -> async.matches(pattern, "a").join())
+        .isInstanceOf(CompletionException.class)
+        .hasCauseInstanceOf(RejectedExecutionException.class);
+    pattern.close();
+  }
+
+  @Test
+  @DisplayName("Closed patterns and invalid arguments fail fast")
+  void invalidRequests() {
+    Pattern closed = Pattern.compileWithoutCache("a");
+    closed.close();
+
+    try (AsyncMatcher async = AsyncMatcher.create(1, 16)) {
+      assertThat(async.matches(closed, "a")).isCompletedExceptionally();
+      assertThatThrownBy(() -> async.find(Pattern.compile("a"), 0L, 1))
+          .isInstanceOf(IllegalArgumentException.class);
+      assertThatThrownBy(() -> async.matches(null, "a")).isInstanceOf(NullPointerException.class);
+    }
+    assertThatThrownBy(() -> AsyncMatcher.create(0, 16))
+        .isInstanceOf(IllegalArgumentException.class);
+  }
+}
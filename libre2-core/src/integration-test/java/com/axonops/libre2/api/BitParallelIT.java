@@ -0,0 +1,130 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.Random;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/** Tests for {@link Pattern#freezeBitParallel()}. */
+@DisplayName("Bit-parallel NFA engine")
+class BitParallelIT {
+
+  private static final String ALPHABET = "abcxyzAB019-_ é\n";
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(
+      strings = {
+        "(a|b)*a(a|b){20}", "abc", "a.c", "x\\d{2,3}", "(?i)caf[eé]", "^ab", "bc$", "^a+b*$",
+        "a|ab|abc", ".*", "(?s)a.b", "[^a-z]+", "(ab|ba)*c?", "a{0,5}b{2}", "(x|)", "x*", "é\\d"
+      })
+  @DisplayName("Bit-parallel matching agrees with RE2")
+  void agreesWithRe2(String regex) {
+    Pattern reference = Pattern.compileWithoutCache(regex);
+    Pattern frozen = Pattern.compileWithoutCache(regex);
+    try {
+      assumeTrue(frozen.freezeBitParallel(), "native library built without RE2 internals");
+      assertThat(frozen.isBitParallelFrozen()).isTrue();
+      assertThat(frozen.isDfaFrozen()).isFalse();
+
+      Random random = new Random(regex.hashCode());
+      String[] inputs = new String[500];
+      ByteBuffer[] buffers = new ByteBuffer[inputs.length];
+      for (int i = 0; i < inputs.length; i++) {
+        StringBuilder input = new StringBuilder();
+        for (int length = random.nextInt(40); input.length() < length; ) {
+          input.append(ALPHABET.charAt(random.nextInt(ALPHABET.length())));
+        }
+        inputs[i] = input.toString();
+        byte[] bytes = inputs[i].getBytes(StandardCharsets.UTF_8);
+        buffers[i] = ByteBuffer.allocateDirect(bytes.length).put(bytes).flip();
+      }
+      inputs[0] = "";
+      buffers[0] = ByteBuffer.allocateDirect(0);
+      inputs[1] = "b".repeat(30) + "a" + "b".repeat(20);
+
+      assertThat(frozen.matchAll(inputs)).isEqualTo(reference.matchAll(inputs));
+      assertThat(frozen.findAll(inputs)).isEqualTo(reference.findAll(inputs));
+      assertThat(frozen.matchAll(buffers)).isEqualTo(reference.matchAll(buffers));
+      assertThat(frozen.findAll(buffers)).isEqualTo(reference.findAll(buffers));
+      for (int i = 0; i < inputs.length; i++) {
+        assertThat(frozen.matches(inputs[i]))
+            .as("matches " + inputs[i])
+            .isEqualTo(reference.matches(inputs[i]));
+        assertThat(frozen.find(buffers[i]))
+            .as("find " + inputs[i])
+            .isEqualTo(reference.find(buffers[i]));
+      }
+    } finally {
+      reference.close();
+      frozen.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Patterns too large to freeze as a DFA get the NFA")
+  void coversLargeDfas() {
+    Pattern pattern = Pattern.compileWithoutCache("(a|b)*a(a|b){20}");
+    try {
+      assumeTrue(pattern.freezeBitParallel(), "native library built without RE2 internals");
+      assertThat(pattern.freezeDfa()).isFalse();
+      assertThat(pattern.freezeBitParallel()).isTrue();
+
+      String input = "b".repeat(50) + "a" + "b".repeat(20);
+      assertThat(pattern.matches(input)).isTrue();
+      assertThat(pattern.matches(input + "a")).isFalse();
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(strings = {"(?m)^b", "\\bword\\b", "a|^b", "x\\d{70}"})
+  @DisplayName("Word boundaries, inner anchors and over 64 positions are not eligible")
+  void ineligiblePatterns(String regex) {
+    Pattern probe = Pattern.compileWithoutCache("abc");
+    Pattern pattern = Pattern.compileWithoutCache(regex);
+    try {
+      assumeTrue(probe.freezeBitParallel(), "native library built without RE2 internals");
+      assertThat(pattern.freezeBitParallel()).isFalse();
+      assertThat(pattern.isBitParallelFrozen()).isFalse();
+    } finally {
+      probe.close();
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Closed patterns throw")
+  void closedPatternThrows() {
+    Pattern pattern = Pattern.compileWithoutCache("(a|b)*a(a|b){20}");
+    boolean frozen = pattern.freezeBitParallel();
+    pattern.close();
+    assertThatThrownBy(pattern::freezeBitParallel).isInstanceOf(IllegalStateException.class);
+    if (frozen) {
+      assertThatThrownBy(() -> pattern.matches("a".repeat(100)))
+          .isInstanceOf(IllegalStateException.class);
+    }
+  }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for bulk zero-copy findAllMatches / extractGroups returning {@link MatchOffsets}. */
+@DisplayName("Bulk match offsets")
+class BulkMatchOffsetsIT {
+
+  private static final String EMAIL = "(\\w+)@(\\w+)\\.com";
+
+  private static final String[] DOCUMENTS = {
+    "mail alice@example.com and bob@test.com", "nothing here", "carol@corp.com",
+  };
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  private static long address(ByteBuffer buffer) {
+    return ((sun.nio.ch.DirectBuffer) buffer).address();
+  }
+
+  @Test
+  @DisplayName("findAllMatches(long[], int[]) returns per-input match counts and group offsets")
+  void findAllMatches_addresses() {
+    Pattern pattern = Pattern.compile(EMAIL);
+    ByteBuffer[] buffers = new ByteBuffer[DOCUMENTS.length];
+    long[] addresses = new long[DOCUMENTS.length];
+    int[] lengths = new int[DOCUMENTS.length];
+    for (int i = 0; i < DOCUMENTS.length; i++) {
+      buffers[i] = direct(DOCUMENTS[i]);
+      addresses[i] = address(buffers[i]);
+      lengths[i] = buffers[i].remaining();
+    }
+
+    MatchOffsets result = pattern.findAllMatches(addresses, lengths);
+
+    assertThat(result.inputCount()).isEqualTo(3);
+    assertThat(result.groupCount()).isEqualTo(2);
+    assertThat(result.matchCount(0)).isEqualTo(2);
+    assertThat(result.matchCount(1)).isZero();
+    assertThat(result.totalMatches()).isEqualTo(3);
+    assertThat(result.start(0, 1, 1)).isEqualTo(DOCUMENTS[0].indexOf("bob"));
+    assertThat(result.end(0, 1, 1)).isEqualTo(DOCUMENTS[0].indexOf("bob") + 3);
+    assertThat(result.hasText()).isFalse();
+  }
+
+  @Test
+  @DisplayName("findAllMatches(ByteBuffer[]) agrees with per-document findAllMatches")
+  void findAllMatches_buffersAgreeWithSingle() {
+    Pattern pattern = Pattern.compile(EMAIL);
+    ByteBuffer[] buffers = new ByteBuffer[DOCUMENTS.length];
+    for (int i = 0; i < DOCUMENTS.length; i++) {
+      buffers[i] = direct(DOCUMENTS[i]);
+    }
+
+    MatchOffsets result = pattern.findAllMatches(buffers);
+
+    for (int doc = 0; doc < DOCUMENTS.length; doc++) {
+      String[][] expected = pattern.findAllMatches(buffers[doc]);
+      int expectedCount = expected == null ? 0 : expected.length;
+      assertThat(result.matchCount(doc)).isEqualTo(expectedCount);
+      for (int m = 0; m < expectedCount; m++) {
+        for (int g = 0; g <= result.groupCount(); g++) {
+          assertThat(result.group(doc, m, g)).isEqualTo(expected[m][g]);
+        }
+      }
+    }
+  }
+
+  @Test
+  @DisplayName("Heap and null buffers are packed into one native call")
+  void findAllMatches_heapBuffers() {
+    Pattern pattern = Pattern.compile(EMAIL);
+    ByteBuffer heap = ByteBuffer.wrap("x dave@home.com".getBytes(StandardCharsets.UTF_8));
+    heap.position(2);
+    ByteBuffer[] buffers = {heap, null, direct("erin@work.com")};
+
+    MatchOffsets result = pattern.findAllMatches(buffers);
+
+    assertThat(result.matchCount(0)).isEqualTo(1);
+    assertThat(result.start(0, 0, 0)).isZero(); // relative to position
+    assertThat(result.group(0, 0, 1)).isEqualTo("dave");
+    assertThat(result.matchCount(1)).isZero();
+    assertThat(result.group(2, 0, 2)).isEqualTo("work");
+  }
+
+  @Test
+  @DisplayName("extractGroups returns at most one match and -1 for non-participating groups")
+  void extractGroups_optionalGroup() {
+    Pattern pattern = Pattern.compile("(\\d+)(x)?");
+    ByteBuffer[] buffers = {direct("a1b22x"), direct("none")};
+
+    MatchOffsets result = pattern.extractGroups(buffers);
+
+    assertThat(result.matchCount(0)).isEqualTo(1);
+    assertThat(result.group(0, 0, 1)).isEqualTo("1");
+    assertThat(result.start(0, 0, 2)).isEqualTo(-1);
+    assertThat(result.group(0, 0, 2)).isNull();
+    assertThat(result.matchCount(1)).isZero();
+  }
+
+  @Test
+  @DisplayName("Packed variants split records by the offsets vector")
+  void packed() {
+    Pattern pattern = Pattern.compile("(\\d+)");
+    ByteBuffer buffer = direct("a1b2c33");
+    int[] offsets = {0, 4, 7, 7};
+
+    MatchOffsets all = pattern.findAllMatchesPacked(address(buffer), offsets);
+    MatchOffsets first = pattern.extractGroupsPacked(address(buffer), offsets);
+
+    assertThat(all.matchCount(0)).isEqualTo(2);
+    assertThat(all.start(0, 1, 1)).isEqualTo(3);
+    assertThat(all.start(1, 0, 1)).isEqualTo(1); // relative to record start
+    assertThat(all.matchCount(2)).isZero();
+    assertThat(first.matchCount(0)).isEqualTo(1);
+    assertThatThrownBy(() -> pattern.findAllMatchesPacked(address(buffer), new int[] {4, 2}))
+        .isInstanceOf(IllegalArgumentException.class);
+  }
+
+  @Test
+  @DisplayName("Empty matches advance by one character")
+  void findAllMatches_emptyMatches() {
+    Pattern pattern = Pattern.compile("a*");
+
+    MatchOffsets result = pattern.findAllMatches(new ByteBuffer[] {direct("baaac")});
+
+    assertThat(result.matchCount(0)).isEqualTo(4);
+    assertThat(result.group(0, 1, 0)).isEqualTo("aaa");
+  }
+}
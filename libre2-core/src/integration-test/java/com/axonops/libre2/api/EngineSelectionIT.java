@@ -0,0 +1,146 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for {@link Pattern#calibrateEngines()} and engine reporting. */
+@DisplayName("Adaptive match engine selection")
+class EngineSelectionIT {
+
+  private static final String[] INPUTS = {
+    "", "user-1234", "user-", "xuser-99x", "USER-1", "user-12345678901234567890", "é user-7",
+    "-".repeat(200) + "user-5", "user-" + "9".repeat(300),
+  };
+
+  @Test
+  @DisplayName("Unfrozen patterns use RE2, frozen ones the DFA tables first")
+  void defaultSelection() {
+    Pattern pattern = Pattern.compileWithoutCache("user-\\d+");
+    try {
+      assertThat(pattern.matchEngine()).isEqualTo(MatchEngine.RE2);
+      assertThat(pattern.engineShortlist()).startsWith(MatchEngine.RE2);
+
+      assumeTrue(pattern.freezeBitParallel(), "native library built without RE2 internals");
+      assertThat(pattern.matchEngine()).isEqualTo(MatchEngine.BIT_PARALLEL);
+      assertThat(pattern.freezeDfa()).isTrue();
+      assertThat(pattern.matchEngine()).isEqualTo(MatchEngine.FROZEN_DFA);
+      assertThat(pattern.engineShortlist())
+          .contains(MatchEngine.RE2, MatchEngine.FROZEN_DFA, MatchEngine.BIT_PARALLEL);
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Calibration needs sampled inputs and keeps results identical")
+  void calibrationKeepsResults() {
+    Pattern reference = Pattern.compileWithoutCache("user-\\d+");
+    Pattern pattern = Pattern.compileWithoutCache("user-\\d+");
+    try {
+      assumeTrue(pattern.freezeDfa(), "native library built without RE2 internals");
+      pattern.freezeBitParallel();
+      assertThat(pattern.calibrateEngines()).isEqualTo(MatchEngine.FROZEN_DFA);
+
+      // Enough String matches for several samples to be kept
+      for (int i = 0; i < Pattern.ENGINE_SAMPLE_INTERVAL * Pattern.ENGINE_SAMPLES; i++) {
+        try (Matcher matcher = pattern.matcher(INPUTS[i % INPUTS.length])) {
+          matcher.find();
+        }
+      }
+      MatchEngine selected = pattern.calibrateEngines();
+      assertThat(pattern.engineShortlist()).contains(selected);
+      assertThat(pattern.matchEngine()).isEqualTo(selected);
+
+      assertThat(pattern.matchAll(INPUTS)).isEqualTo(reference.matchAll(INPUTS));
+      assertThat(pattern.findAll(INPUTS)).isEqualTo(reference.findAll(INPUTS));
+      for (String input : INPUTS) {
+        try (Matcher a = pattern.matcher(input);
+            Matcher b = reference.matcher(input)) {
+          assertThat(a.matches()).as("matches " + input).isEqualTo(b.matches());
+          assertThat(a.find()).as("find " + input).isEqualTo(b.find());
+        }
+      }
+    } finally {
+      reference.close();
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Only short inputs are kept for calibration, and only until measured")
+  void samplesBoundedAndDropped() {
+    Pattern pattern = Pattern.compileWithoutCache("user-\\d+");
+    try {
+      assumeTrue(pattern.freezeDfa(), "native library built without RE2 internals");
+      int matches = Pattern.ENGINE_SAMPLE_INTERVAL * Pattern.ENGINE_SAMPLES;
+
+      String longInput = "user-" + "1".repeat(Pattern.ENGINE_SAMPLE_MAX_LENGTH);
+      for (int i = 0; i < matches; i++) {
+        try (Matcher matcher = pattern.matcher(longInput)) {
+          matcher.find();
+        }
+      }
+      assertThat(pattern.engineSampleCount()).isZero();
+
+      for (int i = 0; i < matches; i++) {
+        try (Matcher matcher = pattern.matcher(INPUTS[i % INPUTS.length])) {
+          matcher.find();
+        }
+      }
+      assertThat(pattern.engineSampleCount()).isEqualTo(Pattern.ENGINE_SAMPLES);
+
+      pattern.calibrateEngines();
+      assertThat(pattern.engineSampleCount()).isZero();
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("explain() reports the selected engine and shortlist")
+  void explainReportsEngine() {
+    Pattern pattern = Pattern.compileWithoutCache("(a|b)*a(a|b){20}");
+    try {
+      assumeTrue(pattern.freezeBitParallel(), "native library built without RE2 internals");
+      assertThat(pattern.freezeDfa()).isFalse();
+
+      PatternExplanation explanation = pattern.explain();
+      assertThat(explanation.matchEngine()).isEqualTo(MatchEngine.BIT_PARALLEL);
+      assertThat(explanation.engineShortlist())
+          .containsExactly(MatchEngine.RE2, MatchEngine.BIT_PARALLEL);
+      assertThat(explanation.shortInputEngine()).isEqualTo(MatchEngine.BIT_PARALLEL);
+      assertThat(explanation.toString()).contains("match engine:         BIT_PARALLEL");
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Closed patterns throw")
+  void closedPatternThrows() {
+    Pattern pattern = Pattern.compileWithoutCache("user-\\d+");
+    pattern.freezeDfa();
+    pattern.close();
+    assertThatThrownBy(pattern::calibrateEngines).isInstanceOf(IllegalStateException.class);
+    assertThatThrownBy(pattern::engineShortlist).isInstanceOf(IllegalStateException.class);
+  }
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.Random;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/** Tests for {@link Pattern#freezeDfa()}. */
+@DisplayName("Frozen DFA tables")
+class FrozenDfaIT {
+
+  // Longer than the Java DFA tier's limit as well as short, so both tiers reach the tables
+  private static final String[] INPUTS = {
+    "", "a", "abc", "xabcx", "ABC", "x123", "hello world", "a\nb", "a\u0000b", "café", "日本語",
+    "x😀y", "key=value;", "  padded  ", "abc".repeat(20), "-".repeat(100) + "hello world",
+    "hello world" + " ".repeat(100), "x" + "9".repeat(500), "ab\n".repeat(50) + "b",
+  };
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(
+      strings = {
+        "abc", "a.c", "x\\d{2,3}", "(?i)caf[eé]", "^ab", "bc$", "(?m)^b", "\\bworld\\b", "[^a-z]+",
+        "a|ab|abc", ".*", "\\x00", "(?s)a.b", "\\p{Han}+", "x.y", "(abc)+$", "\\s+padded", "x9+$"
+      })
+  @DisplayName("Frozen matching agrees with RE2")
+  void agreesWithRe2(String regex) {
+    Pattern reference = Pattern.compileWithoutCache(regex);
+    Pattern frozen = Pattern.compileWithoutCache(regex);
+    try {
+      assumeTrue(frozen.freezeDfa(), "native library built without RE2 internals");
+      assertThat(frozen.isDfaFrozen()).isTrue();
+      assertThat(reference.isDfaFrozen()).isFalse();
+
+      assertThat(frozen.matchAll(INPUTS)).isEqualTo(reference.matchAll(INPUTS));
+      assertThat(frozen.findAll(INPUTS)).isEqualTo(reference.findAll(INPUTS));
+
+      for (String input : INPUTS) {
+        assertThat(frozen.matches(input))
+            .as("matches " + input)
+            .isEqualTo(reference.matches(input));
+        try (Matcher a = frozen.matcher(input);
+            Matcher b = reference.matcher(input)) {
+          assertThat(a.find()).as("find " + input).isEqualTo(b.find());
+        }
+
+        byte[] bytes = input.getBytes(StandardCharsets.UTF_8);
+        ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length).put(bytes).flip();
+        assertThat(frozen.matches(buffer)).isEqualTo(reference.matches(buffer));
+        assertThat(frozen.find(buffer)).isEqualTo(reference.find(buffer));
+      }
+    } finally {
+      reference.close();
+      frozen.close();
+    }
+  }
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(strings = {"[a-z]+-\\d{4}", "user-\\d+", "(?i)^err", "\\d{4}$", "é\\d"})
+  @DisplayName("Bulk matching of direct buffers agrees with RE2")
+  void directBulkAgreesWithRe2(String regex) {
+    Pattern reference = Pattern.compileWithoutCache(regex);
+    Pattern frozen = Pattern.compileWithoutCache(regex);
+    try {
+      assumeTrue(frozen.freezeDfa(), "native library built without RE2 internals");
+
+      String alphabet = "abcERR-é0123456789";
+      Random random = new Random(7);
+      ByteBuffer[] keys = new ByteBuffer[1000];
+      for (int i = 0; i < keys.length; i++) {
+        StringBuilder key = new StringBuilder();
+        for (int length = 10 + random.nextInt(31); key.length() < length; ) {
+          key.append(alphabet.charAt(random.nextInt(alphabet.length())));
+        }
+        byte[] bytes = key.toString().getBytes(StandardCharsets.UTF_8);
+        keys[i] = ByteBuffer.allocateDirect(bytes.length).put(bytes).flip();
+      }
+      keys[3] = ByteBuffer.allocateDirect(0);
+
+      assertThat(frozen.matchAll(keys)).isEqualTo(reference.matchAll(keys));
+      assertThat(frozen.findAll(keys)).isEqualTo(reference.findAll(keys));
+    } finally {
+      reference.close();
+      frozen.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Large DFAs are not frozen and keep matching on RE2")
+  void largeDfaNotFrozen() {
+    Pattern probe = Pattern.compileWithoutCache("abc");
+    Pattern large = Pattern.compileWithoutCache("(a|b)*a(a|b){20}");
+    try {
+      assumeTrue(probe.freezeDfa(), "native library built without RE2 internals");
+      assertThat(probe.freezeDfa()).isTrue();
+
+      assertThat(large.freezeDfa()).isFalse();
+      assertThat(large.isDfaFrozen()).isFalse();
+      String input = "b".repeat(50) + "a" + "b".repeat(20);
+      assertThat(large.matches(input)).isTrue();
+      assertThat(large.matches(input + "a")).isFalse();
+    } finally {
+      probe.close();
+      large.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Invalid limits and closed patterns throw")
+  void invalidArguments() {
+    Pattern pattern = Pattern.compileWithoutCache("a+");
+    assertThatThrownBy(() -> pattern.freezeDfa(0)).isInstanceOf(IllegalArgumentException.class);
+
+    boolean frozen = pattern.freezeDfa();
+    pattern.close();
+    assertThatThrownBy(pattern::freezeDfa).isInstanceOf(IllegalStateException.class);
+    if (frozen) {
+      assertThatThrownBy(() -> pattern.matches("a".repeat(100)))
+          .isInstanceOf(IllegalStateException.class);
+    }
+  }
+}
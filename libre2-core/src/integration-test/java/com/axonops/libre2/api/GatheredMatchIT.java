@@ -0,0 +1,118 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/** Tests for {@link Pattern#matchesGathered} and {@link Pattern#findGathered}. */
+@DisplayName("Scatter-gather matching")
+class GatheredMatchIT {
+
+  private static final String[] TEXTS = {
+    "", "GET /index.html HTTP/1.1", "user=alice id=42", "id=", "café au lait", "xxxxxxxxxxid=7",
+  };
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  /** Splits UTF-8 text into segments of at most {@code size} bytes, alternating direct/heap. */
+  private static ByteBuffer[] fragments(String text, int size) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    int count = Math.max(1, (bytes.length + size - 1) / size);
+    ByteBuffer[] segments = new ByteBuffer[count];
+    for (int i = 0; i < count; i++) {
+      byte[] part = Arrays.copyOfRange(bytes, i * size, Math.min(bytes.length, (i + 1) * size));
+      ByteBuffer segment =
+          i % 2 == 0 ? ByteBuffer.allocate(part.length) : ByteBuffer.allocateDirect(part.length);
+      segments[i] = segment.put(part).flip();
+    }
+    return segments;
+  }
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(
+      strings = {"id=\\d+", ".*id=\\d+", "GET /\\S+ HTTP/1\\.[01]", "café.*", "(?i)ALICE"})
+  @DisplayName("Any fragmentation agrees with matching the whole input")
+  void fragments_agreeWithWholeInput(String regex) {
+    Pattern pattern = Pattern.compile(regex);
+
+    for (String text : TEXTS) {
+      for (int size : new int[] {1, 2, 3, 7, 64}) {
+        ByteBuffer[] segments = fragments(text, size);
+        assertThat(pattern.matchesGathered(segments))
+            .as("%s / %d", text, size)
+            .isEqualTo(pattern.matches(text));
+        assertThat(pattern.findGathered(segments))
+            .as("%s / %d", text, size)
+            .isEqualTo(pattern.find(text));
+      }
+    }
+  }
+
+  @Test
+  @DisplayName("Address segments, empty segments and positions")
+  void addressSegments() {
+    Pattern pattern = Pattern.compile("ab+c");
+    ByteBuffer first = direct("xab");
+    first.position(1);
+    ByteBuffer second = direct("bbc");
+    long[] addresses = {
+      ((sun.nio.ch.DirectBuffer) first).address() + 1,
+      0L,
+      ((sun.nio.ch.DirectBuffer) second).address()
+    };
+    int[] lengths = {2, 0, 3};
+
+    assertThat(pattern.matchesGathered(addresses, lengths)).isTrue();
+    assertThat(pattern.matchesGathered(new ByteBuffer[] {first, ByteBuffer.allocate(0), second}))
+        .isTrue();
+    assertThat(first.position()).isEqualTo(1);
+    assertThat(pattern.matchesGathered(new ByteBuffer[0])).isFalse();
+    assertThat(Pattern.compile("a*").matchesGathered(new ByteBuffer[0])).isTrue();
+  }
+
+  @Test
+  @DisplayName("Invalid segments and closed patterns throw")
+  void invalidArguments() {
+    Pattern pattern = Pattern.compileWithoutCache("a");
+
+    assertThatThrownBy(() -> pattern.matchesGathered(new long[] {0L}, new int[] {1}))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> pattern.findGathered(new long[] {1L}, new int[] {-1}))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> pattern.findGathered(new long[1], new int[2]))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> pattern.findGathered(new ByteBuffer[] {null}))
+        .isInstanceOf(NullPointerException.class);
+
+    pattern.close();
+    assertThatThrownBy(() -> pattern.findGathered(new ByteBuffer[] {direct("a")}))
+        .isInstanceOf(IllegalStateException.class);
+  }
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for {@link Pattern#aggregate} and {@link GroupAggregation}. */
+@DisplayName("Pattern.aggregate()")
+class GroupAggregationIT {
+
+  private static final String[] ACCESS_LOG = {
+    "GET /index.html 200 1024",
+    "GET /missing 404 0",
+    "POST /api 200 17",
+    "GET /index.html 200 2048",
+    "not a log line",
+    "PUT /api 500 x",
+  };
+
+  private static final String LOG_REGEX = "^(GET|POST|PUT) (\\S+) (\\d{3}) (\\S+)$";
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  private static long address(ByteBuffer buffer) {
+    return ((sun.nio.ch.DirectBuffer) buffer).address();
+  }
+
+  @Test
+  @DisplayName("Counts rows per key in first-seen order")
+  void aggregate_countOnly() {
+    Pattern pattern = Pattern.compile(LOG_REGEX);
+
+    GroupAggregation byMethod = pattern.aggregate(ACCESS_LOG, 1);
+
+    assertThat(byMethod.keys()).containsExactly("GET", "POST", "PUT");
+    assertThat(byMethod.count("GET")).isEqualTo(3);
+    assertThat(byMethod.count("POST")).isEqualTo(1);
+    assertThat(byMethod.count("DELETE")).isZero();
+    assertThat(byMethod.matchedRows()).isEqualTo(5);
+    assertThat(byMethod.unmatchedRows()).isEqualTo(1);
+    assertThat(byMethod.valueCount("GET")).isZero();
+    assertThat(byMethod.min("GET")).isEmpty();
+  }
+
+  @Test
+  @DisplayName("Summarises the value group per key, skipping unparseable values")
+  void aggregate_withValues() {
+    Pattern pattern = Pattern.compile(LOG_REGEX);
+
+    GroupAggregation byStatus = pattern.aggregate(ACCESS_LOG, 3, 4);
+
+    assertThat(byStatus.counts())
+        .containsExactly(entry("200", 3L), entry("404", 1L), entry("500", 1L));
+    assertThat(byStatus.sum("200")).isEqualTo(1024 + 17 + 2048);
+    assertThat(byStatus.min("200")).hasValue(17);
+    assertThat(byStatus.max("200")).hasValue(2048);
+    assertThat(byStatus.valueCount("500")).isZero();
+    assertThat(byStatus.count("500")).isEqualTo(1);
+    assertThat(byStatus.topKeys(1)).containsExactly("200");
+  }
+
+  @Test
+  @DisplayName("Null rows count as unmatched, empty input returns an empty aggregation")
+  void aggregate_nullAndEmpty() {
+    Pattern pattern = Pattern.compile("(\\w+)=(-?\\d+)");
+
+    GroupAggregation result = pattern.aggregate(new String[] {"a=1", null, "a=-3"}, 1, 2);
+
+    assertThat(result.count("a")).isEqualTo(2);
+    assertThat(result.sum("a")).isEqualTo(-2);
+    assertThat(result.unmatchedRows()).isEqualTo(1);
+    assertThat(pattern.aggregate(new String[0], 1).size()).isZero();
+  }
+
+  @Test
+  @DisplayName("Zero-copy rows aggregate the same as Strings")
+  void aggregate_direct() {
+    Pattern pattern = Pattern.compile(LOG_REGEX);
+    ByteBuffer[] buffers = new ByteBuffer[ACCESS_LOG.length];
+    long[] addresses = new long[ACCESS_LOG.length];
+    int[] lengths = new int[ACCESS_LOG.length];
+    for (int i = 0; i < ACCESS_LOG.length; i++) {
+      buffers[i] = direct(ACCESS_LOG[i]);
+      addresses[i] = address(buffers[i]);
+      lengths[i] = buffers[i].remaining();
+    }
+
+    GroupAggregation direct = pattern.aggregate(addresses, lengths, 3, 4);
+    GroupAggregation strings = pattern.aggregate(ACCESS_LOG, 3, 4);
+
+    assertThat(direct.counts()).isEqualTo(strings.counts());
+    assertThat(direct.sum("200")).isEqualTo(strings.sum("200"));
+    assertThat(direct.unmatchedRows()).isEqualTo(strings.unmatchedRows());
+  }
+
+  @Test
+  @DisplayName("Packed rows are split by the offsets vector")
+  void aggregatePacked() {
+    Pattern pattern = Pattern.compile(LOG_REGEX);
+    StringBuilder packed = new StringBuilder();
+    int[] offsets = new int[ACCESS_LOG.length + 1];
+    for (int i = 0; i < ACCESS_LOG.length; i++) {
+      packed.append(ACCESS_LOG[i]);
+      offsets[i + 1] = packed.length();
+    }
+    ByteBuffer buffer = direct(packed.toString());
+
+    GroupAggregation byStatus = pattern.aggregatePacked(address(buffer), offsets, 3, 4);
+
+    assertThat(byStatus.count("200")).isEqualTo(3);
+    assertThat(byStatus.sum("200")).isEqualTo(1024 + 17 + 2048);
+    assertThat(byStatus.unmatchedRows()).isEqualTo(1);
+  }
+
+  @Test
+  @DisplayName("Malformed offsets and out-of-range groups are rejected")
+  void aggregate_invalidArguments() {
+    Pattern pattern = Pattern.compile("(\\w+)=(\\d+)");
+    ByteBuffer buffer = direct("a=1b=2");
+
+    assertThatThrownBy(() -> pattern.aggregate(new String[] {"a=1"}, 3))
+        .isInstanceOf(IllegalArgumentException.class)
+        .hasMessageContaining("keyGroup");
+    assertThatThrownBy(() -> pattern.aggregate(new String[] {"a=1"}, 1, -2))
+        .isInstanceOf(IllegalArgumentException.class)
+        .hasMessageContaining("valueGroup");
+    assertThatThrownBy(() -> pattern.aggregatePacked(address(buffer), new int[] {0, 3, 2}, 1, 2))
+        .isInstanceOf(IllegalArgumentException.class)
+        .hasMessageContaining("non-decreasing");
+    assertThatThrownBy(() -> pattern.aggregate(new long[1], new int[2], 1, 2))
+        .isInstanceOf(IllegalArgumentException.class);
+  }
+
+  @Test
+  @DisplayName("aggregate() on a closed pattern throws")
+  void aggregate_closedPattern() {
+    Pattern pattern = Pattern.compileWithoutCache("(a)");
+    pattern.close();
+
+    assertThatThrownBy(() -> pattern.aggregate(new String[] {"a"}, 1))
+        .isInstanceOf(IllegalStateException.class);
+  }
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.ReadOnlyBufferException;
+import java.nio.charset.StandardCharsets;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.CsvSource;
+
+/** Tests for {@link Pattern#maskAll(ByteBuffer, byte[])} and its overloads. */
+@DisplayName("In-place masking")
+class InPlaceMaskIT {
+
+  @ParameterizedTest(name = "{0} on {1}")
+  @CsvSource(
+      delimiter = '|',
+      value = {
+        "\\d{4}-\\d{4}     | card 1234-5678 and 1111-2222 | card ********* and ********* | 2",
+        "\\b\\w            | ab cd                        | *b *d                        | 2",
+        "(?m)^a            | ab\nab                       | *b\n*b                       | 2",
+        "x*                | axxb                         | a**b                         | 1",
+        "é+                | café ok                      | caf** ok                     | 1",
+        "secret=\\S+       | user=bob secret=hunter2      | user=bob **************      | 1",
+        "z                 | nothing here                 | nothing here                 | 0",
+      })
+  @DisplayName("Matches are masked byte for byte as replaceAll would find them")
+  void masksLikeReplaceAll(String regex, String input, String expected, int count) {
+    Pattern pattern = Pattern.compileWithoutCache(regex.strip());
+    try {
+      ByteBuffer buffer = direct(input.strip().replace("\\n", "\n"));
+
+      assertThat(pattern.maskAll(buffer, (byte) '*')).isEqualTo(count);
+      assertThat(text(buffer)).isEqualTo(expected.strip().replace("\\n", "\n"));
+      assertThat(buffer.position()).isZero();
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Mask patterns repeat from the start of each match")
+  void repeatsMaskPattern() {
+    Pattern pattern = Pattern.compileWithoutCache("\\d+");
+    try {
+      ByteBuffer buffer = direct("a12345b1c");
+
+      assertThat(pattern.maskAll(buffer, "#-".getBytes(StandardCharsets.US_ASCII))).isEqualTo(2);
+      assertThat(text(buffer)).isEqualTo("a#-#-#b#c");
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Only position to limit is masked")
+  void respectsPositionAndLimit() {
+    Pattern pattern = Pattern.compileWithoutCache("\\d");
+    try {
+      ByteBuffer buffer = direct("12345");
+      buffer.position(1).limit(4);
+
+      assertThat(pattern.maskAll(buffer, (byte) 'x')).isEqualTo(3);
+      assertThat(buffer.position()).isEqualTo(1);
+      assertThat(text(buffer.clear())).isEqualTo("1xxx5");
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Records packed in one buffer are masked in one call")
+  void masksPackedRecords() {
+    Pattern pattern = Pattern.compileWithoutCache("pw=\\w+");
+    try {
+      String packed = "u=a pw=x1|u=b|u=c pw=secret pw=again";
+      ByteBuffer buffer = direct(packed);
+      ByteBuffer[] records = {
+        buffer.slice(0, 9), null, buffer.slice(10, 3), buffer.slice(14, packed.length() - 14)
+      };
+
+      assertThat(pattern.maskAll(records, new byte[] {'*'})).isEqualTo(3);
+      assertThat(text(buffer)).isEqualTo("u=a *****|u=b|u=c ********* ********");
+      assertThat(pattern.maskAll(new ByteBuffer[0], new byte[] {'*'})).isZero();
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Heap, read-only buffers, bad masks and closed patterns are rejected")
+  void invalidArguments() {
+    Pattern pattern = Pattern.compileWithoutCache("a");
+    ByteBuffer buffer = direct("aaa");
+
+    assertThatThrownBy(() -> pattern.maskAll(ByteBuffer.wrap(new byte[] {'a'}), (byte) '*'))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> pattern.maskAll(buffer.asReadOnlyBuffer(), (byte) '*'))
+        .isInstanceOf(ReadOnlyBufferException.class);
+    assertThatThrownBy(() -> pattern.maskAll(buffer, new byte[0]))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> pattern.maskAll(buffer, new byte[Pattern.MAX_MASK_BYTES + 1]))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> pattern.maskAll(new long[1], new int[2], new byte[] {'*'}))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThat(text(buffer)).isEqualTo("aaa");
+
+    pattern.close();
+    assertThatThrownBy(() -> pattern.maskAll(buffer, (byte) '*'))
+        .isInstanceOf(IllegalStateException.class);
+  }
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    return ByteBuffer.allocateDirect(bytes.length).put(bytes).flip();
+  }
+
+  private static String text(ByteBuffer buffer) {
+    byte[] bytes = new byte[buffer.remaining()];
+    buffer.duplicate().get(bytes);
+    return new String(bytes, StandardCharsets.UTF_8);
+  }
+}
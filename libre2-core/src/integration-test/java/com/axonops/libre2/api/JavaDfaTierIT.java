@@ -0,0 +1,138 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import com.axonops.libre2.cache.PatternCache;
+import com.axonops.libre2.test.TestUtils;
+import com.codahale.metrics.MetricRegistry;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/** Tests for the Java DFA tier matching short Strings without a JNI call. */
+@DisplayName("Java DFA tier for short inputs")
+class JavaDfaTierIT {
+
+  private static final String[] INPUTS = {
+    "", "a", "ab", "abc", "xabcx", "ABC", "x12", "x123", "12345", "hello world", "a\nb",
+    "a\u0000b", "café", "CAFÉ", "日本語", "x😀y", "\uD83D", "key=value;", "  padded  ",
+    "abcabcabcabcabcabcabcabcabcab",
+  };
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(
+      strings = {
+        "abc", "a.c", "x\\d{2,3}", "(?i)caf[eé]", "^ab", "bc$", "(?m)^b", "\\bworld\\b", "[^a-z]+",
+        "a|ab|abc", ".*", "\\x00", "(?s)a.b", "\\p{Han}+", "x.y", "(abc)+$", "\\s+padded"
+      })
+  @DisplayName("matches() and find() agree with native matching")
+  void agreesWithNative(String regex) {
+    Pattern pattern = Pattern.compileWithoutCache(regex);
+    try {
+      boolean[] fullMatches = pattern.matchAll(INPUTS);
+      boolean[] partialMatches = pattern.findAll(INPUTS);
+
+      for (int i = 0; i < INPUTS.length; i++) {
+        try (Matcher matcher = pattern.matcher(INPUTS[i])) {
+          assertThat(matcher.matches()).as("matches " + INPUTS[i]).isEqualTo(fullMatches[i]);
+          assertThat(matcher.find()).as("find " + INPUTS[i]).isEqualTo(partialMatches[i]);
+        }
+      }
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("Small patterns get a compact DFA, large ones match natively")
+  void compactDfaOnlyForSmallPatterns() {
+    Pattern small = Pattern.compileWithoutCache("x\\d{2,3}");
+    Pattern large = Pattern.compileWithoutCache("(a|b)*a(a|b){20}");
+    try {
+      assumeTrue(small.compactDfa(true) != CompactDfa.NONE, "RE2 internals unavailable");
+      assertThat(small.compactDfa(false)).isNotSameAs(CompactDfa.NONE);
+      assertThat(small.compactDfa(true)).isSameAs(small.compactDfa(true));
+
+      assertThat(large.compactDfa(false)).isSameAs(CompactDfa.NONE);
+      String input = "b".repeat(5) + "a" + "b".repeat(20);
+      assertThat(large.matches(input)).isTrue();
+      assertThat(large.matches(input + "a")).isFalse();
+    } finally {
+      small.close();
+      large.close();
+    }
+  }
+
+  @Test
+  @DisplayName("The compact DFA is built off the matching thread")
+  void compactDfaBuiltInBackground() {
+    MetricRegistry registry = new MetricRegistry();
+    PatternCache originalCache = TestUtils.replaceGlobalCacheWithMetrics(registry, "tier");
+    try {
+      Pattern pattern = Pattern.compile("x\\d{2,3}");
+      String counter = "tier.matching.java_dfa.operations.total.count";
+
+      // First short-input match only schedules the build and matches natively
+      assertThat(pattern.matches("x42")).isTrue();
+      assertThat(registry.counter(counter).getCount()).isZero();
+
+      CompactDfaBuilder.drain();
+      assumeTrue(pattern.compactDfa(true) != CompactDfa.NONE, "RE2 internals unavailable");
+      assertThat(pattern.matches("x42")).isTrue();
+      assertThat(pattern.matches("x4")).isFalse();
+      assertThat(registry.counter(counter).getCount()).isEqualTo(2);
+    } finally {
+      TestUtils.restoreGlobalCache(originalCache);
+    }
+  }
+
+  @Test
+  @DisplayName("Inputs just over the threshold take the native path with the same results")
+  void thresholdBoundary() {
+    Pattern pattern = Pattern.compileWithoutCache("(ab)+c?");
+    try {
+      int limit = Pattern.getGlobalCache().getConfig().javaDfaMaxInputLength();
+      String atLimit = "ab".repeat(limit / 2) + (limit % 2 == 0 ? "" : "c");
+      String overLimit = atLimit + "ab";
+
+      assertThat(atLimit).hasSize(limit);
+      assertThat(pattern.matches(atLimit)).isTrue();
+      assertThat(pattern.matches(atLimit + "x")).isFalse();
+      assertThat(pattern.matches(overLimit)).isTrue();
+      assertThat(pattern.matches(overLimit + "x")).isFalse();
+    } finally {
+      pattern.close();
+    }
+  }
+
+  @Test
+  @DisplayName("A closed pattern throws even when its compact DFA is cached")
+  void closedPatternThrows() {
+    Pattern pattern = Pattern.compileWithoutCache("a+");
+    Matcher matcher = pattern.matcher("aaa");
+    assertThat(matcher.matches()).isTrue();
+
+    pattern.close();
+    assertThatThrownBy(matcher::matches).isInstanceOf(IllegalStateException.class);
+    assertThatThrownBy(matcher::find).isInstanceOf(IllegalStateException.class);
+    matcher.close();
+  }
+}
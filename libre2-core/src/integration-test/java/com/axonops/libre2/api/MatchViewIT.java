@@ -0,0 +1,154 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for {@link Pattern#findAllMatchesView} and {@link Pattern#extractGroupsView}. */
+@DisplayName("Arena-backed MatchView")
+class MatchViewIT {
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  private static String[][] groups(MatchView view) {
+    String[][] groups = new String[view.matchCount()][view.groupCount() + 1];
+    for (int m = 0; m < view.matchCount(); m++) {
+      for (int g = 0; g <= view.groupCount(); g++) {
+        groups[m][g] = view.group(m, g);
+      }
+    }
+    return groups;
+  }
+
+  @Test
+  @DisplayName("String, heap and direct views report the same groups")
+  void findAll_inputKinds() {
+    Pattern pattern = Pattern.compile("([^ =]+)=(\\d+)?");
+    String text = "a=1 café=22 b= x";
+    String[][] expected = {{"a=1", "a", "1"}, {"café=22", "café", "22"}, {"b=", "b", null}};
+
+    assertThat(groups(pattern.findAllMatchesView(text))).isEqualTo(expected);
+    ByteBuffer heap = ByteBuffer.wrap(text.getBytes(StandardCharsets.UTF_8));
+    assertThat(groups(pattern.findAllMatchesView(heap))).isEqualTo(expected);
+    assertThat(groups(pattern.findAllMatchesView(direct(text)))).isEqualTo(expected);
+  }
+
+  @Test
+  @DisplayName("extractGroupsView reports the first match and byte offsets")
+  void extract_offsets() {
+    Pattern pattern = Pattern.compile("(é+)(x)?");
+    MatchView view = pattern.extractGroupsView("abééé!");
+
+    assertThat(view.found()).isTrue();
+    assertThat(view.matchCount()).isEqualTo(1);
+    assertThat(view.groupCount()).isEqualTo(2);
+    assertThat(view.start(0, 1)).isEqualTo(2);
+    assertThat(view.end(0, 1)).isEqualTo(8);
+    assertThat(view.length(0, 1)).isEqualTo(6);
+    assertThat(view.start(0, 2)).isEqualTo(-1);
+    assertThat(view.group(0, 2)).isNull();
+    assertThat(pattern.extractGroupsView("none").found()).isFalse();
+  }
+
+  @Test
+  @DisplayName("Buffer offsets are relative to the position, which is not moved")
+  void bufferPosition() {
+    Pattern pattern = Pattern.compile("\\d+");
+    ByteBuffer buffer = direct("xx12 345");
+    buffer.position(2);
+
+    MatchView view = pattern.findAllMatchesView(buffer);
+
+    assertThat(view.matchCount()).isEqualTo(2);
+    assertThat(view.start(1, 0)).isEqualTo(3);
+    assertThat(view.group(1, 0)).isEqualTo("345");
+    assertThat(buffer.position()).isEqualTo(2);
+  }
+
+  @Test
+  @DisplayName("Address views hold offsets only")
+  void addressView() {
+    Pattern pattern = Pattern.compile("b+");
+    ByteBuffer buffer = direct("abbbc");
+    long address = ((sun.nio.ch.DirectBuffer) buffer).address();
+
+    MatchView view = pattern.findAllMatchesView(address, buffer.remaining());
+
+    assertThat(view.hasText()).isFalse();
+    assertThat(view.start(0, 0)).isEqualTo(1);
+    assertThat(view.end(0, 0)).isEqualTo(4);
+    assertThatThrownBy(() -> view.group(0, 0)).isInstanceOf(IllegalStateException.class);
+    assertThatThrownBy(() -> view.start(1, 0)).isInstanceOf(IndexOutOfBoundsException.class);
+  }
+
+  @Test
+  @DisplayName("Results larger than the initial arena grow it transparently")
+  void arenaGrowth() {
+    Pattern pattern = Pattern.compile("(a)(b)?");
+    String text = "a".repeat(20_000);
+
+    MatchView view = pattern.findAllMatchesView(text);
+
+    assertThat(view.matchCount()).isEqualTo(20_000);
+    assertThat(view.start(19_999, 1)).isEqualTo(19_999);
+    assertThat(view.start(19_999, 2)).isEqualTo(-1);
+  }
+
+  @Test
+  @DisplayName("The same view instance is reused per thread")
+  void viewReused() throws Exception {
+    Pattern pattern = Pattern.compile("x");
+    MatchView first = pattern.findAllMatchesView("x");
+    MatchView second = pattern.extractGroupsView("y");
+
+    assertThat(second).isSameAs(first);
+    assertThat(first.found()).isFalse();
+
+    MatchView[] other = new MatchView[1];
+    Thread thread = new Thread(() -> other[0] = pattern.findAllMatchesView("xx"));
+    thread.start();
+    thread.join();
+    assertThat(other[0]).isNotSameAs(first);
+    assertThat(other[0].matchCount()).isEqualTo(2);
+  }
+
+  @Test
+  @DisplayName("Closed patterns and invalid arguments throw")
+  void invalidArguments() {
+    Pattern pattern = Pattern.compileWithoutCache("a");
+    assertThatThrownBy(() -> pattern.findAllMatchesView(0L, 1))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> pattern.extractGroupsView((String) null))
+        .isInstanceOf(NullPointerException.class);
+    pattern.close();
+
+    assertThatThrownBy(() -> pattern.findAllMatchesView("a"))
+        .isInstanceOf(IllegalStateException.class);
+    assertThatThrownBy(() -> pattern.extractGroupsView(direct("a")))
+        .isInstanceOf(IllegalStateException.class);
+  }
+}
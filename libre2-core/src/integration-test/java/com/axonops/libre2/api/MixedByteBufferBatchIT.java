@@ -0,0 +1,98 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests per-element routing of mixed heap/direct {@link ByteBuffer} batches. */
+@DisplayName("Mixed ByteBuffer batches")
+class MixedByteBufferBatchIT {
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  private static ByteBuffer heap(String text) {
+    return ByteBuffer.wrap(text.getBytes(StandardCharsets.UTF_8));
+  }
+
+  @Test
+  @DisplayName("matchAll and findAll route each element and agree with the String API")
+  void mixedBatch_agreesWithStrings() {
+    Pattern pattern = Pattern.compile("\\d+");
+    String[] texts = {"123", "abc", "45x", "678", "x9"};
+    ByteBuffer[] buffers = {
+      direct(texts[0]), heap(texts[1]), direct(texts[2]), heap(texts[3]), heap(texts[4])
+    };
+
+    assertThat(pattern.matchAll(buffers)).containsExactly(pattern.matchAll(texts));
+    assertThat(pattern.findAll(buffers)).containsExactly(pattern.findAll(texts));
+  }
+
+  @Test
+  @DisplayName("Heap buffer position, limit and read-only views are respected")
+  void heapBuffer_positionAndReadOnly() {
+    Pattern pattern = Pattern.compile("ok");
+    ByteBuffer sliced = heap("xxokyy");
+    sliced.position(2).limit(4);
+    ByteBuffer readOnly = heap("ok").asReadOnlyBuffer();
+    ByteBuffer[] buffers = {sliced, direct("no"), readOnly};
+
+    assertThat(pattern.matchAll(buffers)).containsExactly(true, false, true);
+    assertThat(sliced.position()).isEqualTo(2);
+  }
+
+  @Test
+  @DisplayName("Null elements do not match")
+  void nullElements() {
+    Pattern pattern = Pattern.compile("a");
+    ByteBuffer[] buffers = {heap("a"), null, direct("a")};
+
+    assertThat(pattern.findAll(buffers)).containsExactly(true, false, true);
+  }
+
+  @Test
+  @DisplayName("Heap batches larger than the retained scratch buffer still work")
+  void largeHeapBatch() {
+    Pattern pattern = Pattern.compile("needle$");
+    char[] filler = new char[DirectBatch.MAX_RETAINED_SCRATCH_BYTES];
+    Arrays.fill(filler, 'x');
+    String large = new String(filler) + "needle";
+    ByteBuffer[] buffers = {heap(large), direct("needle"), heap("hay")};
+
+    assertThat(pattern.findAll(buffers)).containsExactly(true, true, false);
+    assertThat(pattern.findAll(buffers)).containsExactly(true, true, false);
+  }
+
+  @Test
+  @DisplayName("replaceAll routes mixed batches in one call")
+  void replaceAll_mixed() {
+    Pattern pattern = Pattern.compile("\\d");
+    ByteBuffer[] buffers = {heap("a1b2"), direct("c3")};
+
+    assertThat(pattern.replaceAll(buffers, "#")).containsExactly("a#b#", "c#");
+  }
+}
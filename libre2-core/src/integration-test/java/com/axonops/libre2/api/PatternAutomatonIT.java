@@ -0,0 +1,154 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Optional;
+import java.util.TreeSet;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/** Tests for {@link Pattern#automaton()} and {@link PatternAutomaton}. */
+@DisplayName("Pattern.automaton()")
+class PatternAutomatonIT {
+
+  private static final String[] TERMS = {
+    "", "a", "ab", "abc", "abd", "apple", "application", "apply", "b", "banana", "band", "bandana",
+    "café", "cafe", "x1", "x12", "x123", "x1234", "zebra",
+  };
+
+  private static PatternAutomaton automaton(String regex) {
+    Optional<PatternAutomaton> automaton = Pattern.compile(regex).automaton();
+    assumeTrue(automaton.isPresent(), "RE2 internals unavailable");
+    return automaton.get();
+  }
+
+  private static byte[] utf8(String text) {
+    return text.getBytes(StandardCharsets.UTF_8);
+  }
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(
+      strings = {"ap+l.*", "ban(an)*a?", "x\\d{2,3}", "(?i)CAF[EÉ]", "a|ab|abd", ".*", "q"})
+  @DisplayName("Stepping a whole term agrees with Pattern.matches")
+  void stepping_agreesWithMatches(String regex) {
+    Pattern pattern = Pattern.compile(regex);
+    PatternAutomaton automaton = automaton(regex);
+
+    for (String term : TERMS) {
+      assertThat(automaton.matches(utf8(term))).as(term).isEqualTo(pattern.matches(term));
+    }
+  }
+
+  @Test
+  @DisplayName("Trie walk prunes dead branches and finds exactly the matching terms")
+  void trieWalk_prunesDeadBranches() {
+    PatternAutomaton automaton = automaton("ban(an)*a?");
+    TreeSet<String> dictionary = new TreeSet<>(List.of(TERMS));
+    List<String> found = new ArrayList<>();
+    int[] visited = new int[1];
+
+    walk(automaton, dictionary, "", automaton.start(), found, visited);
+
+    assertThat(found).containsExactly("banana");
+    assertThat(visited[0]).isLessThan(dictionary.size());
+  }
+
+  /** Depth-first walk over the implicit trie of a sorted term set. */
+  private static void walk(
+      PatternAutomaton automaton,
+      TreeSet<String> dictionary,
+      String prefix,
+      int state,
+      List<String> found,
+      int[] visited) {
+    if (dictionary.contains(prefix)) {
+      visited[0]++;
+      if (automaton.isMatch(state)) {
+        found.add(prefix);
+      }
+    }
+    TreeSet<Character> children = new TreeSet<>();
+    for (String term : dictionary.tailSet(prefix, false)) {
+      if (!term.startsWith(prefix)) {
+        break;
+      }
+      if (term.length() > prefix.length()) {
+        children.add(term.charAt(prefix.length()));
+      }
+    }
+    for (char child : children) {
+      byte[] edge = utf8(String.valueOf(child));
+      int next = automaton.step(state, edge, 0, edge.length);
+      if (!automaton.isDead(next)) {
+        walk(automaton, dictionary, prefix + child, next, found, visited);
+      }
+    }
+  }
+
+  @Test
+  @DisplayName("Single-byte, array and buffer stepping reach the same state")
+  void steppingVariants() {
+    PatternAutomaton automaton = automaton("x\\d+");
+    byte[] bytes = utf8("x123");
+
+    int single = automaton.start();
+    for (byte b : bytes) {
+      single = automaton.step(single, b);
+    }
+    ByteBuffer direct = ByteBuffer.allocateDirect(bytes.length).put(bytes).flip();
+
+    assertThat(automaton.step(automaton.start(), bytes, 0, bytes.length)).isEqualTo(single);
+    assertThat(automaton.step(automaton.start(), ByteBuffer.wrap(bytes))).isEqualTo(single);
+    assertThat(automaton.step(automaton.start(), direct)).isEqualTo(single);
+    assertThat(direct.position()).isZero();
+    assertThat(automaton.isMatch(single)).isTrue();
+  }
+
+  @Test
+  @DisplayName("Dead states are absorbing and prefixes of matches stay live")
+  void deadStates() {
+    PatternAutomaton automaton = automaton("abc");
+    int a = automaton.step(automaton.start(), (byte) 'a');
+    int dead = automaton.step(a, (byte) 'z');
+
+    assertThat(automaton.isDead(a)).isFalse();
+    assertThat(automaton.isMatch(a)).isFalse();
+    assertThat(automaton.isDead(dead)).isTrue();
+    assertThat(automaton.step(dead, (byte) 'b')).isEqualTo(PatternAutomaton.DEAD);
+    assertThat(automaton.isMatch(PatternAutomaton.DEAD)).isFalse();
+    assertThatThrownBy(() -> automaton.step(automaton.stateCount(), (byte) 'a'))
+        .isInstanceOf(IndexOutOfBoundsException.class);
+  }
+
+  @Test
+  @DisplayName("automaton() on a closed pattern throws")
+  void closedPattern() {
+    Pattern pattern = Pattern.compileWithoutCache("a");
+    pattern.close();
+
+    assertThatThrownBy(pattern::automaton).isInstanceOf(IllegalStateException.class);
+  }
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.Timeout;
+
+/** Tests for non-blocking {@link Pattern#close()} and background native release. */
+@DisplayName("Non-blocking pattern close")
+class PatternCloseIT {
+
+  @Test
+  @Timeout(value = 30, unit = TimeUnit.SECONDS)
+  @DisplayName("An unused pattern is released in the background")
+  void unusedPattern_releasedInBackground() throws Exception {
+    Pattern pattern = Pattern.compileWithoutCache("a+b");
+    int activeBefore = Pattern.getGlobalCache().getResourceTracker().getActivePatternCount();
+
+    CompletableFuture<Void> released = pattern.closeAsync();
+    assertThat(pattern.isClosed()).isTrue();
+
+    released.get(10, TimeUnit.SECONDS);
+    assertThat(Pattern.getGlobalCache().getResourceTracker().getActivePatternCount())
+        .isEqualTo(activeBefore - 1);
+    assertThat(pattern.closeAsync()).isCompleted();
+  }
+
+  @Test
+  @Timeout(value = 30, unit = TimeUnit.SECONDS)
+  @DisplayName("Closing with active users returns at once and releases after the last one")
+  void activeUsers_deferRelease() throws Exception {
+    Pattern pattern = Pattern.compileWithoutCache("(a|b)+c");
+    Matcher matcher = pattern.matcher("abc");
+    PatternExpression expression = PatternExpression.compile(PatternExpression.find(pattern));
+
+    CompletableFuture<Void> released = pattern.closeAsync();
+
+    assertThat(pattern.isClosed()).isTrue();
+    assertThat(released).isNotDone();
+    assertThatThrownBy(matcher::matches).isInstanceOf(IllegalStateException.class);
+    assertThatThrownBy(() -> pattern.matcher("abc")).isInstanceOf(IllegalStateException.class);
+
+    // The expression holds its reference, so the native pattern is still valid for it
+    assertThat(expression.test("xxabcxx")).isTrue();
+
+    matcher.close();
+    assertThat(released).isNotDone();
+    expression.close();
+
+    released.get(10, TimeUnit.SECONDS);
+    assertThat(pattern.getRefCount()).isZero();
+  }
+
+  @Test
+  @Timeout(value = 60, unit = TimeUnit.SECONDS)
+  @DisplayName("Concurrent users racing with close release the pattern exactly once")
+  void concurrentUsers_releasedOnce() throws Exception {
+    Pattern pattern = Pattern.compileWithoutCache("x\\d+");
+    int activeBefore = Pattern.getGlobalCache().getResourceTracker().getActivePatternCount();
+    int threadCount = 8;
+    CountDownLatch start = new CountDownLatch(1);
+    AtomicInteger unexpected = new AtomicInteger();
+    List<Thread> threads = new ArrayList<>();
+
+    for (int i = 0; i < threadCount; i++) {
+      Thread thread =
+          new Thread(
+              () -> {
+                try {
+                  start.await();
+                  for (int j = 0; j < 1000; j++) {
+                    try (Matcher matcher = pattern.matcher("x42")) {
+                      matcher.find();
+                    } catch (IllegalStateException e) {
+                      // Closed underneath us - expected once close() has run
+                    }
+                  }
+                } catch (Throwable t) {
+                  unexpected.incrementAndGet();
+                }
+              });
+      threads.add(thread);
+      thread.start();
+    }
+
+    start.countDown();
+    CompletableFuture<Void> released = pattern.closeAsync();
+    for (Thread thread : threads) {
+      thread.join();
+    }
+
+    released.get(10, TimeUnit.SECONDS);
+    assertThat(unexpected.get()).isZero();
+    assertThat(pattern.getRefCount()).isZero();
+    assertThat(Pattern.getGlobalCache().getResourceTracker().getActivePatternCount())
+        .isEqualTo(activeBefore - 1);
+  }
+
+  @Test
+  @DisplayName("Closing a cached pattern leaves it to the cache")
+  void cachedPattern_unaffected() {
+    Pattern pattern = Pattern.compile("cached-close-test");
+
+    CompletableFuture<Void> released = pattern.closeAsync();
+
+    assertThat(pattern.isClosed()).isFalse();
+    assertThat(released).isNotDone();
+    assertThat(pattern.matches("cached-close-test")).isTrue();
+  }
+}
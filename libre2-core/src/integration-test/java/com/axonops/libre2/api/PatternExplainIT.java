@@ -0,0 +1,119 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import com.axonops.libre2.api.PatternExplanation.Engine;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Tests for {@link Pattern#explain()}.
+ *
+ * <p>One-pass, BitState and DFA state fields need RE2 internals; tests that depend on them are
+ * skipped when the native library reports them as unknown.
+ */
+@DisplayName("Pattern.explain()")
+class PatternExplainIT {
+
+  @Test
+  @DisplayName("explain() reports sizes, captures and budget for a simple pattern")
+  void explain_simplePattern() {
+    Pattern pattern = Pattern.compile("(\\w+)@(\\w+)\\.com");
+
+    PatternExplanation explanation = pattern.explain();
+
+    assertThat(explanation.pattern()).isEqualTo("(\\w+)@(\\w+)\\.com");
+    assertThat(explanation.programSize()).isGreaterThan(0);
+    assertThat(explanation.reverseProgramSize()).isGreaterThan(0);
+    assertThat(explanation.captureGroups()).isEqualTo(2);
+    assertThat(explanation.maxMemBytes()).isEqualTo(pattern.getMaxMemBytes());
+    assertThat(explanation.engineFor(100, false)).isEqualTo(Engine.DFA);
+    assertThat(explanation.toString()).contains("program size").contains("capture groups");
+  }
+
+  @Test
+  @DisplayName("Anchored unambiguous pattern is one-pass")
+  void explain_onePass() {
+    PatternExplanation explanation = Pattern.compile("^(\\d+)-(\\d+)$").explain();
+    assumeTrue(explanation.onePass() != PatternExplanation.UNKNOWN, "RE2 internals unavailable");
+
+    assertThat(explanation.onePass()).isEqualTo(1);
+    assertThat(explanation.anchorStart()).isEqualTo(1);
+    assertThat(explanation.anchorEnd()).isEqualTo(1);
+    assertThat(explanation.engineFor(1_000_000, true)).isEqualTo(Engine.ONE_PASS);
+  }
+
+  @Test
+  @DisplayName("Ambiguous pattern uses BitState for short text and NFA for long text")
+  void explain_notOnePass() {
+    PatternExplanation explanation = Pattern.compile("(a+)(a+)").explain();
+    assumeTrue(explanation.onePass() != PatternExplanation.UNKNOWN, "RE2 internals unavailable");
+
+    assertThat(explanation.onePass()).isZero();
+    assertThat(explanation.bitStateMaxTextBytes()).isGreaterThan(0);
+    assertThat(explanation.engineFor(10, true)).isEqualTo(Engine.BIT_STATE);
+    assertThat(explanation.engineFor(Long.MAX_VALUE, true)).isEqualTo(Engine.NFA);
+    assertThat(explanation.guidance()).anyMatch(note -> note.contains("Not one-pass"));
+  }
+
+  @Test
+  @DisplayName("Counted repetition after an unbounded prefix exceeds a small DFA budget")
+  void explain_dfaOverBudget() {
+    try (Pattern pattern = Pattern.compileWithoutCache("(a|b)*a(a|b){20}c", true, 256 * 1024)) {
+      PatternExplanation explanation = pattern.explain();
+      assumeTrue(
+          explanation.dfaStates() != PatternExplanation.UNKNOWN, "RE2 internals unavailable");
+
+      assertThat(explanation.dfaStates()).isEqualTo(PatternExplanation.DFA_OVER_BUDGET);
+      assertThat(explanation.dfaOverBudget()).isTrue();
+      assertThat(explanation.engineFor(100, false)).isEqualTo(Engine.NFA);
+      assertThat(explanation.guidance()).anyMatch(note -> note.contains("Counted repetition"));
+    }
+  }
+
+  @Test
+  @DisplayName("Small DFA is fully counted")
+  void explain_dfaStatesCounted() {
+    PatternExplanation explanation = Pattern.compile("abc").explain();
+    assumeTrue(explanation.dfaStates() != PatternExplanation.UNKNOWN, "RE2 internals unavailable");
+
+    assertThat(explanation.dfaStates()).isGreaterThan(0);
+    assertThat(explanation.dfaOverBudget()).isFalse();
+    assertThat(explanation.guidance()).isEmpty();
+  }
+
+  @Test
+  @DisplayName("Too many capture groups are flagged")
+  void explain_tooManyCaptures() {
+    PatternExplanation explanation = Pattern.compile("(a)(b)(c)(d)(e)(f)").explain();
+
+    assertThat(explanation.captureGroups()).isEqualTo(6);
+    assertThat(explanation.guidance()).anyMatch(note -> note.contains("(?:...)"));
+  }
+
+  @Test
+  @DisplayName("explain() on a closed pattern throws")
+  void explain_closedPattern() {
+    Pattern pattern = Pattern.compileWithoutCache("abc");
+    pattern.close();
+
+    assertThatThrownBy(pattern::explain).isInstanceOf(IllegalStateException.class);
+  }
+}
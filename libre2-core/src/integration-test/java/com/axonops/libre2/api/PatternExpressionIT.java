@@ -0,0 +1,190 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static com.axonops.libre2.api.PatternExpression.*;
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for natively evaluated boolean pattern expressions. */
+@DisplayName("Pattern expressions")
+class PatternExpressionIT {
+
+  private static final String[] LINES = {
+    "ERROR disk full",
+    "ERROR health check failed",
+    "INFO request 42 served",
+    "FATAL out of memory",
+    "WARN slow request",
+    "",
+    "ERROR 500 from upstream",
+  };
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  @Test
+  @DisplayName("(p1 AND NOT p2) OR p3 agrees with evaluating each pattern")
+  void composition_agreesWithPatterns() {
+    Pattern errors = Pattern.compileWithoutCache("ERROR.*");
+    Pattern health = Pattern.compileWithoutCache("health");
+    Pattern number = Pattern.compileWithoutCache("\\d+");
+
+    try (PatternExpression expression =
+        PatternExpression.compile(matches(errors).and(not(find(health))).or(find(number)))) {
+      boolean[] expected = new boolean[LINES.length];
+      ByteBuffer[] buffers = new ByteBuffer[LINES.length];
+      for (int i = 0; i < LINES.length; i++) {
+        String line = LINES[i];
+        expected[i] = (errors.matches(line) && !health.find(line)) || number.find(line);
+        buffers[i] =
+            i % 2 == 0 ? direct(line) : ByteBuffer.wrap(line.getBytes(StandardCharsets.UTF_8));
+
+        assertThat(expression.test(line)).as(line).isEqualTo(expected[i]);
+        assertThat(expression.test(buffers[i])).as(line).isEqualTo(expected[i]);
+      }
+
+      assertThat(expression.testAll(LINES)).isEqualTo(expected);
+      assertThat(expression.testAll(buffers)).isEqualTo(expected);
+      assertThat(expression.testAll(new String[] {"ERROR x", null})).containsExactly(true, false);
+      assertThat(expression.toString())
+          .isEqualTo("((matches(/ERROR.*/) AND NOT find(/health/)) OR find(/\\d+/))");
+    }
+  }
+
+  @Test
+  @DisplayName("Literal and length predicates work on UTF-8 bytes")
+  void literalsAndLength() {
+    try (PatternExpression expression =
+        PatternExpression.compile(
+            and(startsWith("café"), endsWith("!"), contains(" au "), lengthBetween(10, 20)))) {
+      assertThat(expression.test("café au lait!")).isTrue();
+      assertThat(expression.test("café au lait")).isFalse();
+      assertThat(expression.test("cafe au lait!")).isFalse();
+      assertThat(expression.test("café au lait, with extra milk!")).isFalse();
+    }
+
+    try (PatternExpression expression =
+        PatternExpression.compile(or(lengthAtMost(0), lengthAtLeast(4).and(contains(""))))) {
+      assertThat(expression.testAll(new String[] {"", "abc", "abcd"}))
+          .containsExactly(true, false, true);
+      assertThat(expression.test(ByteBuffer.allocateDirect(0))).isTrue();
+    }
+  }
+
+  @Test
+  @DisplayName("Operators wider than one native node are split and still agree")
+  void wideOperators() {
+    Node[] operands = new Node[40];
+    for (int i = 0; i < operands.length; i++) {
+      operands[i] = contains("k" + i + ";");
+    }
+
+    try (PatternExpression any = PatternExpression.compile(or(operands));
+        PatternExpression all = PatternExpression.compile(and(operands))) {
+      StringBuilder everything = new StringBuilder();
+      for (int i = 0; i < operands.length; i++) {
+        everything.append('k').append(i).append(';');
+      }
+      assertThat(any.test("x k39; y")).isTrue();
+      assertThat(any.test("k40;")).isFalse();
+      assertThat(all.test(everything.toString())).isTrue();
+      assertThat(all.test(everything.toString().replace("k17;", ""))).isFalse();
+    }
+  }
+
+  @Test
+  @DisplayName("A cheap, selective operand is moved first in the plan")
+  void plan_reordersCheapSelectiveOperandFirst() {
+    Pattern slow = Pattern.compileWithoutCache("(a|b|c)*x[0-9]{3}(y|z)+");
+    String[] inputs = new String[256];
+    for (int i = 0; i < inputs.length; i++) {
+      inputs[i] = "abc".repeat(200) + "x" + (100 + i % 900) + "yz";
+    }
+
+    try (PatternExpression expression =
+        PatternExpression.compile(and(find(slow), lengthAtMost(3)))) {
+      assertThat(expression.plan()).contains("[not sampled]");
+      for (int round = 0; round < 200; round++) {
+        assertThat(expression.testAll(inputs)).doesNotContain(true);
+      }
+
+      String[] lines = expression.plan().split("\n");
+      assertThat(lines[0]).startsWith("AND [sampled ");
+      assertThat(lines[1].trim()).startsWith("length[0..3] [sampled ");
+      assertThat(lines[2].trim()).startsWith("find(/");
+    }
+  }
+
+  @Test
+  @DisplayName("Patterns are referenced while the expression is open")
+  void patternReferences() {
+    Pattern first = Pattern.compileWithoutCache("a+");
+    Pattern second = Pattern.compileWithoutCache("b+");
+
+    PatternExpression expression =
+        PatternExpression.compile(or(find(first), matches(first), not(find(second))));
+    assertThat(expression.patterns()).containsExactly(first, second);
+    assertThat(first.getRefCount()).isEqualTo(1);
+    assertThat(second.getRefCount()).isEqualTo(1);
+
+    expression.close();
+    expression.close();
+    assertThat(expression.isClosed()).isTrue();
+    assertThat(first.getRefCount()).isZero();
+    assertThat(second.getRefCount()).isZero();
+  }
+
+  @Test
+  @DisplayName("Invalid arguments and closed expressions throw")
+  void invalidArguments() {
+    assertThatThrownBy(() -> and()).isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> or(contains("a"), null)).isInstanceOf(NullPointerException.class);
+    assertThatThrownBy(() -> lengthBetween(5, 4)).isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> lengthAtLeast(-1)).isInstanceOf(IllegalArgumentException.class);
+
+    Node deep = contains("a");
+    for (int i = 0; i < 70; i++) {
+      deep = not(deep);
+    }
+    Node tooDeep = deep;
+    assertThatThrownBy(() -> PatternExpression.compile(tooDeep))
+        .isInstanceOf(IllegalArgumentException.class);
+
+    Pattern closedPattern = Pattern.compileWithoutCache("a");
+    closedPattern.close();
+    assertThatThrownBy(() -> PatternExpression.compile(find(closedPattern)))
+        .isInstanceOf(IllegalStateException.class);
+
+    PatternExpression expression = PatternExpression.compile(contains("a"));
+    assertThatThrownBy(() -> expression.testAll(new long[1], new int[2]))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> expression.test(0L, 1)).isInstanceOf(IllegalArgumentException.class);
+
+    expression.close();
+    assertThatThrownBy(() -> expression.test("a")).isInstanceOf(IllegalStateException.class);
+    assertThatThrownBy(expression::plan).isInstanceOf(IllegalStateException.class);
+  }
+}
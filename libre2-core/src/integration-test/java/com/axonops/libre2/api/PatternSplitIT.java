@@ -0,0 +1,132 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.CsvSource;
+
+/** Tests for {@link Pattern#split} and {@link Pattern#splitBulk}. */
+@DisplayName("Pattern.split()")
+class PatternSplitIT {
+
+  @ParameterizedTest(name = "\"{0}\".split(\"{1}\", {2})")
+  @CsvSource(
+      delimiter = '|',
+      value = {
+        "a,b,,c,,|,|0",
+        "a,b,,c,,|,|-1",
+        "a,b,,c,,|,|2",
+        "a,b|,|1",
+        ",a|,|0",
+        ",|,|0",
+        "abc|,|0",
+        "abc||0",
+        "abc||-1",
+        "baaac|a*|-1",
+        "'  x  y '|\\s+|0",
+        "héllo wörld 😀 end|\\s|0",
+        "a1b22c333|\\d+|0",
+      })
+  @DisplayName("Fields match java.util.regex split")
+  void split_matchesJdk(String input, String regex, int limit) {
+    String text = input == null ? "" : input;
+    String delimiter = regex == null ? "" : regex;
+
+    SplitResult result = Pattern.compile(delimiter).split(text, limit);
+
+    assertThat(result.fields(0)).containsExactly(text.split(delimiter, limit));
+  }
+
+  @Test
+  @DisplayName("Empty input yields one empty field")
+  void split_emptyInput() {
+    SplitResult result = Pattern.compile(",").split("");
+
+    assertThat(result.fieldCount(0)).isEqualTo(1);
+    assertThat(result.field(0, 0)).isEmpty();
+  }
+
+  @Test
+  @DisplayName("splitBulk returns offsets per input and projects columns lazily")
+  void splitBulk_offsetsAndColumns() {
+    String[] rows = {"1,alice,admin", "2,bob", null, "3,carol,user"};
+
+    SplitResult result = Pattern.compile(",").splitBulk(rows);
+
+    assertThat(result.inputCount()).isEqualTo(4);
+    assertThat(result.totalFields()).isEqualTo(8);
+    assertThat(result.fieldCount(1)).isEqualTo(2);
+    assertThat(result.fieldCount(2)).isZero();
+    assertThat(result.start(0, 1)).isEqualTo(2);
+    assertThat(result.end(0, 1)).isEqualTo(7);
+    assertThat(result.length(3, 2)).isEqualTo(4);
+    assertThat(result.column(2)).containsExactly("admin", null, null, "user");
+    assertThat(result.hasText()).isTrue();
+  }
+
+  @Test
+  @DisplayName("splitBulk with a limit keeps the remainder in the last field")
+  void splitBulk_limit() {
+    SplitResult result = Pattern.compile(":").splitBulk(new String[] {"k:v:w", "k"}, 2);
+
+    assertThat(result.fields(0)).containsExactly("k", "v:w");
+    assertThat(result.fields(1)).containsExactly("k");
+  }
+
+  @Test
+  @DisplayName("Zero-copy splitBulk returns byte offsets")
+  void splitBulk_direct() {
+    byte[] bytes = "é,b,,".getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    long address = ((sun.nio.ch.DirectBuffer) buffer).address();
+
+    SplitResult result =
+        Pattern.compile(",").splitBulk(new long[] {address, 0}, new int[] {bytes.length, 0}, 0);
+
+    assertThat(result.fieldCount(0)).isEqualTo(2);
+    assertThat(result.end(0, 0)).isEqualTo(2); // é is two bytes
+    assertThat(result.start(0, 1)).isEqualTo(3);
+    assertThat(result.fieldCount(1)).isZero();
+    assertThat(result.hasText()).isFalse();
+    assertThatThrownBy(() -> result.field(0, 0)).isInstanceOf(IllegalStateException.class);
+  }
+
+  @Test
+  @DisplayName("Out-of-range field indexes throw")
+  void split_outOfRange() {
+    SplitResult result = Pattern.compile(",").split("a,b");
+
+    assertThatThrownBy(() -> result.field(0, 2)).isInstanceOf(IndexOutOfBoundsException.class);
+    assertThatThrownBy(() -> result.fieldCount(1)).isInstanceOf(IndexOutOfBoundsException.class);
+  }
+
+  @Test
+  @DisplayName("split() on a closed pattern throws")
+  void split_closedPattern() {
+    Pattern pattern = Pattern.compileWithoutCache(",");
+    pattern.close();
+
+    assertThatThrownBy(() -> pattern.split("a,b")).isInstanceOf(IllegalStateException.class);
+  }
+}
@@ -109,8 +109,8 @@ class Phase1ExtensionsIT {
   }
 
   @Test
-  @DisplayName("matchAll(ByteBuffer[]) with all heap buffers should convert to String")
-  void matchAll_allHeapBuffers_convertsToString() {
+  @DisplayName("matchAll(ByteBuffer[]) with all heap buffers should copy into direct scratch")
+  void matchAll_allHeapBuffers_copiesToScratch() {
     Pattern pattern = Pattern.compile("test");
     ByteBuffer[] buffers = {
       createHeapBuffer("test"), createHeapBuffer("testing"), createHeapBuffer("test")
@@ -122,12 +122,12 @@ class Phase1ExtensionsIT {
   }
 
   @Test
-  @DisplayName("matchAll(ByteBuffer[]) with mixed buffers should convert all to String")
-  void matchAll_mixedBuffers_convertsToString() {
+  @DisplayName("matchAll(ByteBuffer[]) with mixed buffers should route each element")
+  void matchAll_mixedBuffers_routesPerElement() {
     Pattern pattern = Pattern.compile("test");
     ByteBuffer[] buffers = {
       createDirectBuffer("test"), // Direct
-      createHeapBuffer("testing"), // Heap - forces String path for all
+      createHeapBuffer("testing"), // Heap - copied into direct scratch
       createDirectBuffer("test") // Direct
     };
 
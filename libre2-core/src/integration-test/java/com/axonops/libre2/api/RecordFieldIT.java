@@ -0,0 +1,160 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.BitSet;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for field-aware matching of raw JSON and CSV records. */
+@DisplayName("Field-aware record matching")
+class RecordFieldIT {
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  private static ByteBuffer[] records(String... rows) {
+    ByteBuffer[] buffers = new ByteBuffer[rows.length];
+    for (int i = 0; i < rows.length; i++) {
+      // Alternate direct and heap buffers to cover both routes
+      buffers[i] =
+          i % 2 == 0 ? direct(rows[i]) : ByteBuffer.wrap(rows[i].getBytes(StandardCharsets.UTF_8));
+    }
+    return buffers;
+  }
+
+  private static BitSet bits(int... indexes) {
+    BitSet bits = new BitSet();
+    for (int index : indexes) {
+      bits.set(index);
+    }
+    return bits;
+  }
+
+  @Test
+  @DisplayName("JSON key paths match string, scalar and nested values")
+  void json_paths() {
+    ByteBuffer[] rows =
+        records(
+            "{\"user\":{\"email\":\"bob@example.com\",\"id\":7}}",
+            "{\"x\":[1,{\"user\":2}], \"user\" : { \"id\" : 42 , \"email\" : \"ann@other.org\" }}",
+            "{\"note\":\"braces } and \\\"quotes\\\" ,\",\"user\":{\"email\":\"eve@example.com\"}}",
+            "{\"user\":{\"id\":1}}",
+            "{\"user\":\"bob@example.com\"}",
+            "not json",
+            "{\"user\":{\"email\":\"cl\\u00e9o@example.com\"}}");
+
+    Pattern corporate = Pattern.compile(".*@example\\.com");
+    assertThat(corporate.matchAllField(RecordField.json("user.email"), rows))
+        .isEqualTo(bits(0, 2, 6));
+    assertThat(Pattern.compile("cléo").findAllField(RecordField.json("user.email"), rows))
+        .isEqualTo(bits(6));
+    assertThat(Pattern.compile("\\d{2}").matchAllField(RecordField.json("user.id"), rows))
+        .isEqualTo(bits(1));
+    assertThat(Pattern.compile("\\[1,.*\\]").matchAllField(RecordField.jsonKeys("x"), rows))
+        .isEqualTo(bits(1));
+  }
+
+  @Test
+  @DisplayName("CSV columns honour quoting and delimiters")
+  void csv_columns() {
+    ByteBuffer[] rows =
+        records(
+            "1,alice,active\r\n",
+            "2,\"smith, bob\",inactive",
+            "3,\"say \"\"hi\"\"\",active",
+            "4,short");
+
+    assertThat(Pattern.compile("active").matchAllField(RecordField.csv(2), rows))
+        .isEqualTo(bits(0, 2));
+    assertThat(Pattern.compile("smith, bob").matchAllField(RecordField.csv(1), rows))
+        .isEqualTo(bits(1));
+    assertThat(Pattern.compile("say \"hi\"").matchAllField(RecordField.csv(1), rows))
+        .isEqualTo(bits(2));
+    assertThat(
+            Pattern.compile("b")
+                .findAllField(RecordField.csv(1, '\t'), records("a\tb", "b\ta", "a,b")))
+        .isEqualTo(bits(0));
+  }
+
+  @Test
+  @DisplayName("Bitmaps cover batches spanning several words")
+  void largeBatch() {
+    String[] rows = new String[200];
+    BitSet expected = new BitSet();
+    for (int i = 0; i < rows.length; i++) {
+      String level = i % 3 == 0 ? "ERROR" : "INFO";
+      // Long padding pushes the field across 64-byte scan blocks
+      rows[i] = "{\"msg\":\"" + "x".repeat(i) + "\",\"level\":\"" + level + "\"}";
+      if (i % 3 == 0) {
+        expected.set(i);
+      }
+    }
+
+    BitSet result =
+        Pattern.compile("ERROR").matchAllField(RecordField.json("level"), records(rows));
+
+    assertThat(result).isEqualTo(expected);
+  }
+
+  @Test
+  @DisplayName("Address and packed entry points agree")
+  void addressAndPacked() {
+    String ndjson = "{\"a\":\"x1\"}\n{\"a\":\"y\"}\n{\"b\":\"x2\"}\n{\"a\":\"x3\"}\n";
+    ByteBuffer buffer = direct(ndjson);
+    long base = ((sun.nio.ch.DirectBuffer) buffer).address();
+    int[] offsets = {0, 11, 21, 32, 43};
+    long[] addresses = {base, base + 11, base + 21, base + 32};
+    int[] lengths = {11, 10, 11, 11};
+    Pattern pattern = Pattern.compile("x\\d");
+    RecordField field = RecordField.json("a");
+
+    assertThat(pattern.matchAllFieldPacked(field, base, offsets)).isEqualTo(bits(0, 3));
+    assertThat(pattern.findAllFieldPacked(field, base, offsets)).isEqualTo(bits(0, 3));
+    assertThat(pattern.matchAllField(field, addresses, lengths)).isEqualTo(bits(0, 3));
+    assertThat(pattern.matchAllField(field, new long[0], new int[0])).isEmpty();
+  }
+
+  @Test
+  @DisplayName("Invalid selectors, arguments and closed patterns throw")
+  void invalidArguments() {
+    assertThatThrownBy(() -> RecordField.json("user..email"))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> RecordField.jsonKeys()).isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> RecordField.csv(-1)).isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> RecordField.csv(0, '"'))
+        .isInstanceOf(IllegalArgumentException.class);
+
+    Pattern pattern = Pattern.compileWithoutCache("a");
+    assertThatThrownBy(() -> pattern.matchAllField(RecordField.csv(0), new long[1], new int[2]))
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(() -> pattern.matchAllField(null, new ByteBuffer[0]))
+        .isInstanceOf(NullPointerException.class);
+
+    pattern.close();
+    assertThatThrownBy(() -> pattern.findAllField(RecordField.csv(0), records("a")))
+        .isInstanceOf(IllegalStateException.class);
+  }
+}
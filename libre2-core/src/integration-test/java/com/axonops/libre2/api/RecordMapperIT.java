@@ -0,0 +1,121 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/** Tests for {@link Pattern#mapper(Class)}. */
+@DisplayName("Record mappers for named groups")
+class RecordMapperIT {
+
+  record Access(String user, int status, long bytes, Double latency) {}
+
+  record Date(int year, int month, int day) {}
+
+  record Named(CharSequence name, Long id) {}
+
+  record Amount(double value) {}
+
+  record Unsupported(boolean flag) {}
+
+  private static final Pattern ACCESS =
+      Pattern.compileWithoutCache(
+          "(?P<user>\\S+) (?P<status>\\d{3}) (?P<bytes>-?\\d+)(?: (?P<latency>[\\d.]+))?");
+
+  @Test
+  @DisplayName("Components are built from the groups of the same name")
+  void mapsComponents() {
+    RecordMapper<Access> mapper = ACCESS.mapper(Access.class);
+
+    assertThat(mapper.match("alice 200 5120 0.25")).isEqualTo(new Access("alice", 200, 5120, 0.25));
+    assertThat(mapper.match("bob 404 -1")).isEqualTo(new Access("bob", 404, -1, null));
+    assertThat(mapper.match("x alice 200 5120")).isNull();
+    assertThat(mapper.find(">> carol 500 9223372036854775807 1.5 <<"))
+        .isEqualTo(new Access("carol", 500, Long.MAX_VALUE, 1.5));
+    assertThat(mapper.recordType()).isEqualTo(Access.class);
+  }
+
+  @Test
+  @DisplayName("Text offsets account for multi-byte and supplementary characters")
+  void unicodeOffsets() {
+    RecordMapper<Access> mapper = ACCESS.mapper(Access.class);
+
+    assertThat(mapper.match("zoë😀 200 1")).isEqualTo(new Access("zoë😀", 200, 1, null));
+
+    RecordMapper<Named> named =
+        Pattern.compileWithoutCache("(?P<id>\\d+)?:(?P<name>.*)").mapper(Named.class);
+    Named result = named.match(":日本語");
+    assertThat(result.name().toString()).isEqualTo("日本語");
+    assertThat(result.id()).isNull();
+  }
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(
+      strings = {"0", "1.5", "-0.1", "3.141592653589793", "1e10", "2.5E-3", "123456789012345678",
+        "1e300", "4.9e-324", "0.30000000000000004", ".5", "7."})
+  @DisplayName("Doubles agree with Double.parseDouble")
+  void doublesAgreeWithJava(String text) {
+    RecordMapper<Amount> mapper =
+        Pattern.compileWithoutCache("(?P<value>[-+0-9.eE]+)").mapper(Amount.class);
+
+    assertThat(mapper.match(text).value()).isEqualTo(Double.parseDouble(text));
+  }
+
+  @Test
+  @DisplayName("Malformed and out-of-range numbers throw like the Java parsers")
+  void numberErrors() {
+    RecordMapper<Date> dates =
+        Pattern.compileWithoutCache("(?P<year>\\w+)-(?P<month>\\d+)-(?P<day>\\d+)")
+            .mapper(Date.class);
+
+    assertThat(dates.match("2025-11-24")).isEqualTo(new Date(2025, 11, 24));
+    assertThatThrownBy(() -> dates.match("20x5-11-24")).isInstanceOf(NumberFormatException.class);
+    assertThatThrownBy(() -> dates.match("2025-11-99999999999"))
+        .isInstanceOf(NumberFormatException.class);
+
+    RecordMapper<Date> optionalDay =
+        Pattern.compileWithoutCache("(?P<year>\\d+)-(?P<month>\\d+)(?:-(?P<day>\\d+))?")
+            .mapper(Date.class);
+    assertThatThrownBy(() -> optionalDay.match("2025-11"))
+        .isInstanceOf(IllegalArgumentException.class)
+        .hasMessageContaining("day");
+  }
+
+  @Test
+  @DisplayName("Unbound components, unsupported types and closed patterns throw")
+  void invalidMappers() {
+    assertThatThrownBy(() -> Pattern.compileWithoutCache("(?P<year>\\d+)").mapper(Date.class))
+        .isInstanceOf(IllegalArgumentException.class)
+        .hasMessageContaining("month");
+    Pattern flag = Pattern.compileWithoutCache("(?P<flag>\\w+)");
+    assertThatThrownBy(() -> flag.mapper(Unsupported.class))
+        .isInstanceOf(IllegalArgumentException.class)
+        .hasMessageContaining("boolean");
+    assertThatThrownBy(() -> ACCESS.mapper(null)).isInstanceOf(NullPointerException.class);
+
+    Pattern pattern = Pattern.compileWithoutCache("(?P<value>\\d+)");
+    RecordMapper<Amount> mapper = pattern.mapper(Amount.class);
+    assertThatThrownBy(() -> mapper.match(null)).isInstanceOf(NullPointerException.class);
+    pattern.close();
+    assertThatThrownBy(() -> mapper.match("1")).isInstanceOf(IllegalStateException.class);
+  }
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Random;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.ValueSource;
+
+/** Tests for {@link Pattern#matchAllSorted} and {@link Pattern#findAllSorted}. */
+@DisplayName("Sorted batch matching")
+class SortedBatchMatchIT {
+
+  private static String[] sortedKeys(int count, long seed) {
+    Random random = new Random(seed);
+    String[] segments = {"user", "order", "tenant", "acme", "a", "ab", "abc", ""};
+    List<String> keys = new ArrayList<>();
+    for (int i = 0; i < count; i++) {
+      StringBuilder key = new StringBuilder();
+      int parts = 1 + random.nextInt(4);
+      for (int p = 0; p < parts; p++) {
+        key.append(segments[random.nextInt(segments.length)]);
+        key.append(random.nextBoolean() ? ":" : "");
+        if (random.nextInt(3) == 0) {
+          key.append(random.nextInt(1000));
+        }
+      }
+      keys.add(key.toString());
+    }
+    Collections.sort(keys);
+    return keys.toArray(new String[0]);
+  }
+
+  private static ByteBuffer direct(String text) {
+    byte[] bytes = text.getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+    return buffer;
+  }
+
+  @ParameterizedTest(name = "{0}")
+  @ValueSource(
+      strings = {
+        "user:\\d+",
+        "(user|order):.*",
+        "a+b?c",
+        "^tenant",
+        "\\d$",
+        ":\\d{2}:",
+        "x*",
+        "acme:[0-9]+:order",
+        "(?i)ACME",
+      })
+  @DisplayName("Sorted results agree with matchAll and findAll")
+  void sorted_agreesWithBulk(String regex) {
+    Pattern pattern = Pattern.compile(regex);
+    String[] keys = sortedKeys(500, regex.hashCode());
+
+    assertThat(pattern.matchAllSorted(keys)).containsExactly(pattern.matchAll(keys));
+    assertThat(pattern.findAllSorted(keys)).containsExactly(pattern.findAll(keys));
+  }
+
+  @Test
+  @DisplayName("Unsorted input still gives correct results")
+  void unsorted_stillCorrect() {
+    Pattern pattern = Pattern.compile("user:(\\d+):.*");
+    List<String> keys = new ArrayList<>(List.of(sortedKeys(300, 7)));
+    keys.add("user:1:x");
+    keys.add("user:12");
+    Collections.shuffle(keys, new Random(42));
+    String[] shuffled = keys.toArray(new String[0]);
+
+    assertThat(pattern.matchAllSorted(shuffled)).containsExactly(pattern.matchAll(shuffled));
+    assertThat(pattern.findAllSorted(shuffled)).containsExactly(pattern.findAll(shuffled));
+  }
+
+  @Test
+  @DisplayName("Keys that are prefixes of each other, duplicates and nulls")
+  void prefixKeys() {
+    Pattern pattern = Pattern.compile("ab+");
+    String[] keys = {"", "a", "ab", "ab", "abb", "abbc", "abc", null, "b"};
+
+    assertThat(pattern.matchAllSorted(keys))
+        .containsExactly(false, false, true, true, true, false, false, false, false);
+    assertThat(pattern.findAllSorted(keys))
+        .containsExactly(false, false, true, true, true, true, true, false, false);
+  }
+
+  @Test
+  @DisplayName("Multi-byte UTF-8 keys sharing partial code point prefixes")
+  void utf8Keys() {
+    Pattern pattern = Pattern.compile("caf[é]\\w*");
+    String[] keys = {"cafe", "café", "caféine", "cafê", "cafë"};
+
+    assertThat(pattern.matchAllSorted(keys)).containsExactly(pattern.matchAll(keys));
+    assertThat(pattern.findAllSorted(keys)).containsExactly(pattern.findAll(keys));
+  }
+
+  @Test
+  @DisplayName("ByteBuffer and address variants agree with the String variant")
+  void zeroCopyVariants() {
+    Pattern pattern = Pattern.compile("order:\\d+");
+    String[] keys = sortedKeys(200, 3);
+    ByteBuffer[] buffers = new ByteBuffer[keys.length];
+    long[] addresses = new long[keys.length];
+    int[] lengths = new int[keys.length];
+    for (int i = 0; i < keys.length; i++) {
+      ByteBuffer buffer = direct(keys[i]);
+      addresses[i] = ((sun.nio.ch.DirectBuffer) buffer).address();
+      lengths[i] = buffer.remaining();
+      // Mixed batch: heap buffers are routed through the scratch copy
+      buffers[i] = i % 2 == 0 ? buffer : ByteBuffer.wrap(keys[i].getBytes(StandardCharsets.UTF_8));
+    }
+
+    boolean[] expectedFull = pattern.matchAll(keys);
+    boolean[] expectedPartial = pattern.findAll(keys);
+
+    assertThat(pattern.matchAllSorted(buffers)).containsExactly(expectedFull);
+    assertThat(pattern.findAllSorted(buffers)).containsExactly(expectedPartial);
+    assertThat(pattern.matchAllSorted(addresses, lengths)).containsExactly(expectedFull);
+    assertThat(pattern.findAllSorted(addresses, lengths)).containsExactly(expectedPartial);
+  }
+
+  @Test
+  @DisplayName("Empty batches, mismatched arrays and closed patterns")
+  void edgeCases() {
+    Pattern pattern = Pattern.compileWithoutCache("a");
+
+    assertThat(pattern.matchAllSorted(new String[0])).isEmpty();
+    assertThatThrownBy(() -> pattern.findAllSorted(new long[1], new int[2]))
+        .isInstanceOf(IllegalArgumentException.class);
+
+    pattern.close();
+    assertThatThrownBy(() -> pattern.matchAllSorted(new String[] {"a"}))
+        .isInstanceOf(IllegalStateException.class);
+  }
+}
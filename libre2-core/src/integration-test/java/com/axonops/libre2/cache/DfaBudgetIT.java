@@ -0,0 +1,335 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.cache;
+
+import static org.assertj.core.api.Assertions.*;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+import com.axonops.libre2.api.MatchEngine;
+import com.axonops.libre2.api.Matcher;
+import com.axonops.libre2.api.Pattern;
+import com.axonops.libre2.api.ResourceException;
+import com.axonops.libre2.test.TestUtils;
+import com.codahale.metrics.Gauge;
+import com.codahale.metrics.MetricRegistry;
+import java.util.Random;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Tests for DFA budget exhaustion detection and recompilation with a larger max_mem.
+ *
+ * <p>{@code (a|b)*a(a|b){20}c} needs ~2M DFA states on random a/b input and never matches it, so
+ * the DFA scans the whole input, keeps exhausting the default budget and RE2 falls back to the NFA.
+ * Detection needs a native build with Abseil logging and is only on while the cache asks for it;
+ * tests that depend on it are skipped otherwise.
+ */
+class DfaBudgetIT {
+
+  private static final long MB = 1L << 20;
+  private static final String EXPLOSIVE = "(a|b)*a(a|b){20}c";
+  private static final String INPUT = randomAb(2 * 1024 * 1024);
+
+  private MetricRegistry registry;
+  private PatternCache originalCache;
+
+  @BeforeEach
+  void setUp() {
+    registry = new MetricRegistry();
+    originalCache = Pattern.getGlobalCache();
+  }
+
+  @AfterEach
+  void tearDown() {
+    Pattern.getGlobalCache().shutdown();
+    TestUtils.restoreGlobalCache(originalCache);
+  }
+
+  private static PatternCache useCache(RE2Config.Builder builder) {
+    PatternCache cache = new PatternCache(builder.build());
+    Pattern.setGlobalCache(cache);
+    return cache;
+  }
+
+  private RE2Config.Builder recompileConfig(String prefix) {
+    return TestUtils.testConfigWithMetrics(registry, prefix)
+        .dfaRecompileEnabled(true)
+        .dfaRecompileFailureThreshold(1);
+  }
+
+  @Test
+  void testSimplePattern_NoDfaFailures() {
+    useCache(recompileConfig("dfa.simple"));
+    Pattern p = Pattern.compile("hello");
+    p.matches("hello");
+
+    assertThat(p.getMaxMemBytes()).isEqualTo(Pattern.DEFAULT_MAX_MEM_BYTES);
+    assertThat(p.getDfaFailureCount()).isIn(-1L, 0L);
+  }
+
+  @Test
+  void testSmallBudget_DfaFailuresCounted() {
+    useCache(recompileConfig("dfa.small"));
+    Pattern p = Pattern.compileWithoutCache(EXPLOSIVE, true, 256 * 1024);
+    try {
+      assumeTrue(p.getDfaFailureCount() >= 0, "native library cannot detect DFA failures");
+      assertThat(p.getMaxMemBytes()).isEqualTo(256 * 1024);
+
+      find(p);
+
+      assertThat(p.getDfaFailureCount()).isGreaterThan(0);
+    } finally {
+      p.close();
+    }
+  }
+
+  @Test
+  void testCompileWithoutCache_InvalidBudget() {
+    useCache(recompileConfig("dfa.invalid"));
+    assertThatThrownBy(() -> Pattern.compileWithoutCache("abc", true, 0))
+        .isInstanceOf(IllegalArgumentException.class);
+  }
+
+  @Test
+  void testScan_RecompilesChronicPattern() {
+    PatternCache cache = useCache(recompileConfig("dfa.test"));
+    Pattern p = Pattern.compile(EXPLOSIVE);
+    assumeTrue(p.getDfaFailureCount() >= 0, "native library cannot detect DFA failures");
+
+    find(p);
+
+    assertThat(cache.scanDfaFailures()).isEqualTo(1);
+
+    Pattern recompiled = Pattern.compile(EXPLOSIVE);
+    assertThat(recompiled).isNotSameAs(p);
+    assertThat(recompiled.getMaxMemBytes()).isEqualTo(2 * Pattern.DEFAULT_MAX_MEM_BYTES);
+
+    // The replaced compilation outlives the scan and one cleanup pass (grace period)
+    cache.cleanupDeferredPatterns();
+    assertThat(p.isClosed()).isFalse();
+    assertThat(p.matches("ac")).isFalse();
+    assertThat(cache.getStatistics().deferredCleanupSize()).isEqualTo(1);
+    assertThat(registry.counter("dfa.test.matching.dfa.failures.total.count").getCount())
+        .isGreaterThan(0);
+    assertThat(registry.counter("dfa.test.cache.dfa.recompilations.total.count").getCount())
+        .isEqualTo(1);
+    Gauge<?> committed = registry.getGauges().get("dfa.test.cache.dfa.max_mem.committed.bytes");
+    assertThat(committed.getValue()).isEqualTo(Pattern.DEFAULT_MAX_MEM_BYTES);
+
+    // Extra budget is returned when the pattern leaves the cache
+    cache.clear();
+    assertThat(committed.getValue()).isEqualTo(0L);
+  }
+
+  @Test
+  void testScan_BudgetExhausted_NoRecompilation() {
+    PatternCache cache = useCache(recompileConfig("dfa.budget").dfaRecompileBudgetBytes(1024));
+    Pattern p = Pattern.compile(EXPLOSIVE);
+    assumeTrue(p.getDfaFailureCount() >= 0, "native library cannot detect DFA failures");
+
+    find(p);
+
+    assertThat(cache.scanDfaFailures()).isZero();
+    assertThat(Pattern.compile(EXPLOSIVE)).isSameAs(p);
+    assertThat(registry.counter("dfa.budget.cache.dfa.budget.rejections.total.count").getCount())
+        .isEqualTo(1);
+  }
+
+  @Test
+  void testTrackingOff_FailuresNotCounted() {
+    useCache(TestUtils.testConfigWithMetrics(registry, "dfa.untracked"));
+    Pattern p = Pattern.compileWithoutCache(EXPLOSIVE, true, 256 * 1024);
+    try {
+      find(p);
+
+      assertThat(p.getDfaFailureCount()).isEqualTo(-1);
+    } finally {
+      p.close();
+    }
+  }
+
+  @Test
+  void testScan_Disabled_OnlyCountsFailures() {
+    PatternCache cache =
+        useCache(
+            TestUtils.testConfigWithMetrics(registry, "dfa.off").dfaFailureTrackingEnabled(true));
+    Pattern p = Pattern.compile(EXPLOSIVE);
+    assumeTrue(p.getDfaFailureCount() >= 0, "native library cannot detect DFA failures");
+
+    find(p);
+
+    assertThat(cache.scanDfaFailures()).isZero();
+    assertThat(Pattern.compile(EXPLOSIVE)).isSameAs(p);
+    assertThat(registry.counter("dfa.off.matching.dfa.failures.total.count").getCount())
+        .isGreaterThan(0);
+  }
+
+  // ========== Global DFA memory budget ==========
+
+  private RE2Config.Builder globalConfig(String prefix, long budgetBytes) {
+    return TestUtils.testConfigWithMetrics(registry, prefix)
+        .dfaMemoryBudgetBytes(budgetBytes)
+        .dfaRecompileFailureThreshold(1)
+        .evictionProtectionMs(0);
+  }
+
+  @Test
+  void testGlobalBudget_NewPatternsStartCold() {
+    useCache(globalConfig("dfa.cold", 64 * MB));
+
+    Pattern p = Pattern.compile("hello");
+
+    assertThat(p.getMaxMemBytes()).isEqualTo(MB);
+    assertThat(Pattern.getGlobalCache().getDfaAdmissionMaxMemBytes()).isEqualTo(MB);
+    assertThat(registry.getGauges().get("dfa.cold.cache.dfa.max_mem.committed.bytes").getValue())
+        .isEqualTo(MB);
+    assertThat(registry.getGauges().get("dfa.cold.cache.dfa.max_mem.budget.bytes").getValue())
+        .isEqualTo(64 * MB);
+  }
+
+  @Test
+  void testGlobalBudget_HotPatternPromoted() {
+    PatternCache cache = useCache(globalConfig("dfa.hot", 64 * MB));
+    Pattern p = Pattern.compile(EXPLOSIVE);
+    Pattern.compile(EXPLOSIVE); // Cache hit - hotness
+    find(p);
+
+    assertThat(cache.scanDfaFailures()).isEqualTo(1);
+
+    assertThat(Pattern.compile(EXPLOSIVE).getMaxMemBytes()).isEqualTo(2 * MB);
+    assertThat(registry.getGauges().get("dfa.hot.cache.dfa.max_mem.committed.bytes").getValue())
+        .isEqualTo(2 * MB);
+  }
+
+  @Test
+  void testGlobalBudget_ColdPatternDemotedForHotOne() {
+    String other = "(a|b)*b(a|b){20}c";
+    // A replaced compilation stays charged until freed, so promotion needs room for both copies
+    PatternCache cache = useCache(globalConfig("dfa.demote", 4 * MB));
+
+    // Promote 'other' to 2MB, then let it go cold
+    Pattern first = Pattern.compile(other);
+    Pattern.compile(other);
+    find(first);
+    assertThat(cache.scanDfaFailures()).isEqualTo(1);
+
+    // 3MB of 4MB committed - promoting the hot pattern needs other's allowance back
+    Pattern hot = Pattern.compile(EXPLOSIVE);
+    Pattern.compile(EXPLOSIVE);
+    find(hot);
+    assertThat(cache.scanDfaFailures()).isEqualTo(1);
+
+    assertThat(Pattern.compile(EXPLOSIVE).getMaxMemBytes()).isEqualTo(2 * MB);
+    assertThat(Pattern.compile(other).getMaxMemBytes()).isEqualTo(MB);
+    assertThat(registry.counter("dfa.demote.cache.dfa.demotions.total.count").getCount())
+        .isEqualTo(1);
+  }
+
+  @Test
+  void testGlobalBudget_AdmissionEvictsColdest() {
+    PatternCache cache = useCache(globalConfig("dfa.admit", 2 * MB));
+
+    Pattern one = Pattern.compile("one");
+    Pattern.compile("two");
+    Pattern.compile("three"); // Budget full - evicts 'one' before compiling
+
+    assertThat(registry.getGauges().get("dfa.admit.cache.dfa.max_mem.committed.bytes").getValue())
+        .isEqualTo(2 * MB);
+    assertThat(cache.getStatistics().currentSize()).isEqualTo(2);
+    assertThat(one.isClosed()).isTrue();
+  }
+
+  @Test
+  void testGlobalBudget_ExhaustedAdmissionRejected() {
+    PatternCache cache = useCache(globalConfig("dfa.reject", 2 * MB).evictionProtectionMs(60_000));
+
+    Pattern.compile("one");
+    Pattern.compile("two");
+
+    // Both patterns are protected from eviction, so there is no room for a third
+    assertThatThrownBy(() -> Pattern.compile("three"))
+        .isInstanceOf(ResourceException.class)
+        .hasMessageContaining("DFA memory budget exhausted");
+
+    assertThat(registry.getGauges().get("dfa.reject.cache.dfa.max_mem.committed.bytes").getValue())
+        .isEqualTo(2 * MB);
+    assertThat(cache.getStatistics().currentSize()).isEqualTo(2);
+    assertThat(registry.counter("dfa.reject.cache.dfa.budget.rejections.total.count").getCount())
+        .isEqualTo(1);
+  }
+
+  @Test
+  void testGlobalBudget_InvalidConfig() {
+    assertThatThrownBy(() -> RE2Config.builder().dfaMemoryBudgetBytes(MB / 2).build())
+        .isInstanceOf(IllegalArgumentException.class);
+    assertThatThrownBy(
+            () -> RE2Config.builder().dfaMemoryBudgetBytes(64 * MB).dfaColdMaxMemBytes(0).build())
+        .isInstanceOf(IllegalArgumentException.class);
+  }
+
+  @Test
+  void testScan_FreezesHottestPatterns() {
+    Pattern probe = Pattern.compileWithoutCache("probe");
+    boolean freezable = probe.freezeDfa();
+    probe.close();
+    assumeTrue(freezable, "native library built without RE2 internals");
+
+    PatternCache cache =
+        useCache(TestUtils.testConfigWithMetrics(registry, "dfa.freeze").dfaFreezeHotPatterns(1));
+    Pattern hot = Pattern.compile("hot\\d+");
+    Pattern cold = Pattern.compile("cold\\d+");
+    for (int i = 0; i < 3; i++) {
+      Pattern.compile("hot\\d+");
+    }
+    Pattern.compile("cold\\d+");
+
+    cache.scanDfaFailures();
+
+    assertThat(hot.isDfaFrozen()).isTrue();
+    assertThat(cold.isDfaFrozen()).isFalse();
+    assertThat(hot.matchEngine()).isEqualTo(MatchEngine.FROZEN_DFA);
+    assertThat(
+            registry.getGauges().get("dfa.freeze.cache.engine.frozen_dfa.current.count").getValue())
+        .isEqualTo(1L);
+    assertThat(hot.matches("hot42")).isTrue();
+    assertThat(hot.matches("hot")).isFalse();
+
+    // The only slot is taken until the frozen pattern leaves the cache
+    Pattern.compile("cold\\d+");
+    cache.scanDfaFailures();
+
+    assertThat(cold.isDfaFrozen()).isFalse();
+    assertThat(registry.counter("dfa.freeze.cache.dfa.frozen.total.count").getCount())
+        .isEqualTo(1);
+  }
+
+  private static void find(Pattern p) {
+    try (Matcher m = p.matcher(INPUT)) {
+      assertThat(m.find()).isFalse();
+    }
+  }
+
+  private static String randomAb(int length) {
+    Random random = new Random(42);
+    StringBuilder sb = new StringBuilder(length);
+    for (int i = 0; i < length; i++) {
+      sb.append(random.nextBoolean() ? 'a' : 'b');
+    }
+    return sb.toString();
+  }
+}
@@ -43,7 +43,7 @@ class ResourceLimitConfigurationIT {
 
     // Close all 10 patterns
     for (Pattern p : patterns) {
-      p.close();
+      p.closeAsync().join(); // Release is asynchronous
     }
 
     assertThat(Pattern.getGlobalCache().getResourceTracker().getActivePatternCount())
@@ -55,7 +55,7 @@ class ResourceLimitConfigurationIT {
     for (int i = 0; i < 10; i++) {
       Pattern p = Pattern.compileWithoutCache("new" + i);
       assertThat(p).isNotNull();
-      p.close();
+      p.closeAsync().join();
     }
 
     // Active still 0, but cumulative is now 20
@@ -72,7 +72,7 @@ class ResourceLimitConfigurationIT {
     // Compile and close patterns repeatedly
     for (int i = 0; i < 100; i++) {
       Pattern p = Pattern.compileWithoutCache("test" + i);
-      p.close();
+      p.closeAsync().join();
     }
 
     com.axonops.libre2.util.ResourceTracker.ResourceStatistics stats =
@@ -91,7 +91,7 @@ class ResourceLimitConfigurationIT {
     for (int i = 0; i < 10; i++) {
       Pattern p = Pattern.compileWithoutCache("test" + i);
       if (i < 5) {
-        p.close(); // Close first 5
+        p.closeAsync().join(); // Close first 5
       }
       // Last 5 remain open (leak)
     }
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.chronicle;
+
+import static org.assertj.core.api.Assertions.*;
+
+import com.axonops.libre2.api.Pattern;
+import java.nio.charset.StandardCharsets;
+import net.openhft.chronicle.bytes.Bytes;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for {@link ChronicleBuffers}. */
+@DisplayName("ChronicleBuffers")
+class ChronicleBuffersIT {
+
+  private static final Pattern REQUEST_LINE = Pattern.compile("GET /\\S+ HTTP/1\\.[01]");
+
+  private static Bytes<?> direct(String text) {
+    Bytes<?> bytes = Bytes.allocateElasticDirect();
+    bytes.write(text.getBytes(StandardCharsets.UTF_8));
+    return bytes;
+  }
+
+  private static Bytes<?> heap(String text) {
+    Bytes<?> bytes = Bytes.allocateElasticOnHeap();
+    bytes.write(text.getBytes(StandardCharsets.UTF_8));
+    return bytes;
+  }
+
+  @Test
+  @DisplayName("Direct and heap stores match their readable bytes")
+  void storeKinds() {
+    Bytes<?> direct = direct("GET /index.html HTTP/1.1");
+    Bytes<?> heap = heap("GET /a HTTP/1.0");
+    Bytes<?> wrapped = Bytes.wrapForRead("GET /b HTTP/1.1".getBytes(StandardCharsets.UTF_8));
+
+    try {
+      assertThat(direct.isDirectMemory()).isTrue();
+      assertThat(heap.isDirectMemory()).isFalse();
+
+      assertThat(ChronicleBuffers.matches(REQUEST_LINE, direct)).isTrue();
+      assertThat(ChronicleBuffers.matches(REQUEST_LINE, heap)).isTrue();
+      assertThat(ChronicleBuffers.matches(REQUEST_LINE, wrapped)).isTrue();
+      assertThat(ChronicleBuffers.find(Pattern.compile("index\\.html"), direct)).isTrue();
+      assertThat(ChronicleBuffers.find(Pattern.compile("HTTP/2"), heap)).isFalse();
+    } finally {
+      direct.releaseLast();
+      heap.releaseLast();
+      wrapped.releaseLast();
+    }
+  }
+
+  @Test
+  @DisplayName("Only the range from the read position is matched, and positions are not moved")
+  void readPositionOffset() {
+    Bytes<?> direct = direct("xxGET /index.html HTTP/1.1");
+    Bytes<?> heap = heap("xxGET /a HTTP/1.0");
+    direct.readSkip(2);
+    heap.readSkip(2);
+
+    try {
+      assertThat(ChronicleBuffers.matches(REQUEST_LINE, direct)).isTrue();
+      assertThat(ChronicleBuffers.matches(REQUEST_LINE, heap)).isTrue();
+      assertThat(ChronicleBuffers.find(Pattern.compile("^xx"), direct)).isFalse();
+      assertThat(ChronicleBuffers.find(Pattern.compile("^xx"), heap)).isFalse();
+
+      assertThat(direct.readPosition()).isEqualTo(2);
+      assertThat(direct.readLimit()).isEqualTo(26);
+      assertThat(heap.readPosition()).isEqualTo(2);
+      assertThat(heap.readLimit()).isEqualTo(17);
+    } finally {
+      direct.releaseLast();
+      heap.releaseLast();
+    }
+  }
+}
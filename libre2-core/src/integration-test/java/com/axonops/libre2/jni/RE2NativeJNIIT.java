@@ -707,4 +707,103 @@ class RE2NativeJNIIT {
 
     RE2NativeJNI.freePattern(h);
   }
+
+  // ========== Thread-Local Scratch Reuse ==========
+
+  /** Runs every scratch-backed hot path once with inputs of a fixed shape. */
+  private static void runHotPaths(long h, String[] texts, long[] addresses, int[] lengths) {
+    RE2NativeJNI.fullMatchBulk(h, texts);
+    RE2NativeJNI.partialMatchBulk(h, texts);
+    RE2NativeJNI.extractGroups(h, texts[0]);
+    RE2NativeJNI.extractGroupsBulk(h, texts);
+    RE2NativeJNI.findAllMatches(h, texts[0]);
+    RE2NativeJNI.splitBulk(h, texts, -1);
+    RE2NativeJNI.fullMatchDirectBulk(h, addresses, lengths);
+    RE2NativeJNI.partialMatchDirectBulk(h, addresses, lengths);
+    RE2NativeJNI.extractGroupsDirect(h, addresses[0], lengths[0]);
+    RE2NativeJNI.findAllMatchesDirect(h, addresses[0], lengths[0]);
+    RE2NativeJNI.findAllMatchesDirectBulk(h, addresses, lengths);
+  }
+
+  @Test
+  void testScratchAllocations_ZeroPerSteadyStateCall() {
+    long h = RE2NativeJNI.compile("(\\w+)=(\\d+)?", true);
+
+    String[] texts = {"a=1 b=22 c= d=333", "x=9", "none"};
+    java.nio.ByteBuffer[] buffers = new java.nio.ByteBuffer[texts.length];
+    long[] addresses = new long[texts.length];
+    int[] lengths = new int[texts.length];
+    for (int i = 0; i < texts.length; i++) {
+      byte[] bytes = texts[i].getBytes(java.nio.charset.StandardCharsets.UTF_8);
+      buffers[i] = java.nio.ByteBuffer.allocateDirect(bytes.length);
+      buffers[i].put(bytes).flip();
+      addresses[i] = ((sun.nio.ch.DirectBuffer) buffers[i]).address();
+      lengths[i] = bytes.length;
+    }
+
+    // Warm up: the first calls size the scratch buffers
+    runHotPaths(h, texts, addresses, lengths);
+    long warm = RE2NativeJNI.scratchAllocations();
+    assertTrue(warm > 0, "Warm-up should have allocated scratch");
+
+    for (int i = 0; i < 1000; i++) {
+      runHotPaths(h, texts, addresses, lengths);
+    }
+
+    assertEquals(warm, RE2NativeJNI.scratchAllocations(), "Steady-state calls must reuse scratch");
+    java.lang.ref.Reference.reachabilityFence(buffers);
+    RE2NativeJNI.freePattern(h);
+  }
+
+  @Test
+  void testMaskDirect_AllocatesNothingInSteadyState() {
+    long h = RE2NativeJNI.compile("\\d+", true);
+    byte[] text = "id 123 and 45 or 6789".getBytes(java.nio.charset.StandardCharsets.UTF_8);
+    java.nio.ByteBuffer buffer = java.nio.ByteBuffer.allocateDirect(text.length);
+    long address = ((sun.nio.ch.DirectBuffer) buffer).address();
+    long[] addresses = {address, 0, address + 11};
+    int[] lengths = {6, 0, text.length - 11};
+    byte[] mask = {'#', '-'};
+
+    buffer.put(0, text);
+    assertEquals(3, RE2NativeJNI.maskDirect(h, address, text.length, mask));
+    byte[] masked = new byte[text.length];
+    buffer.get(0, masked);
+    assertEquals(
+        "id #-# and #- or #-#-", new String(masked, java.nio.charset.StandardCharsets.UTF_8));
+
+    buffer.put(0, text);
+    assertEquals(3, RE2NativeJNI.maskDirectBulk(h, addresses, lengths, mask));
+    long warm = RE2NativeJNI.scratchAllocations();
+    for (int i = 0; i < 1000; i++) {
+      buffer.put(0, text);
+      assertEquals(3, RE2NativeJNI.maskDirect(h, address, text.length, mask));
+      buffer.put(0, text);
+      assertEquals(3, RE2NativeJNI.maskDirectBulk(h, addresses, lengths, mask));
+    }
+
+    assertEquals(warm, RE2NativeJNI.scratchAllocations(), "Masking must not allocate");
+    assertEquals(-1, RE2NativeJNI.maskDirect(h, address, text.length, new byte[0]));
+    java.lang.ref.Reference.reachabilityFence(buffer);
+    RE2NativeJNI.freePattern(h);
+  }
+
+  @Test
+  void testScratchReuse_ResultsUnaffectedByPreviousCalls() {
+    long h = RE2NativeJNI.compile("(\\d+)(x)?", true);
+
+    // A large call grows the scratch; smaller calls must not see its leftovers
+    String large = "1 ".repeat(10_000);
+    assertEquals(10_000, RE2NativeJNI.findAllMatches(h, large).length);
+
+    String[][] small = RE2NativeJNI.findAllMatches(h, "7x 8");
+    assertEquals(2, small.length);
+    assertArrayEquals(new String[] {"7x", "7", "x"}, small[0]);
+    assertArrayEquals(new String[] {"8", "8", ""}, small[1]);
+
+    String[] groups = RE2NativeJNI.extractGroups(h, "a9");
+    assertArrayEquals(new String[] {"9", "9", null}, groups);
+
+    RE2NativeJNI.freePattern(h);
+  }
 }
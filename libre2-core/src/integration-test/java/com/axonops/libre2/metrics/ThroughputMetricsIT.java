@@ -0,0 +1,136 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.metrics;
+
+import static org.assertj.core.api.Assertions.*;
+
+import com.axonops.libre2.api.Matcher;
+import com.axonops.libre2.api.Pattern;
+import com.axonops.libre2.cache.PatternCache;
+import com.axonops.libre2.cache.RE2Config;
+import com.codahale.metrics.Histogram;
+import com.codahale.metrics.MetricRegistry;
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.List;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests that bytes scanned, input-length histograms and throughput gauges are recorded. */
+@DisplayName("Throughput Metrics")
+class ThroughputMetricsIT {
+
+  private MetricRegistry registry;
+  private PatternCache originalCache;
+
+  @BeforeEach
+  void setup() {
+    originalCache = Pattern.getGlobalCache();
+    registry = new MetricRegistry();
+    RE2Config config =
+        RE2Config.builder()
+            .metricsRegistry(new DropwizardMetricsAdapter(registry, "test.re2"))
+            .build();
+    Pattern.setGlobalCache(new PatternCache(config));
+  }
+
+  @AfterEach
+  void cleanup() {
+    Pattern.getGlobalCache().shutdown();
+    Pattern.setGlobalCache(originalCache);
+  }
+
+  private long counter(String name) {
+    return registry.counter("test.re2." + name).getCount();
+  }
+
+  private Histogram histogram(String name) {
+    return registry.histogram("test.re2." + name);
+  }
+
+  @Test
+  @DisplayName("String matching records bytes and input length")
+  void stringMatching_recordsBytes() {
+    Pattern p = Pattern.compile("\\d+");
+
+    p.matches("12345");
+    try (Matcher m = p.matcher("abc 42")) {
+      m.find();
+    }
+
+    assertThat(counter(MetricNames.MATCHING_STRING_BYTES)).isEqualTo(11);
+    assertThat(counter(MetricNames.MATCHING_BYTES)).isEqualTo(11);
+    assertThat(histogram(MetricNames.MATCHING_STRING_INPUT_LENGTH).getCount()).isEqualTo(2);
+    assertThat(histogram(MetricNames.MATCHING_STRING_INPUT_LENGTH).getSnapshot().getMax())
+        .isEqualTo(6);
+  }
+
+  @Test
+  @DisplayName("Bulk matching records one histogram sample per item")
+  void bulkMatching_recordsPerItem() {
+    Pattern p = Pattern.compile("\\d+");
+
+    p.matchAll(new String[] {"1", "22", "333"});
+
+    assertThat(counter(MetricNames.MATCHING_BULK_BYTES)).isEqualTo(6);
+    assertThat(counter(MetricNames.MATCHING_BYTES)).isEqualTo(6);
+    assertThat(histogram(MetricNames.MATCHING_BULK_INPUT_LENGTH).getCount()).isEqualTo(3);
+  }
+
+  @Test
+  @DisplayName("Zero-copy matching records bytes")
+  void zeroCopyMatching_recordsBytes() {
+    Pattern p = Pattern.compile("\\d+");
+    byte[] bytes = "1234567890".getBytes(StandardCharsets.UTF_8);
+    ByteBuffer buffer = ByteBuffer.allocateDirect(bytes.length);
+    buffer.put(bytes).flip();
+
+    p.matches(buffer);
+
+    assertThat(counter(MetricNames.MATCHING_ZERO_COPY_BYTES)).isEqualTo(10);
+    assertThat(counter(MetricNames.MATCHING_BYTES)).isEqualTo(10);
+  }
+
+  @Test
+  @DisplayName("Capture operations record bytes separately from matching")
+  void capture_recordsBytes() {
+    Pattern p = Pattern.compile("(\\d+)");
+
+    p.find("abc 123");
+    p.match("456");
+    List<?> all = p.findAll("1 2 3");
+
+    assertThat(all).hasSize(3);
+    assertThat(counter(MetricNames.CAPTURE_STRING_BYTES)).isEqualTo(15);
+    assertThat(counter(MetricNames.CAPTURE_BYTES)).isEqualTo(15);
+    assertThat(counter(MetricNames.MATCHING_BYTES)).isZero();
+    assertThat(histogram(MetricNames.CAPTURE_STRING_INPUT_LENGTH).getCount()).isEqualTo(3);
+  }
+
+  @Test
+  @DisplayName("Throughput gauges are registered")
+  void throughputGauges_registered() {
+    assertThat(registry.getGauges()).containsKey("test.re2." + MetricNames.MATCHING_THROUGHPUT);
+    assertThat(registry.getGauges()).containsKey("test.re2." + MetricNames.CAPTURE_THROUGHPUT);
+
+    Pattern.compile("\\d+").matches("12345");
+
+    assertThat(Pattern.getGlobalCache().getMatchingThroughput().totalBytes()).isEqualTo(5);
+  }
+}
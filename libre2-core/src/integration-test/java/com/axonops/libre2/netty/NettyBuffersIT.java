@@ -0,0 +1,78 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.netty;
+
+import static org.assertj.core.api.Assertions.*;
+
+import com.axonops.libre2.api.Pattern;
+import io.netty.buffer.ByteBuf;
+import io.netty.buffer.CompositeByteBuf;
+import io.netty.buffer.PooledByteBufAllocator;
+import io.netty.buffer.Unpooled;
+import java.nio.charset.StandardCharsets;
+import org.junit.jupiter.api.DisplayName;
+import org.junit.jupiter.api.Test;
+
+/** Tests for {@link NettyBuffers}. */
+@DisplayName("NettyBuffers")
+class NettyBuffersIT {
+
+  private static final Pattern REQUEST_LINE = Pattern.compile("GET /\\S+ HTTP/1\\.[01]");
+
+  private static ByteBuf direct(String text) {
+    ByteBuf buffer = PooledByteBufAllocator.DEFAULT.directBuffer();
+    buffer.writeCharSequence(text, StandardCharsets.UTF_8);
+    return buffer;
+  }
+
+  @Test
+  @DisplayName("Direct, heap and composite buffers match their readable bytes")
+  void bufferKinds() {
+    ByteBuf direct = direct("xxGET /index.html HTTP/1.1");
+    direct.readerIndex(2);
+    ByteBuf heap = Unpooled.copiedBuffer("GET /a HTTP/1.0", StandardCharsets.UTF_8);
+    CompositeByteBuf composite = Unpooled.compositeBuffer();
+    composite.addComponents(
+        true,
+        direct("GET /ind"),
+        Unpooled.copiedBuffer("ex.ht", StandardCharsets.UTF_8),
+        direct("ml HTTP/1.1"));
+
+    try {
+      assertThat(NettyBuffers.matches(REQUEST_LINE, direct)).isTrue();
+      assertThat(direct.readerIndex()).isEqualTo(2);
+      assertThat(NettyBuffers.matches(REQUEST_LINE, heap)).isTrue();
+      assertThat(NettyBuffers.matches(REQUEST_LINE, composite)).isTrue();
+      assertThat(NettyBuffers.find(Pattern.compile("index\\.html"), composite)).isTrue();
+      assertThat(NettyBuffers.find(Pattern.compile("HTTP/2"), composite)).isFalse();
+    } finally {
+      direct.release();
+      heap.release();
+      composite.release();
+    }
+  }
+
+  @Test
+  @DisplayName("Reference counts are left to the caller")
+  void refCountUntouched() {
+    ByteBuf buffer = direct("GET /x HTTP/1.1");
+    NettyBuffers.matches(REQUEST_LINE, buffer);
+
+    assertThat(buffer.refCnt()).isEqualTo(1);
+    buffer.release();
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.agrona;
+
+import com.axonops.libre2.api.Pattern;
+import java.nio.ByteBuffer;
+import java.util.Objects;
+import org.agrona.DirectBuffer;
+
+/**
+ * Matches Agrona {@link DirectBuffer}s in place - requires {@code agrona} on the classpath.
+ *
+ * <p>Off-heap buffers ({@code UnsafeBuffer} over a direct {@code ByteBuffer} or raw memory, as
+ * used by Aeron) are matched by address with no copy. Buffers backed by a {@code byte[]} are
+ * matched through a heap {@link ByteBuffer} view of the same range.
+ *
+ * <pre>{@code
+ * FragmentHandler handler = (buffer, offset, length, header) -> {
+ *     if (AgronaBuffers.find(pattern, buffer, offset, length)) {
+ *         ...
+ *     }
+ * };
+ * }</pre>
+ *
+ * @since 1.3.0
+ */
+public final class AgronaBuffers {
+
+  private AgronaBuffers() {
+    // Utility class
+  }
+
+  /**
+   * Tests if a range of a buffer matches the pattern entirely.
+   *
+   * @param pattern compiled pattern
+   * @param buffer buffer holding UTF-8 text
+   * @param index first byte of the range
+   * @param length number of bytes in the range
+   * @return true if the range matches the pattern entirely
+   * @throws NullPointerException if pattern or buffer is null
+   * @throws IndexOutOfBoundsException if the range is outside the buffer
+   * @throws IllegalStateException if pattern is closed
+   */
+  public static boolean matches(Pattern pattern, DirectBuffer buffer, int index, int length) {
+    return match(pattern, buffer, index, length, true);
+  }
+
+  /**
+   * Tests if the pattern matches anywhere in a range of a buffer.
+   *
+   * @param pattern compiled pattern
+   * @param buffer buffer holding UTF-8 text
+   * @param index first byte of the range
+   * @param length number of bytes in the range
+   * @return true if the pattern matches anywhere in the range
+   * @throws NullPointerException if pattern or buffer is null
+   * @throws IndexOutOfBoundsException if the range is outside the buffer
+   * @throws IllegalStateException if pattern is closed
+   */
+  public static boolean find(Pattern pattern, DirectBuffer buffer, int index, int length) {
+    return match(pattern, buffer, index, length, false);
+  }
+
+  private static boolean match(
+      Pattern pattern, DirectBuffer buffer, int index, int length, boolean fullMatch) {
+    Objects.requireNonNull(pattern, "pattern cannot be null");
+    Objects.requireNonNull(buffer, "buffer cannot be null");
+    Objects.checkFromIndexSize(index, length, buffer.capacity());
+
+    byte[] array = buffer.byteArray();
+    if (array == null) {
+      // Off-heap: addressOffset() is the absolute address of index 0
+      long address = buffer.addressOffset() + index;
+      return fullMatch ? pattern.matches(address, length) : pattern.find(address, length);
+    }
+
+    ByteBuffer view = ByteBuffer.wrap(array, buffer.wrapAdjustment() + index, length);
+    return fullMatch ? pattern.matches(view) : pattern.find(view);
+  }
+}
@@ -0,0 +1,433 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Objects;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicBoolean;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+/**
+ * Asynchronous match requests, batched across callers into bulk native calls.
+ *
+ * <p>Service threads that each issue small, independent matches pay one JNI transition per
+ * request. Here callers only enqueue the request into a bounded submission ring and get a {@link
+ * CompletableFuture}; worker threads drain the ring in batches, group the requests by pattern and
+ * operation, and run each group as one bulk native call ({@link Pattern#matchAll(String[])}, {@link
+ * Pattern#findAll(long[], int[])}, ...). The submitting thread never enters native code.
+ *
+ * <pre>{@code
+ * try (AsyncMatcher async = AsyncMatcher.create()) {
+ *     CompletableFuture<Boolean> valid = async.matches(emailPattern, input);
+ *     valid.thenAccept(ok -> ...);
+ * }
+ * }</pre>
+ *
+ * <p>Futures complete on a worker thread; use the {@code *Async} stages for heavy continuations.
+ * When the ring is full, or after {@link #close()}, requests fail with {@link
+ * RejectedExecutionException} instead of blocking the caller. A pattern with pending requests is
+ * pinned like a {@link Matcher} pins it, so cache eviction cannot free it underneath a batch.
+ * Address and buffer inputs must stay valid and unmodified until their future completes.
+ *
+ * @since 1.3.0
+ */
+public final class AsyncMatcher implements AutoCloseable {
+  private static final Logger logger = LoggerFactory.getLogger(AsyncMatcher.class);
+
+  /** Default submission ring capacity. */
+  public static final int DEFAULT_CAPACITY = 65_536;
+
+  /** Most requests a worker takes from the ring per drain. */
+  public static final int MAX_BATCH = 1024;
+
+  // How long idle workers wait before re-checking for shutdown
+  private static final long POLL_MILLIS = 50;
+
+  private final ArrayBlockingQueue<Request> ring;
+  private final int capacity;
+  private final List<Thread> workers = new ArrayList<>();
+  private final Map<Pattern, Integer> pinned = new ConcurrentHashMap<>();
+  private final AtomicBoolean closed = new AtomicBoolean(false);
+
+  private AsyncMatcher(int workerCount, int capacity) {
+    this.ring = new ArrayBlockingQueue<>(capacity);
+    this.capacity = capacity;
+    for (int i = 0; i < workerCount; i++) {
+      Thread worker = new Thread(this::runWorker, "RE2-AsyncMatcher-" + i);
+      worker.setDaemon(true);
+      workers.add(worker);
+    }
+    workers.forEach(Thread::start);
+  }
+
+  /**
+   * Creates an async matcher with one worker per two available processors and {@link
+   * #DEFAULT_CAPACITY}.
+   *
+   * @return a running async matcher; close it to stop its workers
+   */
+  public static AsyncMatcher create() {
+    return create(Math.max(1, Runtime.getRuntime().availableProcessors() / 2), DEFAULT_CAPACITY);
+  }
+
+  /**
+   * Creates an async matcher.
+   *
+   * @param workers number of worker threads draining the ring
+   * @param capacity maximum pending requests before submissions are rejected
+   * @return a running async matcher; close it to stop its workers
+   * @throws IllegalArgumentException if workers or capacity is not positive
+   */
+  public static AsyncMatcher create(int workers, int capacity) {
+    if (workers <= 0) {
+      throw new IllegalArgumentException("workers must be positive: " + workers);
+    }
+    if (capacity <= 0) {
+      throw new IllegalArgumentException("capacity must be positive: " + capacity);
+    }
+    return new AsyncMatcher(workers, capacity);
+  }
+
+  /**
+   * Submits a full match of a String.
+   *
+   * @param pattern compiled pattern
+   * @param input text to match
+   * @return future completing with the result of {@link Pattern#matches(String)}
+   * @throws NullPointerException if pattern or input is null
+   */
+  public CompletableFuture<Boolean> matches(Pattern pattern, String input) {
+    Objects.requireNonNull(input, "input cannot be null");
+    return submit(new Request(pattern, true, input, 0, 0, null));
+  }
+
+  /**
+   * Submits a partial match (find anywhere) of a String.
+   *
+   * @param pattern compiled pattern
+   * @param input text to search
+   * @return future completing with true if the pattern occurs in input
+   * @throws NullPointerException if pattern or input is null
+   */
+  public CompletableFuture<Boolean> find(Pattern pattern, String input) {
+    Objects.requireNonNull(input, "input cannot be null");
+    return submit(new Request(pattern, false, input, 0, 0, null));
+  }
+
+  /**
+   * Submits a full match of off-heap memory. The memory must stay valid until the future
+   * completes.
+   *
+   * @param pattern compiled pattern
+   * @param address native memory address of UTF-8 text
+   * @param length number of bytes
+   * @return future completing with the result of {@link Pattern#matches(long, int)}
+   * @throws NullPointerException if pattern is null
+   * @throws IllegalArgumentException if address is 0 or length is negative
+   */
+  public CompletableFuture<Boolean> matches(Pattern pattern, long address, int length) {
+    checkAddress(address, length);
+    return submit(new Request(pattern, true, null, address, length, null));
+  }
+
+  /**
+   * Submits a partial match of off-heap memory. The memory must stay valid until the future
+   * completes.
+   *
+   * @param pattern compiled pattern
+   * @param address native memory address of UTF-8 text
+   * @param length number of bytes
+   * @return future completing with the result of {@link Pattern#find(long, int)}
+   * @throws NullPointerException if pattern is null
+   * @throws IllegalArgumentException if address is 0 or length is negative
+   */
+  public CompletableFuture<Boolean> find(Pattern pattern, long address, int length) {
+    checkAddress(address, length);
+    return submit(new Request(pattern, false, null, address, length, null));
+  }
+
+  /**
+   * Submits a full match of a buffer (position to limit), heap or direct. The buffer must not be
+   * modified until the future completes.
+   *
+   * @param pattern compiled pattern
+   * @param buffer text to match
+   * @return future completing with the result of {@link Pattern#matches(ByteBuffer)}
+   * @throws NullPointerException if pattern or buffer is null
+   */
+  public CompletableFuture<Boolean> matches(Pattern pattern, ByteBuffer buffer) {
+    Objects.requireNonNull(buffer, "buffer cannot be null");
+    return submit(new Request(pattern, true, null, 0, 0, buffer));
+  }
+
+  /**
+   * Submits a partial match of a buffer (position to limit), heap or direct. The buffer must not
+   * be modified until the future completes.
+   *
+   * @param pattern compiled pattern
+   * @param buffer text to search
+   * @return future completing with the result of {@link Pattern#find(ByteBuffer)}
+   * @throws NullPointerException if pattern or buffer is null
+   */
+  public CompletableFuture<Boolean> find(Pattern pattern, ByteBuffer buffer) {
+    Objects.requireNonNull(buffer, "buffer cannot be null");
+    return submit(new Request(pattern, false, null, 0, 0, buffer));
+  }
+
+  /**
+   * Gets the number of requests waiting in the submission ring.
+   *
+   * @return pending request count
+   */
+  public int pending() {
+    return ring.size();
+  }
+
+  /**
+   * Stops accepting requests, completes those already queued and stops the workers. Idempotent.
+   *
+   * <p>May be called from a continuation running on a worker: that worker is not waited for, and
+   * keeps completing queued requests until the ring is empty once the continuation returns.
+   */
+  @Override
+  public void close() {
+    if (!closed.compareAndSet(false, true)) {
+      return;
+    }
+    Thread self = Thread.currentThread();
+    for (Thread worker : workers) {
+      if (worker == self) {
+        continue; // Joining ourselves would never return
+      }
+      try {
+        worker.join();
+      } catch (InterruptedException e) {
+        Thread.currentThread().interrupt();
+        break;
+      }
+    }
+    if (workers.contains(self)) {
+      return; // The calling worker still drains the ring
+    }
+
+    // Requests that raced with close() after the workers drained the ring
+    List<Request> orphans = new ArrayList<>();
+    ring.drainTo(orphans);
+    for (Request request : orphans) {
+      unpin(request.pattern, 1);
+      request.future.completeExceptionally(
+          new RejectedExecutionException("RE2: AsyncMatcher is closed"));
+    }
+  }
+
+  private static void checkAddress(long address, int length) {
+    if (address == 0) {
+      throw new IllegalArgumentException("Address must not be 0");
+    }
+    if (length < 0) {
+      throw new IllegalArgumentException("Length must not be negative: " + length);
+    }
+  }
+
+  private CompletableFuture<Boolean> submit(Request request) {
+    if (closed.get()) {
+      return CompletableFuture.failedFuture(
+          new RejectedExecutionException("RE2: AsyncMatcher is closed"));
+    }
+    if (request.pattern.isClosed()) {
+      return CompletableFuture.failedFuture(new IllegalStateException("RE2: Pattern is closed"));
+    }
+
+    try {
+      pin(request.pattern);
+    } catch (ResourceException | IllegalStateException e) {
+      return CompletableFuture.failedFuture(e);
+    }
+    if (!ring.offer(request)) {
+      unpin(request.pattern, 1);
+      return CompletableFuture.failedFuture(
+          new RejectedExecutionException(
+              "RE2: AsyncMatcher submission ring full (capacity " + capacity + ")"));
+    }
+    // close() may have run to completion since the check above; if nobody took the request,
+    // take it back. Otherwise a worker or close()'s orphan drain completes it.
+    if (closed.get() && ring.remove(request)) {
+      unpin(request.pattern, 1);
+      return CompletableFuture.failedFuture(
+          new RejectedExecutionException("RE2: AsyncMatcher is closed"));
+    }
+    return request.future;
+  }
+
+  // One pattern reference per pattern with pending requests, not one per request, so a burst
+  // cannot exhaust maxMatchersPerPattern
+  private void pin(Pattern pattern) {
+    pinned.compute(
+        pattern,
+        (p, count) -> {
+          if (count == null) {
+            p.incrementRefCount();
+            return 1;
+          }
+          return count + 1;
+        });
+  }
+
+  private void unpin(Pattern pattern, int requests) {
+    pinned.compute(
+        pattern,
+        (p, count) -> {
+          int remaining = count - requests;
+          if (remaining == 0) {
+            p.decrementRefCount();
+            return null;
+          }
+          return remaining;
+        });
+  }
+
+  private void runWorker() {
+    List<Request> batch = new ArrayList<>(MAX_BATCH);
+    while (true) {
+      Request first;
+      try {
+        first = ring.poll(POLL_MILLIS, TimeUnit.MILLISECONDS);
+      } catch (InterruptedException e) {
+        first = null;
+      }
+      if (first == null) {
+        if (closed.get() && ring.isEmpty()) {
+          return;
+        }
+        continue;
+      }
+
+      batch.add(first);
+      ring.drainTo(batch, MAX_BATCH - 1);
+      try {
+        process(batch);
+      } catch (RuntimeException e) {
+        logger.error("RE2: AsyncMatcher batch failed", e);
+      }
+      batch.clear();
+    }
+  }
+
+  /** Runs a drained batch as one bulk call per (pattern, operation, input kind). */
+  private void process(List<Request> batch) {
+    Map<GroupKey, List<Request>> groups = new LinkedHashMap<>();
+    for (Request request : batch) {
+      groups.computeIfAbsent(request.groupKey(), k -> new ArrayList<>()).add(request);
+    }
+
+    for (Map.Entry<GroupKey, List<Request>> group : groups.entrySet()) {
+      GroupKey key = group.getKey();
+      List<Request> requests = group.getValue();
+      try {
+        boolean[] results = run(key, requests);
+        for (int i = 0; i < requests.size(); i++) {
+          requests.get(i).future.complete(results[i]);
+        }
+      } catch (RuntimeException e) {
+        for (Request request : requests) {
+          request.future.completeExceptionally(e);
+        }
+      } finally {
+        unpin(key.pattern(), requests.size());
+      }
+    }
+  }
+
+  private static boolean[] run(GroupKey key, List<Request> requests) {
+    Pattern pattern = key.pattern();
+    int size = requests.size();
+    if (key.kind() == InputKind.STRING) {
+      String[] inputs = new String[size];
+      for (int i = 0; i < size; i++) {
+        inputs[i] = requests.get(i).text;
+      }
+      return key.fullMatch() ? pattern.matchAll(inputs) : pattern.findAll(inputs);
+    }
+
+    if (key.kind() == InputKind.ADDRESS) {
+      long[] addresses = new long[size];
+      int[] lengths = new int[size];
+      for (int i = 0; i < size; i++) {
+        addresses[i] = requests.get(i).address;
+        lengths[i] = requests.get(i).length;
+      }
+      return key.fullMatch()
+          ? pattern.matchAll(addresses, lengths)
+          : pattern.findAll(addresses, lengths);
+    }
+
+    ByteBuffer[] buffers = new ByteBuffer[size];
+    for (int i = 0; i < size; i++) {
+      buffers[i] = requests.get(i).buffer;
+    }
+    return key.fullMatch() ? pattern.matchAll(buffers) : pattern.findAll(buffers);
+  }
+
+  private enum InputKind {
+    STRING,
+    ADDRESS,
+    BUFFER
+  }
+
+  private record GroupKey(Pattern pattern, boolean fullMatch, InputKind kind) {}
+
+  private static final class Request {
+    final Pattern pattern;
+    final boolean fullMatch;
+    final String text;
+    final long address;
+    final int length;
+    final ByteBuffer buffer;
+    final CompletableFuture<Boolean> future = new CompletableFuture<>();
+
+    Request(
+        Pattern pattern,
+        boolean fullMatch,
+        String text,
+        long address,
+        int length,
+        ByteBuffer buffer) {
+      this.pattern = Objects.requireNonNull(pattern, "pattern cannot be null");
+      this.fullMatch = fullMatch;
+      this.text = text;
+      this.address = address;
+      this.length = length;
+      this.buffer = buffer;
+    }
+
+    GroupKey groupKey() {
+      InputKind kind =
+          text != null ? InputKind.STRING : buffer != null ? InputKind.BUFFER : InputKind.ADDRESS;
+      return new GroupKey(pattern, fullMatch, kind);
+    }
+  }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+/**
+ * Heap copy of a small pattern DFA that matches short Strings without a JNI call - the Java DFA
+ * tier behind {@link Matcher#matches()} and {@link Matcher#find()}.
+ *
+ * <p>The table is exported once per pattern from native code, byte-class compressed, and stepped
+ * over the same bytes RE2 sees for a String: its modified UTF-8 encoding, as produced by JNI's
+ * {@code GetStringUTFChars}. Results are therefore identical to the native path for every input.
+ * Immutable and thread-safe.
+ */
+final class CompactDfa {
+
+  /** Largest table (states × byte classes) worth copying to the heap: 64KB of transitions. */
+  static final int MAX_TABLE_ENTRIES = 1 << 14;
+
+  /** Marker for patterns whose DFA is unavailable or too large; never matched against. */
+  static final CompactDfa NONE = new CompactDfa(new int[0], new int[0], new boolean[0], 0, 0);
+
+  // Native layout: { stateCount, classes, anchorEnd, bytemap[256], match[states],
+  // next[states * classes] }
+  private static final int HEADER = 3 + 256;
+
+  // Row offsets below zero: no match is possible any more, or a match has been seen already
+  private static final int DEAD = -1;
+  private static final int MATCHED = -2;
+
+  private final int[] byteClass;
+  private final int[] next;
+  private final boolean[] acceptAtEnd;
+  private final int classes;
+  private final int start;
+
+  private CompactDfa(int[] byteClass, int[] next, boolean[] acceptAtEnd, int classes, int start) {
+    this.byteClass = byteClass;
+    this.next = next;
+    this.acceptAtEnd = acceptAtEnd;
+    this.classes = classes;
+    this.start = start;
+  }
+
+  /**
+   * Builds the Java tier from the native table.
+   *
+   * <p>States become row offsets into {@code next} so a step is one add and two loads. As in
+   * sorted batch matching, a partial match seen mid-input is final unless the pattern ends with
+   * {@code $}: transitions into such states become {@code MATCHED} and stop the scan.
+   *
+   * @param packed native table, non-empty
+   * @param fullMatch true if packed is the full-match DFA
+   */
+  static CompactDfa fromNative(int[] packed, boolean fullMatch) {
+    if (packed.length < HEADER) {
+      throw new NativeLibraryException("Compact DFA table too short: " + packed.length);
+    }
+    int stateCount = packed[0];
+    int classes = packed[1];
+    boolean anchorEnd = packed[2] != 0;
+    long expected = HEADER + stateCount + (long) stateCount * classes;
+    if (stateCount <= 0 || classes < 2 || packed.length != expected) {
+      throw new NativeLibraryException(
+          "Compact DFA table length "
+              + packed.length
+              + " does not match "
+              + stateCount
+              + " states");
+    }
+
+    int[] byteClass = new int[256];
+    System.arraycopy(packed, 3, byteClass, 0, 256);
+    int matchBase = HEADER;
+    int nextBase = HEADER + stateCount;
+    boolean latch = !fullMatch && !anchorEnd;
+
+    int[] next = new int[stateCount * classes];
+    boolean[] acceptAtEnd = new boolean[stateCount];
+    for (int s = 0; s < stateCount; s++) {
+      int end = packed[nextBase + s * classes + classes - 1];
+      acceptAtEnd[s] = end >= 0 && packed[matchBase + end] != 0;
+      for (int c = 0; c < classes; c++) {
+        int target = packed[nextBase + s * classes + c];
+        if (target < 0) {
+          next[s * classes + c] = DEAD;
+        } else if (latch && packed[matchBase + target] != 0) {
+          next[s * classes + c] = MATCHED;
+        } else {
+          next[s * classes + c] = target * classes;
+        }
+      }
+    }
+    int start = latch && packed[matchBase] != 0 ? MATCHED : 0;
+    return new CompactDfa(byteClass, next, acceptAtEnd, classes, start);
+  }
+
+  /**
+   * Matches a String with the semantics of the table (full or partial match).
+   *
+   * @param input input, any length (callers keep it short)
+   * @return true if the input matches
+   */
+  boolean matches(String input) {
+    int row = start;
+    for (int i = 0, n = input.length(); i < n && row >= 0; i++) {
+      char c = input.charAt(i);
+      if (c < 0x80 && c != 0) {
+        row = next[row + byteClass[c]];
+      } else {
+        row = stepMultiByte(row, c);
+      }
+    }
+    return row == MATCHED || (row >= 0 && acceptAtEnd[row / classes]);
+  }
+
+  /**
+   * Steps the modified UTF-8 bytes of one char: NUL as two bytes, surrogates encoded one char at
+   * a time, exactly as {@code GetStringUTFChars} hands Strings to RE2.
+   */
+  private int stepMultiByte(int row, char c) {
+    if (c < 0x800) {
+      row = step(row, 0xC0 | (c >> 6));
+    } else {
+      row = step(row, 0xE0 | (c >> 12));
+      row = step(row, 0x80 | ((c >> 6) & 0x3F));
+    }
+    return step(row, 0x80 | (c & 0x3F));
+  }
+
+  private int step(int row, int b) {
+    return row < 0 ? row : next[row + byteClass[b]];
+  }
+
+  /**
+   * Gets the number of states in the table.
+   *
+   * @return state count, 0 for {@link #NONE}
+   */
+  int stateCount() {
+    return acceptAtEnd.length;
+  }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+
+/**
+ * Builds compact DFAs for the Java DFA tier off the matching thread.
+ *
+ * <p>Exporting a pattern's DFA flood-fills its whole automaton, which can take milliseconds. The
+ * first short-input match only schedules the build here and matches natively; later matches use
+ * the compact DFA once it is ready. Builds run on a single background daemon thread, each holding
+ * a reference to its pattern so the native RE2 cannot be freed underneath it.
+ */
+final class CompactDfaBuilder {
+  private static volatile boolean started;
+
+  private CompactDfaBuilder() {
+    // Utility class
+  }
+
+  /** Started on first use so programs that never take the Java DFA tier pay nothing. */
+  private static final class Worker {
+    static final ExecutorService EXECUTOR =
+        Executors.newSingleThreadExecutor(
+            r -> {
+              Thread t = new Thread(r, "RE2-Compact-DFA-Builder");
+              t.setDaemon(true);
+              t.setPriority(Thread.MIN_PRIORITY);
+              return t;
+            });
+  }
+
+  /** Schedules the build of a pattern's compact DFA for full or partial matching. */
+  static void submit(Pattern pattern, boolean fullMatch) {
+    started = true;
+    Worker.EXECUTOR.execute(() -> build(pattern, fullMatch));
+  }
+
+  private static void build(Pattern pattern, boolean fullMatch) {
+    try {
+      pattern.incrementRefCount();
+    } catch (IllegalStateException e) {
+      return; // Closed meanwhile
+    } catch (ResourceException e) {
+      pattern.compactDfaBuildSkipped(fullMatch); // At its reference limit - retried on next use
+      return;
+    }
+    try {
+      pattern.compactDfa(fullMatch);
+    } catch (IllegalStateException e) {
+      // Closed while queued - nothing left to match with it
+    } finally {
+      pattern.decrementRefCount();
+    }
+  }
+
+  /** Waits until every build scheduled so far has run (for testing). */
+  static void drain() {
+    if (!started) {
+      return;
+    }
+    try {
+      Worker.EXECUTOR.submit(() -> {}).get();
+    } catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+    } catch (ExecutionException e) {
+      throw new IllegalStateException("RE2: Compact DFA builder failed", e.getCause());
+    }
+  }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.nio.ByteBuffer;
+import sun.nio.ch.DirectBuffer;
+
+/**
+ * Address/length view of a {@link ByteBuffer} batch for the zero-copy bulk natives.
+ *
+ * <p>Each element is routed by type: direct buffers are passed by address (position to limit),
+ * heap buffers are copied back to back into one direct scratch buffer and passed by their address
+ * in it. A mixed batch therefore still costs one native call and one copy of the heap bytes only,
+ * instead of decoding every buffer into a String. Null buffers map to address 0, which the natives
+ * treat as "no match".
+ *
+ * <p>The scratch buffer is thread-local and reused while it stays under {@link
+ * #MAX_RETAINED_SCRATCH_BYTES}. The batch is only valid until the next {@link #of} call on the same
+ * thread, and the caller must keep it reachable until the native call returns.
+ */
+final class DirectBatch {
+
+  /** Largest scratch buffer kept per thread; bigger heap batches get a one-off buffer. */
+  static final int MAX_RETAINED_SCRATCH_BYTES = 1 << 20;
+
+  private static final ThreadLocal<ByteBuffer> SCRATCH = new ThreadLocal<>();
+
+  final long[] addresses;
+  final int[] lengths;
+  final int heapBuffers;
+
+  // Keeps the heap copy alive for the duration of the native call
+  private final ByteBuffer scratch;
+
+  private DirectBatch(long[] addresses, int[] lengths, int heapBuffers, ByteBuffer scratch) {
+    this.addresses = addresses;
+    this.lengths = lengths;
+    this.heapBuffers = heapBuffers;
+    this.scratch = scratch;
+  }
+
+  static DirectBatch of(ByteBuffer[] buffers) {
+    long[] addresses = new long[buffers.length];
+    int[] lengths = new int[buffers.length];
+    int heapBuffers = 0;
+    long heapBytes = 0;
+
+    for (int i = 0; i < buffers.length; i++) {
+      ByteBuffer buffer = buffers[i];
+      if (buffer == null) {
+        continue;
+      }
+      lengths[i] = buffer.remaining();
+      if (buffer.isDirect()) {
+        addresses[i] = ((DirectBuffer) buffer).address() + buffer.position();
+      } else {
+        heapBuffers++;
+        heapBytes += lengths[i];
+      }
+    }
+
+    if (heapBuffers == 0) {
+      return new DirectBatch(addresses, lengths, 0, null);
+    }
+    if (heapBytes > Integer.MAX_VALUE) {
+      throw new IllegalArgumentException("Heap buffers in batch too large to copy: " + heapBytes);
+    }
+
+    ByteBuffer scratch = scratch((int) heapBytes);
+    long base = ((DirectBuffer) scratch).address();
+    for (int i = 0; i < buffers.length; i++) {
+      ByteBuffer buffer = buffers[i];
+      if (buffer != null && !buffer.isDirect()) {
+        addresses[i] = base + scratch.position();
+        scratch.put(buffer.duplicate());
+      }
+    }
+    return new DirectBatch(addresses, lengths, heapBuffers, scratch);
+  }
+
+  int size() {
+    return addresses.length;
+  }
+
+  private static ByteBuffer scratch(int bytes) {
+    if (bytes > MAX_RETAINED_SCRATCH_BYTES) {
+      return ByteBuffer.allocateDirect(bytes);
+    }
+    ByteBuffer scratch = SCRATCH.get();
+    if (scratch == null || scratch.capacity() < bytes) {
+      // Round up so a slowly growing batch size does not reallocate every call
+      int capacity = Integer.highestOneBit(Math.max(bytes, 256) - 1) << 1;
+      scratch = ByteBuffer.allocateDirect(Math.min(capacity, MAX_RETAINED_SCRATCH_BYTES));
+      SCRATCH.set(scratch);
+    }
+    scratch.clear();
+    return scratch;
+  }
+}
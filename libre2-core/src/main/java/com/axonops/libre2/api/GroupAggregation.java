@@ -0,0 +1,239 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.OptionalLong;
+
+/**
+ * Rows counted by captured key - returned by {@link Pattern#aggregate(String[], int, int)} and its
+ * zero-copy variants.
+ *
+ * <p>Aggregation runs natively: each row is matched, the key group's bytes are hashed into a
+ * native table, and only the distinct keys are converted to Java Strings. An optional value group
+ * is parsed as a base-10 integer and summarised per key (sum, min, max); rows whose value does not
+ * parse are still counted but excluded from the value statistics.
+ *
+ * <pre>{@code
+ * Pattern p = Pattern.compile("\"(GET|POST|PUT) [^\"]*\" (\\d{3}) (\\d+)");
+ * GroupAggregation byStatus = p.aggregate(logLines, 2, 3);
+ * byStatus.count("404");   // rows with status 404
+ * byStatus.sum("200");     // bytes served with status 200
+ * }</pre>
+ *
+ * <p>Keys are kept in first-seen order. Immutable and thread-safe.
+ *
+ * @since 1.3.0
+ */
+public final class GroupAggregation {
+
+  /** Value group argument meaning "count only". */
+  public static final int NO_VALUE_GROUP = -1;
+
+  // Layout of the native stats array - keep in sync with aggregation_result() in re2_jni.cpp
+  private static final int STATS_HEADER = 1;
+  private static final int STATS_STRIDE = 5;
+  private static final int COUNT = 0;
+  private static final int VALUE_COUNT = 1;
+  private static final int SUM = 2;
+  private static final int MIN = 3;
+  private static final int MAX = 4;
+
+  static final GroupAggregation EMPTY = new GroupAggregation(new String[0], new long[STATS_HEADER]);
+
+  private final String[] keys;
+  private final long[] stats;
+  private final Map<String, Integer> index;
+
+  private GroupAggregation(String[] keys, long[] stats) {
+    this.keys = keys;
+    this.stats = stats;
+    this.index = new HashMap<>(keys.length * 2);
+    for (int i = 0; i < keys.length; i++) {
+      index.put(keys[i], i);
+    }
+  }
+
+  /** Builds an aggregation from the native {@code Object[] { String[] keys, long[] stats }}. */
+  static GroupAggregation fromNative(Object[] result) {
+    if (result == null || result.length != 2) {
+      throw new NativeLibraryException("Malformed aggregation result");
+    }
+    String[] keys = (String[]) result[0];
+    long[] stats = (long[]) result[1];
+    if (stats.length != STATS_HEADER + keys.length * STATS_STRIDE) {
+      throw new NativeLibraryException(
+          "Aggregation stats length " + stats.length + " does not match " + keys.length + " keys");
+    }
+    return new GroupAggregation(keys, stats);
+  }
+
+  /**
+   * Gets the number of distinct keys.
+   *
+   * @return distinct key count
+   */
+  public int size() {
+    return keys.length;
+  }
+
+  /**
+   * Gets the distinct keys in first-seen order.
+   *
+   * @return unmodifiable list of keys
+   */
+  public List<String> keys() {
+    return Collections.unmodifiableList(Arrays.asList(keys));
+  }
+
+  /**
+   * Gets the number of rows with the given key.
+   *
+   * @param key captured key
+   * @return row count, 0 if the key was never seen
+   */
+  public long count(String key) {
+    return stat(key, COUNT, 0);
+  }
+
+  /**
+   * Gets the number of rows with the given key whose value group parsed as an integer.
+   *
+   * @param key captured key
+   * @return rows contributing to {@link #sum}, {@link #min} and {@link #max}
+   */
+  public long valueCount(String key) {
+    return stat(key, VALUE_COUNT, 0);
+  }
+
+  /**
+   * Gets the sum of the value group over rows with the given key.
+   *
+   * <p>Overflow wraps around, as with Java {@code long} arithmetic.
+   *
+   * @param key captured key
+   * @return sum, 0 if no values were aggregated for the key
+   */
+  public long sum(String key) {
+    return stat(key, SUM, 0);
+  }
+
+  /**
+   * Gets the minimum of the value group over rows with the given key.
+   *
+   * @param key captured key
+   * @return minimum, empty if no values were aggregated for the key
+   */
+  public OptionalLong min(String key) {
+    return valueCount(key) > 0 ? OptionalLong.of(stat(key, MIN, 0)) : OptionalLong.empty();
+  }
+
+  /**
+   * Gets the maximum of the value group over rows with the given key.
+   *
+   * @param key captured key
+   * @return maximum, empty if no values were aggregated for the key
+   */
+  public OptionalLong max(String key) {
+    return valueCount(key) > 0 ? OptionalLong.of(stat(key, MAX, 0)) : OptionalLong.empty();
+  }
+
+  /**
+   * Gets the row count per key.
+   *
+   * @return unmodifiable map of key to count, in first-seen order
+   */
+  public Map<String, Long> counts() {
+    Map<String, Long> counts = new LinkedHashMap<>(keys.length * 2);
+    for (int i = 0; i < keys.length; i++) {
+      counts.put(keys[i], stats[offset(i) + COUNT]);
+    }
+    return Collections.unmodifiableMap(counts);
+  }
+
+  /**
+   * Gets the keys with the highest row counts.
+   *
+   * @param n maximum number of keys to return
+   * @return up to {@code n} keys, highest count first (ties in first-seen order)
+   * @throws IllegalArgumentException if n is negative
+   */
+  public List<String> topKeys(int n) {
+    if (n < 0) {
+      throw new IllegalArgumentException("n must not be negative: " + n);
+    }
+    List<Integer> order = new ArrayList<>(keys.length);
+    for (int i = 0; i < keys.length; i++) {
+      order.add(i);
+    }
+    order.sort(Comparator.comparingLong((Integer i) -> stats[offset(i) + COUNT]).reversed());
+    List<String> top = new ArrayList<>(Math.min(n, keys.length));
+    for (int i = 0; i < order.size() && i < n; i++) {
+      top.add(keys[order.get(i)]);
+    }
+    return top;
+  }
+
+  /**
+   * Gets the number of rows that were aggregated (matched, with the key group participating).
+   *
+   * @return matched rows
+   */
+  public long matchedRows() {
+    long total = 0;
+    for (int i = 0; i < keys.length; i++) {
+      total += stats[offset(i) + COUNT];
+    }
+    return total;
+  }
+
+  /**
+   * Gets the number of rows that did not match, or matched without the key group participating.
+   *
+   * @return unmatched rows
+   */
+  public long unmatchedRows() {
+    return stats[0];
+  }
+
+  @Override
+  public String toString() {
+    return "GroupAggregation{keys="
+        + keys.length
+        + ", matched="
+        + matchedRows()
+        + ", unmatched="
+        + unmatchedRows()
+        + "}";
+  }
+
+  private long stat(String key, int field, long absent) {
+    Integer i = index.get(key);
+    return i == null ? absent : stats[offset(i) + field];
+  }
+
+  private static int offset(int keyIndex) {
+    return STATS_HEADER + keyIndex * STATS_STRIDE;
+  }
+}
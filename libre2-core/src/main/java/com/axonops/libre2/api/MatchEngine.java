@@ -0,0 +1,37 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+/**
+ * Engines a {@link Pattern} can answer match/no-match queries ({@code matches}, {@code find},
+ * {@code matchAll}, {@code findAll}) with. All of them return identical results; they differ in
+ * cost only.
+ *
+ * @see Pattern#matchEngine()
+ * @see Pattern#calibrateEngines()
+ * @since 1.3.0
+ */
+public enum MatchEngine {
+  /** RE2's own search - lazily built DFA behind a per-pattern cache lock; always available. */
+  RE2,
+  /** Heap copy of a small DFA stepped in Java for short Strings, without a JNI call. */
+  JAVA_DFA,
+  /** Immutable native DFA tables built by {@link Pattern#freezeDfa()}; no locking. */
+  FROZEN_DFA,
+  /** Bit-parallel NFA built by {@link Pattern#freezeBitParallel()}; no state cache. */
+  BIT_PARALLEL
+}
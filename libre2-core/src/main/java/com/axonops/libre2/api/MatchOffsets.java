@@ -0,0 +1,201 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.Objects;
+
+/**
+ * Capture group offsets for every match in a batch of zero-copy inputs - returned by {@link
+ * Pattern#findAllMatches(long[], int[])}, {@link Pattern#extractGroups(long[], int[])} and their
+ * packed and {@link ByteBuffer} variants.
+ *
+ * <p>The whole batch is one JNI call returning one {@code int[]}: a match count per input, then a
+ * start/end byte offset pair per group for each match. Offsets are relative to the start of each
+ * input (its address, or the buffer's position). Groups that did not participate report {@code
+ * -1}.
+ *
+ * <pre>{@code
+ * MatchOffsets hits = pattern.findAllMatches(documentBuffers);
+ * for (int doc = 0; doc < hits.inputCount(); doc++) {
+ *     for (int m = 0; m < hits.matchCount(doc); m++) {
+ *         String user = hits.group(doc, m, 1);
+ *     }
+ * }
+ * }</pre>
+ *
+ * <p>Groups can only be read as Strings when the inputs were {@link ByteBuffer}s ({@link
+ * #hasText()}); for raw addresses use the offsets against the source memory. Immutable and
+ * thread-safe, provided the source buffers are not modified.
+ *
+ * @since 1.3.0
+ */
+public final class MatchOffsets {
+
+  private final ByteBuffer[] sources;
+  private final int[] packed;
+  private final int[] firstMatch;
+  private final int groupCount;
+
+  private MatchOffsets(ByteBuffer[] sources, int[] packed, int[] firstMatch, int groupCount) {
+    this.sources = sources;
+    this.packed = packed;
+    this.firstMatch = firstMatch;
+    this.groupCount = groupCount;
+  }
+
+  /**
+   * Builds a result from the native layout {@code { matchCount per input, group offsets, ... }}.
+   *
+   * @param packed native result
+   * @param inputCount number of inputs searched
+   * @param groupCount number of capturing groups in the pattern
+   * @param sources the inputs as buffers (read from their position), or null for raw addresses
+   */
+  static MatchOffsets fromNative(
+      int[] packed, int inputCount, int groupCount, ByteBuffer[] sources) {
+    if (packed.length < inputCount) {
+      throw new NativeLibraryException(
+          "Match offsets have " + packed.length + " entries for " + inputCount + " inputs");
+    }
+    int[] firstMatch = new int[inputCount + 1];
+    for (int i = 0; i < inputCount; i++) {
+      firstMatch[i + 1] = firstMatch[i] + packed[i];
+    }
+    long expected = inputCount + 2L * (groupCount + 1) * firstMatch[inputCount];
+    if (packed.length != expected) {
+      throw new NativeLibraryException(
+          "Match offsets length " + packed.length + " does not match its match counts");
+    }
+    return new MatchOffsets(sources, packed, firstMatch, groupCount);
+  }
+
+  /**
+   * Gets the number of inputs searched.
+   *
+   * @return input count
+   */
+  public int inputCount() {
+    return firstMatch.length - 1;
+  }
+
+  /**
+   * Gets the number of capturing groups (group 0, the whole match, is not counted).
+   *
+   * @return capturing group count
+   */
+  public int groupCount() {
+    return groupCount;
+  }
+
+  /**
+   * Gets the number of matches in an input.
+   *
+   * @param input input index
+   * @return match count (0 or 1 for extract results)
+   */
+  public int matchCount(int input) {
+    Objects.checkIndex(input, inputCount());
+    return firstMatch[input + 1] - firstMatch[input];
+  }
+
+  /**
+   * Gets the number of matches across all inputs.
+   *
+   * @return total match count
+   */
+  public int totalMatches() {
+    return firstMatch[inputCount()];
+  }
+
+  /**
+   * Gets the start byte offset of a group (inclusive).
+   *
+   * @param input input index
+   * @param match match index within the input
+   * @param group group index (0 = whole match)
+   * @return start offset, or -1 if the group did not participate
+   */
+  public int start(int input, int match, int group) {
+    return packed[offset(input, match, group)];
+  }
+
+  /**
+   * Gets the end byte offset of a group (exclusive).
+   *
+   * @param input input index
+   * @param match match index within the input
+   * @param group group index (0 = whole match)
+   * @return end offset, or -1 if the group did not participate
+   */
+  public int end(int input, int match, int group) {
+    return packed[offset(input, match, group) + 1];
+  }
+
+  /**
+   * Whether groups can be read as Strings (the inputs were buffers).
+   *
+   * @return true for buffer inputs, false for raw addresses
+   */
+  public boolean hasText() {
+    return sources != null;
+  }
+
+  /**
+   * Decodes a group as a UTF-8 String, created on demand.
+   *
+   * @param input input index
+   * @param match match index within the input
+   * @param group group index (0 = whole match)
+   * @return the group text, or null if the group did not participate
+   * @throws IndexOutOfBoundsException if an index is out of range
+   * @throws IllegalStateException if the inputs were raw addresses ({@link #hasText()} is false)
+   */
+  public String group(int input, int match, int group) {
+    int offset = offset(input, match, group);
+    if (sources == null) {
+      throw new IllegalStateException(
+          "Match offsets over raw addresses hold byte offsets only - read from the source memory");
+    }
+    int start = packed[offset];
+    if (start < 0) {
+      return null;
+    }
+    ByteBuffer source = sources[input];
+    byte[] bytes = new byte[packed[offset + 1] - start];
+    source.get(source.position() + start, bytes);
+    return new String(bytes, StandardCharsets.UTF_8);
+  }
+
+  @Override
+  public String toString() {
+    return "MatchOffsets{inputs="
+        + inputCount()
+        + ", matches="
+        + totalMatches()
+        + ", groups="
+        + groupCount
+        + "}";
+  }
+
+  private int offset(int input, int match, int group) {
+    Objects.checkIndex(match, matchCount(input));
+    Objects.checkIndex(group, groupCount + 1);
+    return inputCount() + 2 * ((firstMatch[input] + match) * (groupCount + 1) + group);
+  }
+}
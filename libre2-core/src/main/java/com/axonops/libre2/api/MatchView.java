@@ -0,0 +1,177 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.Objects;
+
+/**
+ * Reusable flyweight over match results in a per-thread off-heap arena - returned by {@link
+ * Pattern#findAllMatchesView(ByteBuffer)}, {@link Pattern#extractGroupsView(ByteBuffer)} and their
+ * String and address variants.
+ *
+ * <p>Native code writes every group offset straight into the calling thread's arena and this view
+ * reads them in place: no {@code String[]}, no {@link MatchResult}, nothing to close. Each thread
+ * has exactly one view, so the next view call on the same thread overwrites it. Consume the
+ * results immediately and do not keep the view or pass it to another thread.
+ *
+ * <pre>{@code
+ * for (ByteBuffer line : lines) {
+ *     MatchView view = pattern.findAllMatchesView(line);
+ *     for (int m = 0; m < view.matchCount(); m++) {
+ *         index(line, view.start(m, 1), view.end(m, 1));
+ *     }
+ * }
+ * }</pre>
+ *
+ * <p>Offsets are UTF-8 byte offsets relative to the start of the input (its address, the buffer's
+ * position, or the start of the String's UTF-8 encoding). Groups that did not participate report
+ * -1.
+ *
+ * @since 1.3.0
+ */
+public final class MatchView {
+
+  // Arena header - keep in sync with ArenaHeader in re2_jni.cpp
+  static final int MATCH_COUNT = 0;
+  static final int GROUPS_PER_MATCH = 1;
+  static final int REQUIRED_INTS = 2;
+  static final int HEADER_INTS = 3;
+
+  private ByteBuffer results;
+  private int matchCount;
+  private int groupsPerMatch;
+  private ByteBuffer source;
+  private int sourceOffset;
+
+  MatchView() {}
+
+  /** Points the view at results just written by native code. */
+  MatchView reset(ByteBuffer results, ByteBuffer source, int sourceOffset) {
+    this.results = results;
+    this.matchCount = results.getInt(MATCH_COUNT * Integer.BYTES);
+    this.groupsPerMatch = results.getInt(GROUPS_PER_MATCH * Integer.BYTES);
+    this.source = source;
+    this.sourceOffset = sourceOffset;
+    return this;
+  }
+
+  /**
+   * Gets the number of matches.
+   *
+   * @return match count (0 or 1 for extract views)
+   */
+  public int matchCount() {
+    return matchCount;
+  }
+
+  /**
+   * Whether the pattern matched at least once.
+   *
+   * @return true if there is at least one match
+   */
+  public boolean found() {
+    return matchCount > 0;
+  }
+
+  /**
+   * Gets the number of capturing groups (group 0, the whole match, is not counted).
+   *
+   * @return capturing group count
+   */
+  public int groupCount() {
+    return groupsPerMatch - 1;
+  }
+
+  /**
+   * Gets the start byte offset of a group (inclusive).
+   *
+   * @param match match index
+   * @param group group index (0 = whole match)
+   * @return start offset, or -1 if the group did not participate
+   */
+  public int start(int match, int group) {
+    return results.getInt(offset(match, group) * Integer.BYTES);
+  }
+
+  /**
+   * Gets the end byte offset of a group (exclusive).
+   *
+   * @param match match index
+   * @param group group index (0 = whole match)
+   * @return end offset, or -1 if the group did not participate
+   */
+  public int end(int match, int group) {
+    return results.getInt((offset(match, group) + 1) * Integer.BYTES);
+  }
+
+  /**
+   * Gets the byte length of a group.
+   *
+   * @param match match index
+   * @param group group index (0 = whole match)
+   * @return length in bytes, or -1 if the group did not participate
+   */
+  public int length(int match, int group) {
+    int start = start(match, group);
+    return start < 0 ? -1 : end(match, group) - start;
+  }
+
+  /**
+   * Whether groups can be decoded as Strings (the input was a String or a buffer).
+   *
+   * @return false for raw address inputs
+   */
+  public boolean hasText() {
+    return source != null;
+  }
+
+  /**
+   * Decodes a group as a UTF-8 String. This allocates the String; use offsets on hot paths.
+   *
+   * @param match match index
+   * @param group group index (0 = whole match)
+   * @return the group text, or null if the group did not participate
+   * @throws IndexOutOfBoundsException if an index is out of range
+   * @throws IllegalStateException if the input was a raw address ({@link #hasText()} is false)
+   */
+  public String group(int match, int group) {
+    int start = start(match, group);
+    if (source == null) {
+      throw new IllegalStateException(
+          "Match view over a raw address holds byte offsets only - read from the source memory");
+    }
+    if (start < 0) {
+      return null;
+    }
+    byte[] bytes = new byte[end(match, group) - start];
+    source.get(sourceOffset + start, bytes);
+    return new String(bytes, StandardCharsets.UTF_8);
+  }
+
+  @Override
+  public String toString() {
+    return "MatchView{matches=" + matchCount + ", groups=" + groupCount() + "}";
+  }
+
+  private int offset(int match, int group) {
+    Objects.checkIndex(match, matchCount);
+    Objects.checkIndex(group, groupsPerMatch);
+    return HEADER_INTS + 2 * (match * groupsPerMatch + group);
+  }
+}
@@ -77,11 +77,16 @@ public final class Matcher implements AutoCloseable {
 
     long startNanos = System.nanoTime();
 
-    boolean result = pattern.jni.fullMatch(pattern.getNativeHandle(), input);
+    boolean result = pattern.matchString(input, true, metrics);
 
     long durationNanos = System.nanoTime() - startNanos;
     metrics.recordTimer(MetricNames.MATCHING_FULL_MATCH_LATENCY, durationNanos);
     metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS);
+    pattern.recordMatchingInput(
+        metrics,
+        MetricNames.MATCHING_STRING_BYTES,
+        MetricNames.MATCHING_STRING_INPUT_LENGTH,
+        input.length());
 
     return result;
   }
@@ -96,11 +101,16 @@ public final class Matcher implements AutoCloseable {
 
     long startNanos = System.nanoTime();
 
-    boolean result = pattern.jni.partialMatch(pattern.getNativeHandle(), input);
+    boolean result = pattern.matchString(input, false, metrics);
 
     long durationNanos = System.nanoTime() - startNanos;
     metrics.recordTimer(MetricNames.MATCHING_PARTIAL_MATCH_LATENCY, durationNanos);
     metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS);
+    pattern.recordMatchingInput(
+        metrics,
+        MetricNames.MATCHING_STRING_BYTES,
+        MetricNames.MATCHING_STRING_INPUT_LENGTH,
+        input.length());
 
     return result;
   }
@@ -23,12 +23,19 @@ import com.axonops.libre2.jni.RE2LibraryLoader;
 import com.axonops.libre2.jni.RE2Native;
 import com.axonops.libre2.metrics.MetricNames;
 import com.axonops.libre2.metrics.RE2MetricsRegistry;
+import com.axonops.libre2.metrics.ThroughputMeter;
 import com.axonops.libre2.util.PatternHasher;
 import java.nio.ByteBuffer;
 import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.BitSet;
 import java.util.Collections;
+import java.util.List;
 import java.util.Map;
 import java.util.Objects;
+import java.util.Optional;
+import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.atomic.AtomicBoolean;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
@@ -73,6 +80,80 @@ public final class Pattern implements AutoCloseable {
       new java.util.concurrent.atomic.AtomicInteger(0);
   private static final int maxMatchersPerPattern = RE2Config.DEFAULT.maxMatchersPerPattern();
   private final long nativeMemoryBytes;
+  private final long maxMemBytes;
+
+  // Completed once the native pattern has been freed (closed and no longer referenced)
+  private final CompletableFuture<Void> released = new CompletableFuture<>();
+
+  // Java DFA tier for short Strings, exported on first use (CompactDfa.NONE if unavailable)
+  private volatile CompactDfa fullMatchDfa;
+  private volatile CompactDfa partialMatchDfa;
+  private final AtomicBoolean fullMatchDfaScheduled = new AtomicBoolean(false);
+  private final AtomicBoolean partialMatchDfaScheduled = new AtomicBoolean(false);
+
+  // Frozen DFA tables (freezeDfa), 0 if not frozen; set and freed under this pattern's monitor
+  private volatile long frozenHandle;
+
+  // Bit-parallel NFA (freezeBitParallel), 0 if not built; same lifecycle as frozenHandle
+  private volatile long bitParallelHandle;
+
+  // Selected engine (calibrateEngines) and its frozen handle, 0 for RE2; set under the monitor
+  private volatile long matcherHandle;
+  private volatile MatchEngine matchEngine = MatchEngine.RE2;
+  private volatile boolean javaDfaTier = true;
+
+  // Recent short String inputs for calibration, kept only while a frozen engine exists and
+  // dropped once calibrated. Written without synchronization: a lost update only changes which
+  // inputs are kept.
+  private final String[] engineSamples = new String[ENGINE_SAMPLES];
+  private volatile boolean samplingEngines;
+  private int sampleTick;
+
+  // Written by calibration so the JIT cannot discard the timed Java DFA matches
+  @SuppressWarnings("unused")
+  private volatile boolean calibrationSink;
+
+  /**
+   * RE2's default memory budget (max_mem) for a compiled pattern: program plus DFA caches.
+   *
+   * @since 1.3.0
+   */
+  public static final long DEFAULT_MAX_MEM_BYTES = 8L << 20;
+
+  /**
+   * Largest DFA, in states, that {@link #freezeDfa()} freezes.
+   *
+   * @since 1.3.0
+   */
+  public static final int DEFAULT_FROZEN_DFA_MAX_STATES = 1024;
+
+  /**
+   * Longest mask byte pattern accepted by {@link #maskAll(long, int, byte[])}.
+   *
+   * @since 1.3.0
+   */
+  public static final int MAX_MASK_BYTES = 256;
+
+  // One-byte masks shared by the maskAll(..., byte) overloads, so they allocate nothing
+  private static final byte[][] SINGLE_BYTE_MASKS = new byte[256][];
+
+  static {
+    for (int b = 0; b < 256; b++) {
+      SINGLE_BYTE_MASKS[b] = new byte[] {(byte) b};
+    }
+  }
+
+  // Engine calibration: inputs kept (power of two), every how many String matches one is kept
+  // (power of two), longest input kept (chars), fewest kept inputs worth measuring, timed rounds
+  // per engine, and how much cheaper another engine must be to replace the selected one
+  static final int ENGINE_SAMPLES = 16;
+  static final int ENGINE_SAMPLE_INTERVAL = 64;
+  static final int ENGINE_SAMPLE_MAX_LENGTH = 1024;
+  static final int MIN_CALIBRATION_SAMPLES = 4;
+  private static final int CALIBRATION_ROUNDS = 5;
+  private static final int ENGINE_SWITCH_MARGIN_PERCENT = 20;
+  private static final List<MatchEngine> NATIVE_ENGINES =
+      List.of(MatchEngine.RE2, MatchEngine.FROZEN_DFA, MatchEngine.BIT_PARALLEL);
 
   // JniAdapter for all JNI calls - allows mocking in tests
   final IRE2Native jni;
@@ -87,11 +168,22 @@ public final class Pattern implements AutoCloseable {
       long nativeHandle,
       boolean fromCache,
       IRE2Native jni) {
+    this(patternString, caseSensitive, nativeHandle, fromCache, jni, DEFAULT_MAX_MEM_BYTES);
+  }
+
+  Pattern(
+      String patternString,
+      boolean caseSensitive,
+      long nativeHandle,
+      boolean fromCache,
+      IRE2Native jni,
+      long maxMemBytes) {
     this.patternString = Objects.requireNonNull(patternString);
     this.caseSensitive = caseSensitive;
     this.nativeHandle = nativeHandle;
     this.fromCache = fromCache;
     this.jni = jni;
+    this.maxMemBytes = maxMemBytes;
 
     // Query native memory size using adapter
     this.nativeMemoryBytes = jni.patternMemory(nativeHandle);
@@ -149,10 +241,53 @@ public final class Pattern implements AutoCloseable {
     return doCompile(pattern, caseSensitive, false, RE2Native.INSTANCE);
   }
 
+  /**
+   * Compiles a pattern without using the cache, with an explicit RE2 memory budget.
+   *
+   * <p>{@code maxMemBytes} bounds the compiled program plus its DFA caches (RE2 default: {@link
+   * #DEFAULT_MAX_MEM_BYTES}). Patterns whose DFA keeps exhausting its budget fall back to the much
+   * slower NFA - see {@link #getDfaFailureCount()}. A budget too small for the program itself fails
+   * compilation.
+   *
+   * <p>The returned pattern is NOT managed by the cache and MUST be closed.
+   *
+   * @param pattern regex pattern
+   * @param caseSensitive case sensitivity
+   * @param maxMemBytes RE2 max_mem budget in bytes (must be positive)
+   * @return uncached pattern (must close)
+   * @throws IllegalArgumentException if maxMemBytes is not positive
+   * @since 1.3.0
+   */
+  public static Pattern compileWithoutCache(
+      String pattern, boolean caseSensitive, long maxMemBytes) {
+    Objects.requireNonNull(pattern, "pattern cannot be null");
+    if (maxMemBytes <= 0) {
+      throw new IllegalArgumentException("maxMemBytes must be positive: " + maxMemBytes);
+    }
+    return doCompile(pattern, caseSensitive, false, RE2Native.INSTANCE, maxMemBytes);
+  }
+
   /** Compiles a pattern for caching (internal use). */
   private static Pattern compileUncached(String pattern, boolean caseSensitive) {
     // Compile with fromCache=true so users can't close it (cache manages it)
-    return doCompile(pattern, caseSensitive, true, RE2Native.INSTANCE);
+    // The cache picks max_mem: a small starting allowance under the global DFA memory budget
+    long maxMemBytes = cache.getDfaAdmissionMaxMemBytes();
+    if (maxMemBytes < DEFAULT_MAX_MEM_BYTES) {
+      try {
+        return doCompile(pattern, caseSensitive, true, RE2Native.INSTANCE, maxMemBytes);
+      } catch (PatternCompilationException e) {
+        if (!e.getMessage().contains("pattern too large")) {
+          throw e;
+        }
+        // Program alone doesn't fit the allowance - fall back to RE2's default
+        logger.debug(
+            "RE2: Pattern exceeds starting max_mem {}, compiling with default - hash: {}",
+            maxMemBytes,
+            PatternHasher.hash(pattern));
+        maxMemBytes = DEFAULT_MAX_MEM_BYTES;
+      }
+    }
+    return doCompile(pattern, caseSensitive, true, RE2Native.INSTANCE, maxMemBytes);
   }
 
   /**
@@ -166,6 +301,12 @@ public final class Pattern implements AutoCloseable {
   /** Actual compilation logic. */
   private static Pattern doCompile(
       String pattern, boolean caseSensitive, boolean fromCache, IRE2Native jni) {
+    return doCompile(pattern, caseSensitive, fromCache, jni, DEFAULT_MAX_MEM_BYTES);
+  }
+
+  /** Actual compilation logic with an explicit RE2 memory budget. */
+  private static Pattern doCompile(
+      String pattern, boolean caseSensitive, boolean fromCache, IRE2Native jni, long maxMemBytes) {
     RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
     String hash = PatternHasher.hash(pattern);
 
@@ -185,7 +326,10 @@ public final class Pattern implements AutoCloseable {
     boolean compilationSuccessful = false;
 
     try {
-      handle = jni.compile(pattern, caseSensitive);
+      handle =
+          maxMemBytes == DEFAULT_MAX_MEM_BYTES
+              ? jni.compile(pattern, caseSensitive)
+              : jni.compileWithMaxMem(pattern, caseSensitive, maxMemBytes);
 
       if (handle == 0 || !jni.patternOk(handle)) {
         String error = jni.getError();
@@ -202,10 +346,11 @@ public final class Pattern implements AutoCloseable {
       metrics.recordTimer(MetricNames.PATTERNS_COMPILATION_LATENCY, durationNanos);
       metrics.incrementCounter(MetricNames.PATTERNS_COMPILED);
 
-      Pattern compiled = new Pattern(pattern, caseSensitive, handle, fromCache, jni);
+      Pattern compiled = new Pattern(pattern, caseSensitive, handle, fromCache, jni, maxMemBytes);
       logger.trace(
-          "RE2: Pattern compiled - hash: {}, length: {}, caseSensitive: {}, fromCache: {}, nativeBytes: {}, timeNs: {}",
+          "RE2: Pattern compiled - hash: {}, handle: {}, length: {}, caseSensitive: {}, fromCache: {}, nativeBytes: {}, timeNs: {}",
           hash,
+          handle,
           pattern.length(),
           caseSensitive,
           fromCache,
@@ -314,7 +459,11 @@ public final class Pattern implements AutoCloseable {
     }
 
     long startNanos = System.nanoTime();
-    boolean result = jni.fullMatchDirect(nativeHandle, address, length);
+    long frozen = frozenMatcher();
+    boolean result =
+        frozen != 0
+            ? jni.frozenMatchDirect(nativeHandle, frozen, address, length, true)
+            : jni.fullMatchDirect(nativeHandle, address, length);
     long durationNanos = System.nanoTime() - startNanos;
 
     // Track metrics - GLOBAL (ALL) + SPECIFIC (Zero-Copy)
@@ -328,6 +477,11 @@ public final class Pattern implements AutoCloseable {
     // Specific zero-copy metrics
     metrics.incrementCounter(MetricNames.MATCHING_ZERO_COPY_OPERATIONS);
     metrics.recordTimer(MetricNames.MATCHING_ZERO_COPY_LATENCY, durationNanos);
+    recordMatchingInput(
+        metrics,
+        MetricNames.MATCHING_ZERO_COPY_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_INPUT_LENGTH,
+        length);
 
     return result;
   }
@@ -378,7 +532,11 @@ public final class Pattern implements AutoCloseable {
     }
 
     long startNanos = System.nanoTime();
-    boolean result = jni.partialMatchDirect(nativeHandle, address, length);
+    long frozen = frozenMatcher();
+    boolean result =
+        frozen != 0
+            ? jni.frozenMatchDirect(nativeHandle, frozen, address, length, false)
+            : jni.partialMatchDirect(nativeHandle, address, length);
     long durationNanos = System.nanoTime() - startNanos;
 
     // Track metrics - GLOBAL (ALL) + SPECIFIC (Zero-Copy)
@@ -392,6 +550,11 @@ public final class Pattern implements AutoCloseable {
     // Specific zero-copy metrics
     metrics.incrementCounter(MetricNames.MATCHING_ZERO_COPY_OPERATIONS);
     metrics.recordTimer(MetricNames.MATCHING_ZERO_COPY_LATENCY, durationNanos);
+    recordMatchingInput(
+        metrics,
+        MetricNames.MATCHING_ZERO_COPY_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_INPUT_LENGTH,
+        length);
 
     return result;
   }
@@ -460,6 +623,11 @@ public final class Pattern implements AutoCloseable {
       // Specific String capture metrics
       metrics.incrementCounter(MetricNames.CAPTURE_STRING_OPERATIONS);
       metrics.recordTimer(MetricNames.CAPTURE_STRING_LATENCY, durationNanos);
+      recordCaptureInput(
+          metrics,
+          MetricNames.CAPTURE_STRING_BYTES,
+          MetricNames.CAPTURE_STRING_INPUT_LENGTH,
+          input.length());
 
       return new MatchResult(input);
     }
@@ -478,6 +646,11 @@ public final class Pattern implements AutoCloseable {
       // Specific String capture metrics
       metrics.incrementCounter(MetricNames.CAPTURE_STRING_OPERATIONS);
       metrics.recordTimer(MetricNames.CAPTURE_STRING_LATENCY, durationNanos);
+      recordCaptureInput(
+          metrics,
+          MetricNames.CAPTURE_STRING_BYTES,
+          MetricNames.CAPTURE_STRING_INPUT_LENGTH,
+          input.length());
 
       return new MatchResult(input);
     }
@@ -494,6 +667,11 @@ public final class Pattern implements AutoCloseable {
     // Specific String capture metrics
     metrics.incrementCounter(MetricNames.CAPTURE_STRING_OPERATIONS);
     metrics.recordTimer(MetricNames.CAPTURE_STRING_LATENCY, durationNanos);
+    recordCaptureInput(
+        metrics,
+        MetricNames.CAPTURE_STRING_BYTES,
+        MetricNames.CAPTURE_STRING_INPUT_LENGTH,
+        input.length());
 
     // Lazy-load named groups only if needed
     Map<String, Integer> namedGroupMap = getNamedGroupsMap();
@@ -550,6 +728,11 @@ public final class Pattern implements AutoCloseable {
     // Specific String capture metrics
     metrics.incrementCounter(MetricNames.CAPTURE_STRING_OPERATIONS);
     metrics.recordTimer(MetricNames.CAPTURE_STRING_LATENCY, durationNanos);
+    recordCaptureInput(
+        metrics,
+        MetricNames.CAPTURE_STRING_BYTES,
+        MetricNames.CAPTURE_STRING_INPUT_LENGTH,
+        input.length());
 
     if (groups == null) {
       return new MatchResult(input);
@@ -622,6 +805,11 @@ public final class Pattern implements AutoCloseable {
     // Specific String capture metrics
     metrics.incrementCounter(MetricNames.CAPTURE_STRING_OPERATIONS);
     metrics.recordTimer(MetricNames.CAPTURE_STRING_LATENCY, durationNanos);
+    recordCaptureInput(
+        metrics,
+        MetricNames.CAPTURE_STRING_BYTES,
+        MetricNames.CAPTURE_STRING_INPUT_LENGTH,
+        input.length());
 
     // Track number of matches found
     if (matchCount > 0) {
@@ -707,6 +895,13 @@ public final class Pattern implements AutoCloseable {
     metrics.incrementCounter(MetricNames.CAPTURE_BULK_OPERATIONS);
     metrics.incrementCounter(MetricNames.CAPTURE_BULK_ITEMS, inputs.length);
     metrics.recordTimer(MetricNames.CAPTURE_BULK_LATENCY, perItemNanos);
+    recordInputs(
+        metrics,
+        cache.getCaptureThroughput(),
+        MetricNames.CAPTURE_BYTES,
+        MetricNames.CAPTURE_BULK_BYTES,
+        MetricNames.CAPTURE_BULK_INPUT_LENGTH,
+        inputs);
 
     return results;
   }
@@ -765,6 +960,11 @@ public final class Pattern implements AutoCloseable {
     // Specific zero-copy capture metrics
     metrics.incrementCounter(MetricNames.CAPTURE_ZERO_COPY_OPERATIONS);
     metrics.recordTimer(MetricNames.CAPTURE_ZERO_COPY_LATENCY, durationNanos);
+    recordCaptureInput(
+        metrics,
+        MetricNames.CAPTURE_ZERO_COPY_BYTES,
+        MetricNames.CAPTURE_ZERO_COPY_INPUT_LENGTH,
+        length);
 
     if (groups == null) {
       // Need input as String for MatchResult - this is a limitation
@@ -824,6 +1024,40 @@ public final class Pattern implements AutoCloseable {
     return map;
   }
 
+  // ========== Record Mapping ==========
+
+  /**
+   * Creates a mapper that builds records of the given type from this pattern's named groups.
+   *
+   * <p>Each record component is bound once to the named group of the same name; mapping a row is
+   * then one native call (which also parses numeric components) plus the record allocation,
+   * instead of a {@link MatchResult} and a {@code group(String)} lookup and String per component.
+   *
+   * <pre>{@code
+   * record Date(int year, int month, int day) {}
+   *
+   * RecordMapper<Date> dates =
+   *     Pattern.compile("(?P<year>\\d{4})-(?P<month>\\d{2})-(?P<day>\\d{2})").mapper(Date.class);
+   * Date date = dates.match("2025-11-24"); // Date[year=2025, month=11, day=24]
+   * }</pre>
+   *
+   * @param recordType record class; components must be String, CharSequence, int, long, double or
+   *     their wrappers
+   * @param <T> record type
+   * @return reusable, thread-safe mapper
+   * @throws NullPointerException if recordType is null
+   * @throws IllegalArgumentException if a component has no named group of the same name or an
+   *     unsupported type
+   * @throws IllegalStateException if pattern is closed
+   * @see RecordMapper
+   * @since 1.3.0
+   */
+  public <T extends Record> RecordMapper<T> mapper(Class<T> recordType) {
+    checkNotClosed();
+    Objects.requireNonNull(recordType, "recordType cannot be null");
+    return RecordMapper.create(this, recordType, getNamedGroupsMap());
+  }
+
   // ========== Capture Group Zero-Copy Operations ==========
 
   /**
@@ -857,6 +1091,11 @@ public final class Pattern implements AutoCloseable {
     metrics.recordTimer(MetricNames.CAPTURE_LATENCY, durationNanos);
     metrics.incrementCounter(MetricNames.CAPTURE_ZERO_COPY_OPERATIONS);
     metrics.recordTimer(MetricNames.CAPTURE_ZERO_COPY_LATENCY, durationNanos);
+    recordCaptureInput(
+        metrics,
+        MetricNames.CAPTURE_ZERO_COPY_BYTES,
+        MetricNames.CAPTURE_ZERO_COPY_INPUT_LENGTH,
+        length);
 
     if (groups == null) {
       return new MatchResult("");
@@ -920,6 +1159,11 @@ public final class Pattern implements AutoCloseable {
     metrics.recordTimer(MetricNames.CAPTURE_LATENCY, durationNanos);
     metrics.incrementCounter(MetricNames.CAPTURE_ZERO_COPY_OPERATIONS);
     metrics.recordTimer(MetricNames.CAPTURE_ZERO_COPY_LATENCY, durationNanos);
+    recordCaptureInput(
+        metrics,
+        MetricNames.CAPTURE_ZERO_COPY_BYTES,
+        MetricNames.CAPTURE_ZERO_COPY_INPUT_LENGTH,
+        length);
 
     if (groups == null) {
       return new MatchResult("");
@@ -985,6 +1229,11 @@ public final class Pattern implements AutoCloseable {
     metrics.recordTimer(MetricNames.CAPTURE_LATENCY, durationNanos);
     metrics.incrementCounter(MetricNames.CAPTURE_ZERO_COPY_OPERATIONS);
     metrics.recordTimer(MetricNames.CAPTURE_ZERO_COPY_LATENCY, durationNanos);
+    recordCaptureInput(
+        metrics,
+        MetricNames.CAPTURE_ZERO_COPY_BYTES,
+        MetricNames.CAPTURE_ZERO_COPY_INPUT_LENGTH,
+        length);
 
     if (matchCount > 0) {
       metrics.incrementCounter(MetricNames.CAPTURE_FINDALL_MATCHES, matchCount);
@@ -1444,33 +1693,213 @@ public final class Pattern implements AutoCloseable {
       return new String[0];
     }
 
-    // Check if all buffers are direct - if so, use zero-copy bulk path
-    boolean allDirect = true;
-    for (java.nio.ByteBuffer buffer : inputs) {
-      if (!buffer.isDirect()) {
-        allDirect = false;
-        break;
-      }
+    // Route per element - direct by address, heap copied once into scratch - in one native call
+    DirectBatch batch = DirectBatch.of(inputs);
+    String[] results = replaceAll(batch.addresses, batch.lengths, replacement);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    return results;
+  }
+
+  // ========== In-Place Masking ==========
+
+  /**
+   * Masks every match in off-heap text in place, overwriting each matched byte with {@code mask}.
+   *
+   * @param address native memory address of UTF-8 text (from DirectByteBuffer or native allocator)
+   * @param length number of bytes to process
+   * @param mask replacement for every matched byte, e.g. {@code (byte) '*'}
+   * @return number of matches masked
+   * @see #maskAll(long, int, byte[])
+   * @since 1.3.0
+   */
+  public int maskAll(long address, int length, byte mask) {
+    return maskAll(address, length, SINGLE_BYTE_MASKS[mask & 0xFF]);
+  }
+
+  /**
+   * Masks every match in off-heap text in place (length-preserving redaction).
+   *
+   * <p>Each non-empty match is overwritten with {@code mask}, repeated from the start of the match
+   * and cut off at its end, so the text keeps its length and records can be scrubbed inside the
+   * buffer they will be forwarded from. Matches are the ones {@link #replaceAll(long, int,
+   * String)} would replace; empty matches are left alone. Unlike {@code replaceAll}, nothing is
+   * copied and no String is built - the call allocates nothing. Use ASCII mask bytes to keep the
+   * text valid UTF-8: multi-byte characters inside a match become one mask byte per byte.
+   *
+   * <p><strong>Memory Safety:</strong> the memory must remain valid and writable for the duration
+   * of this call.
+   *
+   * @param address native memory address of UTF-8 text (from DirectByteBuffer or native allocator)
+   * @param length number of bytes to process
+   * @param mask 1 to {@value #MAX_MASK_BYTES} bytes written over each match
+   * @return number of matches masked
+   * @throws IllegalStateException if pattern is closed
+   * @throws NullPointerException if mask is null
+   * @throws IllegalArgumentException if address is 0 for a non-empty text, length is negative or
+   *     the mask length is out of range
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public int maskAll(long address, int length, byte[] mask) {
+    checkNotClosed();
+    checkMask(mask);
+    if (length < 0) {
+      throw new IllegalArgumentException("Length must not be negative: " + length);
+    }
+    if (address == 0 && length != 0) {
+      throw new IllegalArgumentException("Address must not be 0");
     }
 
-    if (allDirect) {
-      // Zero-copy bulk path
-      long[] addresses = new long[inputs.length];
-      int[] lengths = new int[inputs.length];
+    long startNanos = System.nanoTime();
+    int masked = jni.maskDirect(nativeHandle, address, length, mask);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (masked < 0) {
+      throw new NativeLibraryException("Failed to mask matches: " + jni.getError());
+    }
 
-      for (int i = 0; i < inputs.length; i++) {
-        addresses[i] = ((DirectBuffer) inputs[i]).address() + inputs[i].position();
-        lengths[i] = inputs[i].remaining();
-      }
+    // Track metrics - GLOBAL (ALL) + SPECIFIC (Zero-Copy)
+    RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+    metrics.incrementCounter(MetricNames.REPLACE_OPERATIONS);
+    metrics.recordTimer(MetricNames.REPLACE_LATENCY, durationNanos);
+    metrics.incrementCounter(MetricNames.REPLACE_ZERO_COPY_OPERATIONS);
+    metrics.recordTimer(MetricNames.REPLACE_ZERO_COPY_LATENCY, durationNanos);
 
-      return replaceAll(addresses, lengths, replacement);
-    } else {
-      // Mixed or heap buffers - process individually
-      String[] results = new String[inputs.length];
-      for (int i = 0; i < inputs.length; i++) {
-        results[i] = replaceAll(inputs[i], replacement);
+    return masked;
+  }
+
+  /**
+   * Masks every match in a direct buffer in place, overwriting each matched byte with {@code
+   * mask}.
+   *
+   * @param buffer direct buffer of UTF-8 text; position to limit is masked, position unchanged
+   * @param mask replacement for every matched byte, e.g. {@code (byte) '*'}
+   * @return number of matches masked
+   * @see #maskAll(ByteBuffer, byte[])
+   * @since 1.3.0
+   */
+  public int maskAll(ByteBuffer buffer, byte mask) {
+    return maskAll(buffer, SINGLE_BYTE_MASKS[mask & 0xFF]);
+  }
+
+  /**
+   * Masks every match in a direct buffer in place (length-preserving redaction); see {@link
+   * #maskAll(long, int, byte[])}.
+   *
+   * @param buffer direct buffer of UTF-8 text; position to limit is masked, position unchanged
+   * @param mask 1 to {@value #MAX_MASK_BYTES} bytes written over each match
+   * @return number of matches masked
+   * @throws IllegalStateException if pattern is closed
+   * @throws NullPointerException if buffer or mask is null
+   * @throws IllegalArgumentException if the buffer is not direct or the mask length is out of
+   *     range
+   * @throws java.nio.ReadOnlyBufferException if the buffer is read-only
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public int maskAll(ByteBuffer buffer, byte[] mask) {
+    checkNotClosed();
+    long address = writableAddress(Objects.requireNonNull(buffer, "buffer cannot be null"));
+    int masked = maskAll(address, buffer.remaining(), mask);
+    java.lang.ref.Reference.reachabilityFence(buffer);
+    return masked;
+  }
+
+  /**
+   * Masks every match in multiple off-heap regions in place, e.g. the records packed back to back
+   * in one network buffer, in a single native call; see {@link #maskAll(long, int, byte[])}.
+   * Steady-state calls allocate nothing.
+   *
+   * @param addresses native memory addresses of the regions (0 entries are skipped); regions must
+   *     not overlap
+   * @param lengths number of bytes for each address
+   * @param mask 1 to {@value #MAX_MASK_BYTES} bytes written over each match
+   * @return total number of matches masked
+   * @throws IllegalStateException if pattern is closed
+   * @throws NullPointerException if addresses, lengths or mask is null
+   * @throws IllegalArgumentException if addresses and lengths have different lengths or the mask
+   *     length is out of range
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public long maskAll(long[] addresses, int[] lengths, byte[] mask) {
+    checkNotClosed();
+    Objects.requireNonNull(addresses, "addresses cannot be null");
+    Objects.requireNonNull(lengths, "lengths cannot be null");
+    checkMask(mask);
+    if (addresses.length != lengths.length) {
+      throw new IllegalArgumentException("addresses and lengths must have the same length");
+    }
+    if (addresses.length == 0) {
+      return 0;
+    }
+
+    long startNanos = System.nanoTime();
+    long masked = jni.maskDirectBulk(nativeHandle, addresses, lengths, mask);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (masked < 0) {
+      throw new NativeLibraryException("Failed to mask matches: " + jni.getError());
+    }
+    long perItemNanos = durationNanos / addresses.length;
+
+    // Track metrics - GLOBAL (ALL) + SPECIFIC (Zero-Copy Bulk)
+    RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+    metrics.incrementCounter(MetricNames.REPLACE_OPERATIONS, addresses.length);
+    metrics.recordTimer(MetricNames.REPLACE_LATENCY, perItemNanos);
+    metrics.incrementCounter(MetricNames.REPLACE_BULK_ZERO_COPY_OPERATIONS);
+    metrics.incrementCounter(MetricNames.REPLACE_BULK_ZERO_COPY_ITEMS, addresses.length);
+    metrics.recordTimer(MetricNames.REPLACE_BULK_ZERO_COPY_LATENCY, perItemNanos);
+
+    return masked;
+  }
+
+  /**
+   * Masks every match in multiple direct buffers in place; see {@link #maskAll(long, int,
+   * byte[])}.
+   *
+   * @param buffers direct buffers of UTF-8 text (null elements are skipped); position to limit of
+   *     each is masked, positions unchanged
+   * @param mask 1 to {@value #MAX_MASK_BYTES} bytes written over each match
+   * @return total number of matches masked
+   * @throws IllegalStateException if pattern is closed
+   * @throws NullPointerException if buffers or mask is null
+   * @throws IllegalArgumentException if a buffer is not direct or the mask length is out of range
+   * @throws java.nio.ReadOnlyBufferException if a buffer is read-only
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public long maskAll(ByteBuffer[] buffers, byte[] mask) {
+    checkNotClosed();
+    Objects.requireNonNull(buffers, "buffers cannot be null");
+
+    long[] addresses = new long[buffers.length];
+    int[] lengths = new int[buffers.length];
+    for (int i = 0; i < buffers.length; i++) {
+      if (buffers[i] != null) {
+        addresses[i] = writableAddress(buffers[i]);
+        lengths[i] = buffers[i].remaining();
       }
-      return results;
+    }
+    long masked = maskAll(addresses, lengths, mask);
+    java.lang.ref.Reference.reachabilityFence(buffers);
+    return masked;
+  }
+
+  /** Address of a direct, writable buffer's position. */
+  private static long writableAddress(ByteBuffer buffer) {
+    if (!buffer.isDirect()) {
+      throw new IllegalArgumentException("maskAll requires a direct buffer");
+    }
+    if (buffer.isReadOnly()) {
+      throw new java.nio.ReadOnlyBufferException();
+    }
+    return ((DirectBuffer) buffer).address() + buffer.position();
+  }
+
+  private static void checkMask(byte[] mask) {
+    Objects.requireNonNull(mask, "mask cannot be null");
+    if (mask.length == 0 || mask.length > MAX_MASK_BYTES) {
+      throw new IllegalArgumentException(
+          "Mask must be 1 to " + MAX_MASK_BYTES + " bytes: " + mask.length);
     }
   }
 
@@ -1496,6 +1925,53 @@ public final class Pattern implements AutoCloseable {
     return nativeMemoryBytes;
   }
 
+  /**
+   * Gets the RE2 memory budget (max_mem) this pattern was compiled with.
+   *
+   * @return budget in bytes ({@link #DEFAULT_MAX_MEM_BYTES} unless compiled with an explicit
+   *     budget)
+   * @since 1.3.0
+   */
+  public long getMaxMemBytes() {
+    return maxMemBytes;
+  }
+
+  /**
+   * Gets how many times this pattern's DFA exhausted its memory budget.
+   *
+   * <p>Each failure means RE2 silently fell back to the NFA for that match, which can be an order
+   * of magnitude slower. A steadily rising count on a hot pattern means its {@link
+   * #getMaxMemBytes() budget} is too small for the inputs it sees. The cache can recompile such
+   * patterns automatically - see {@link RE2Config#dfaRecompileEnabled()}.
+   *
+   * <p>Only counted for patterns compiled while DFA failure tracking was on - see {@link
+   * RE2Config#dfaFailureTrackingEnabled()}.
+   *
+   * @return cumulative failure count, or -1 if the native library cannot detect DFA failures or
+   *     tracking was off
+   * @throws IllegalStateException if pattern is closed
+   * @since 1.3.0
+   */
+  public long getDfaFailureCount() {
+    checkNotClosed();
+    return jni.dfaFailureCount(nativeHandle);
+  }
+
+  /**
+   * Compiles a copy of this pattern with a different RE2 memory budget (INTERNAL USE ONLY - called
+   * by cache when a hot pattern keeps exhausting its DFA budget).
+   *
+   * <p>The copy keeps this pattern's cache ownership, so a cached pattern's copy is also managed by
+   * the cache. Public for PatternCache access (different package), but not part of public API.
+   *
+   * @param newMaxMemBytes RE2 max_mem budget in bytes for the copy
+   * @return newly compiled pattern
+   */
+  public Pattern recompileWithMaxMem(long newMaxMemBytes) {
+    checkNotClosed();
+    return doCompile(patternString, caseSensitive, fromCache, jni, newMaxMemBytes);
+  }
+
   /**
    * Gets the DFA fanout for this pattern.
    *
@@ -1511,6 +1987,61 @@ public final class Pattern implements AutoCloseable {
     return jni.programFanout(nativeHandle);
   }
 
+  /**
+   * Explains how RE2 will execute this pattern.
+   *
+   * <p>Reports program sizes, one-pass eligibility, the text length up to which BitState handles
+   * capture extraction, the size of the fully built DFA against this pattern's {@link
+   * #getMaxMemBytes() budget}, the fanout histogram and DFA failures observed so far, the selected
+   * {@link #matchEngine() match engine} and its shortlist, plus guidance on which constructs push
+   * the pattern onto the NFA. Intended for diagnostics - it compiles a
+   * private copy of the program, so avoid calling it on hot paths.
+   *
+   * @return execution report for this pattern
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native library fails to analyse the pattern
+   * @since 1.3.0
+   */
+  public PatternExplanation explain() {
+    checkNotClosed();
+    long[] fields = jni.explain(nativeHandle);
+    if (fields == null) {
+      throw new NativeLibraryException("Failed to explain pattern: " + jni.getError());
+    }
+    return PatternExplanation.fromNative(
+        patternString,
+        fields,
+        jni.programFanout(nativeHandle),
+        jni.dfaFailureCount(nativeHandle),
+        matchEngine,
+        shortInputEngine(),
+        engineShortlist());
+  }
+
+  /**
+   * Gets a byte-at-a-time automaton for this pattern's full-match semantics, for intersecting the
+   * pattern with a term dictionary, trie or FST and pruning dead branches.
+   *
+   * <p>The DFA is materialized from the RE2 program in native code (once per pattern) and copied
+   * to the heap; stepping it costs no JNI calls. Each call returns a new copy, so build it once per
+   * query and reuse it.
+   *
+   * @return the automaton, or empty if the pattern's DFA does not fit its memory budget or the
+   *     native library was built without RE2 internals
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see PatternAutomaton
+   * @since 1.3.0
+   */
+  public Optional<PatternAutomaton> automaton() {
+    checkNotClosed();
+    int[] table = jni.dfaTable(nativeHandle);
+    if (table == null) {
+      throw new NativeLibraryException("Failed to build pattern automaton: " + jni.getError());
+    }
+    return table.length == 0 ? Optional.empty() : Optional.of(PatternAutomaton.fromNative(table));
+  }
+
   /**
    * Escapes special regex characters for literal matching.
    *
@@ -1542,92 +2073,628 @@ public final class Pattern implements AutoCloseable {
     return nativeHandle;
   }
 
+  // ========== Frozen DFA ==========
+
   /**
-   * Increments reference count (called by Matcher constructor).
+   * Freezes this pattern's DFA into immutable native tables, if it has at most {@link
+   * #DEFAULT_FROZEN_DFA_MAX_STATES} states.
    *
-   * @throws ResourceException if maxMatchersPerPattern exceeded
+   * @return true if the pattern is frozen (now or already)
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #freezeDfa(int)
+   * @since 1.3.0
    */
-  void incrementRefCount() {
-    int current = refCount.incrementAndGet();
+  public boolean freezeDfa() {
+    return freezeDfa(DEFAULT_FROZEN_DFA_MAX_STATES);
+  }
 
-    if (current > maxMatchersPerPattern) {
-      refCount.decrementAndGet(); // Roll back
-      throw new ResourceException(
-          "Maximum matchers per pattern exceeded: "
-              + maxMatchersPerPattern
-              + " (current matchers on this pattern: "
-              + current
-              + ")");
+  /**
+   * Freezes this pattern's DFA into immutable native tables, so matching no longer goes through
+   * RE2's lazily built DFA.
+   *
+   * <p>RE2 builds DFA states on demand in a per-pattern cache guarded by a reader-writer lock, so
+   * every match on a hot pattern touches shared lock state and a full cache is reset under the
+   * writer lock. Freezing materializes the complete full- and partial-match DFAs once into
+   * compact tables (byte classes × states, with accept flags) that are stepped without any
+   * locking. {@code matches}/{@code find} and {@code matchAll}/{@code findAll} on Strings,
+   * addresses and direct {@code ByteBuffer}s use the tables from then on - bulk matching of short
+   * keys gains most, with no per-key RE2 search setup; captures, replacements and other operations
+   * still use RE2. Results are identical.
+   *
+   * <p>Materializing costs time proportional to the DFA size, so freeze hot patterns off the
+   * request path. {@link com.axonops.libre2.cache.RE2Config#dfaFreezeHotPatterns()} has the cache
+   * freeze its hottest patterns automatically. The tables are freed with the pattern.
+   *
+   * @param maxStates largest DFA, in states, worth freezing (tables take about {@code 8 ×
+   *     maxStates × byte classes} bytes)
+   * @return true if the pattern is frozen (now or already), false if its DFA has more states or
+   *     the native library was built without RE2 internals
+   * @throws IllegalArgumentException if maxStates is not positive
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public synchronized boolean freezeDfa(int maxStates) {
+    if (maxStates <= 0) {
+      throw new IllegalArgumentException("maxStates must be positive: " + maxStates);
+    }
+    checkNotClosed();
+    if (frozenHandle != 0) {
+      return true;
     }
-  }
 
-  /** Decrements reference count (called by Matcher.close()). */
-  void decrementRefCount() {
-    refCount.decrementAndGet();
+    long frozen = jni.freezeDfa(nativeHandle, maxStates);
+    if (frozen == 0) {
+      String error = jni.getError();
+      if (error != null && !error.isEmpty()) {
+        throw new NativeLibraryException("Failed to freeze DFA: " + error);
+      }
+      return false;
+    }
+    frozenHandle = frozen;
+    selectDefaultEngine();
+    return true;
   }
 
   /**
-   * Gets current reference count (for testing/monitoring).
+   * Whether {@link #freezeDfa()} has frozen this pattern's DFA.
    *
-   * @return number of active matchers using this pattern
+   * @return true if matching uses the frozen tables
+   * @since 1.3.0
    */
-  public int getRefCount() {
-    return refCount.get();
-  }
-
-  public boolean isClosed() {
-    return closed.get();
+  public boolean isDfaFrozen() {
+    return frozenHandle != 0;
   }
 
   /**
-   * Checks if the native pattern pointer is still valid.
-   *
-   * <p>Used for defensive validation to detect memory corruption or other issues that could cause
-   * the native pointer to become invalid.
-   *
-   * @return true if pattern is valid, false if closed or native pointer invalid
+   * Builds a bit-parallel NFA for this pattern, used for matching when its DFA is too large to
+   * freeze.
+   *
+   * <p>Patterns such as {@code (a|b)*a(a|b){20}} have small programs but DFAs that grow
+   * exponentially with the counted repetition, so {@link #freezeDfa()} declines them and RE2's
+   * lazy DFA keeps rebuilding states. When the program has at most 64 byte-consuming positions
+   * and no assertions other than {@code ^} and {@code $}, it is simulated instead as a Glushkov
+   * automaton: the set of active positions is one 64-bit word, advanced per byte with a
+   * byte-class mask and a precomputed follow table, with no state cache and no locking. It serves
+   * the same operations as the frozen DFA tables, which take precedence when both exist. Results
+   * are identical.
+   *
+   * @return true if the NFA is built (now or already), false if the pattern is not eligible or
+   *     the native library was built without RE2 internals
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
    */
-  public boolean isValid() {
-    if (closed.get()) {
-      return false;
+  public synchronized boolean freezeBitParallel() {
+    checkNotClosed();
+    if (bitParallelHandle != 0) {
+      return true;
     }
-    try {
-      return jni.patternOk(nativeHandle);
-    } catch (Exception e) {
-      logger.warn("RE2: Exception while validating pattern", e);
+
+    long frozen = jni.freezeBitParallel(nativeHandle);
+    if (frozen == 0) {
+      String error = jni.getError();
+      if (error != null && !error.isEmpty()) {
+        throw new NativeLibraryException("Failed to build bit-parallel NFA: " + error);
+      }
       return false;
     }
+    bitParallelHandle = frozen;
+    selectDefaultEngine();
+    return true;
   }
 
-  @Override
-  public void close() {
-    if (fromCache) {
-      // This is expected behavior when using try-with-resources with cached patterns
-      logger.trace("RE2: Attempted to close cached pattern (ignoring - cache manages lifecycle)");
-      return;
-    }
-
-    // Attempt 1: Try graceful close
-    forceClose(false);
-
-    // If still has active matchers, wait briefly and force release
-    if (!closed.get() && refCount.get() > 0) {
-      try {
-        Thread.sleep(100); // Give matchers time to close
-      } catch (InterruptedException e) {
-        Thread.currentThread().interrupt();
+  /**
+   * Whether {@link #freezeBitParallel()} has built a bit-parallel NFA for this pattern.
+   *
+   * @return true if the NFA exists
+   * @since 1.3.0
+   */
+  public boolean isBitParallelFrozen() {
+    return bitParallelHandle != 0;
+  }
+
+  /** Frozen matcher handle of the selected engine for the frozenMatch methods, 0 for RE2. */
+  private long frozenMatcher() {
+    return matcherHandle;
+  }
+
+  // ========== Engine Selection ==========
+
+  /**
+   * Gets the engine that answers this pattern's match/no-match queries. Short Strings may still
+   * be matched by the Java DFA tier in front of it (see {@link #explain()}).
+   *
+   * @return {@link MatchEngine#RE2} until the pattern is frozen, then the frozen engine that the
+   *     last calibration found cheapest
+   * @since 1.3.0
+   */
+  public MatchEngine matchEngine() {
+    return matchEngine;
+  }
+
+  /**
+   * Gets the engine that answers match/no-match queries on Strings no longer than {@link
+   * RE2Config#javaDfaMaxInputLength()}.
+   *
+   * @return {@link MatchEngine#JAVA_DFA} if the Java DFA tier serves this pattern, otherwise
+   *     {@link #matchEngine()} (also while the tier's DFAs are still being built)
+   * @throws IllegalStateException if pattern is closed
+   * @since 1.3.0
+   */
+  public MatchEngine shortInputEngine() {
+    return javaDfaTier && engineShortlist().contains(MatchEngine.JAVA_DFA)
+        ? MatchEngine.JAVA_DFA
+        : matchEngine;
+  }
+
+  /**
+   * Gets the engines that can answer this pattern's match/no-match queries.
+   *
+   * <p>The shortlist comes from pattern analysis rather than measurement: the Java DFA tier
+   * applies only if the pattern's DFA is small enough to copy to the heap, {@link #freezeDfa()}
+   * only if the whole DFA fits its state limit, and {@link #freezeBitParallel()} only if the
+   * program has at most 64 positions and no assertions besides {@code ^}/{@code $}. Frozen
+   * engines are listed once built. The Java DFA tier is listed once its heap copies have been
+   * built in the background; the first call schedules that build rather than waiting for it.
+   *
+   * @return shortlisted engines, always starting with {@link MatchEngine#RE2}
+   * @throws IllegalStateException if pattern is closed
+   * @since 1.3.0
+   */
+  public List<MatchEngine> engineShortlist() {
+    checkNotClosed();
+    List<MatchEngine> engines = new ArrayList<>(4);
+    engines.add(MatchEngine.RE2);
+    if (cache.getConfig().javaDfaMaxInputLength() > 0
+        && isJavaDfaBuilt(builtCompactDfa(true))
+        && isJavaDfaBuilt(builtCompactDfa(false))) {
+      engines.add(MatchEngine.JAVA_DFA);
+    }
+    if (frozenHandle != 0) {
+      engines.add(MatchEngine.FROZEN_DFA);
+    }
+    if (bitParallelHandle != 0) {
+      engines.add(MatchEngine.BIT_PARALLEL);
+    }
+    return engines;
+  }
+
+  /**
+   * Re-selects the match engine by timing the shortlisted engines on recent String inputs.
+   *
+   * <p>Which engine is cheapest depends on the inputs as much as on the pattern: frozen DFA tables
+   * for a pattern with many byte classes can miss the CPU cache where the bit-parallel NFA does
+   * not, and the Java DFA tier loses to a native engine on long non-ASCII Strings. Once a frozen
+   * engine exists, every 64th String passed to {@link Matcher#matches()} or {@link Matcher#find()}
+   * is kept if it is at most 1024 chars long (the last 16). Calibration matches each kept input
+   * with every native engine, full and partial, takes the fastest of several rounds per engine,
+   * and switches only if another engine is at least 20% cheaper than the selected one, so timing
+   * noise does not make engines flap. The Java DFA tier is measured the same way against the
+   * selected native engine on the short inputs it would serve, and bypassed for this pattern while
+   * it loses. The kept inputs are dropped once measured; the next calibration uses new ones.
+   *
+   * <p>Intended off the request path: {@link RE2Config#dfaFreezeHotPatterns()} has the cache
+   * calibrate its frozen patterns on every idle eviction scan.
+   *
+   * @return the selected engine; unchanged if fewer than 4 inputs have been kept
+   * @throws IllegalStateException if pattern is closed
+   * @since 1.3.0
+   */
+  public synchronized MatchEngine calibrateEngines() {
+    checkNotClosed();
+    String[] samples = engineSamples();
+    if (samples.length < MIN_CALIBRATION_SAMPLES) {
+      return matchEngine;
+    }
+
+    MatchEngine selected = matchEngine;
+    long selectedCost = engineCost(engineHandle(selected), samples);
+    MatchEngine best = selected;
+    long bestCost = selectedCost;
+    for (MatchEngine engine : NATIVE_ENGINES) {
+      long handle = engineHandle(engine);
+      if (engine == selected || (handle == 0 && engine != MatchEngine.RE2)) {
+        continue;
+      }
+      long cost = engineCost(handle, samples);
+      if (cost < bestCost) {
+        best = engine;
+        bestCost = cost;
       }
+    }
+    if (best != selected && diverges(bestCost, selectedCost)) {
+      logger.debug(
+          "RE2: Switching match engine from {} to {} - cost {} vs {} ns: {}",
+          selected,
+          best,
+          selectedCost,
+          bestCost,
+          patternString);
+      selectEngine(best);
+    }
 
-      // Attempt 2: Force release regardless (DANGEROUS if matchers still active)
-      if (!closed.get()) {
-        logger.warn(
-            "RE2: Pattern still has {} active matcher(s) after 100ms wait - forcing release anyway",
-            refCount.get());
-        forceClose(true);
+    calibrateJavaDfaTier(samples);
+    Arrays.fill(engineSamples, null); // Measured - don't hold on to caller data until next time
+    return matchEngine;
+  }
+
+  /** Whether the cheaper cost undercuts the other by at least the switch margin. */
+  private static boolean diverges(long cheaper, long other) {
+    return cheaper * 100 < other * (100 - ENGINE_SWITCH_MARGIN_PERCENT);
+  }
+
+  /** Enables or bypasses the Java DFA tier by comparing it with the selected native engine. */
+  private void calibrateJavaDfaTier(String[] samples) {
+    int limit = cache.getConfig().javaDfaMaxInputLength();
+    String[] shortSamples =
+        Arrays.stream(samples).filter(s -> s.length() <= limit).toArray(String[]::new);
+    CompactDfa full = compactDfa(true);
+    CompactDfa partial = compactDfa(false);
+    if (shortSamples.length < MIN_CALIBRATION_SAMPLES
+        || full == CompactDfa.NONE
+        || partial == CompactDfa.NONE) {
+      return;
+    }
+
+    long nativeCost = engineCost(matcherHandle, shortSamples);
+    long javaCost = Long.MAX_VALUE;
+    for (int round = 0; round < CALIBRATION_ROUNDS; round++) {
+      boolean sink = false;
+      long start = System.nanoTime();
+      for (String sample : shortSamples) {
+        sink ^= full.matches(sample);
+        sink ^= partial.matches(sample);
+      }
+      javaCost = Math.min(javaCost, System.nanoTime() - start);
+      calibrationSink = sink;
+    }
+
+    boolean enabled = javaDfaTier;
+    if (enabled ? diverges(nativeCost, javaCost) : diverges(javaCost, nativeCost)) {
+      javaDfaTier = !enabled;
+      logger.debug(
+          "RE2: Java DFA tier {} - cost {} vs native {} ns: {}",
+          enabled ? "bypassed" : "restored",
+          javaCost,
+          nativeCost,
+          patternString);
+    }
+  }
+
+  /** Fastest of several rounds matching every sample, full and partial, on one native engine. */
+  private long engineCost(long frozen, String[] samples) {
+    long best = Long.MAX_VALUE;
+    for (int round = 0; round < CALIBRATION_ROUNDS; round++) {
+      long start = System.nanoTime();
+      for (String sample : samples) {
+        if (frozen != 0) {
+          jni.frozenMatch(nativeHandle, frozen, sample, true);
+          jni.frozenMatch(nativeHandle, frozen, sample, false);
+        } else {
+          jni.fullMatch(nativeHandle, sample);
+          jni.partialMatch(nativeHandle, sample);
+        }
+      }
+      best = Math.min(best, System.nanoTime() - start);
+    }
+    return best;
+  }
+
+  /** Snapshot of the kept inputs. */
+  private String[] engineSamples() {
+    return Arrays.stream(engineSamples.clone())
+        .filter(Objects::nonNull)
+        .toArray(String[]::new);
+  }
+
+  /**
+   * Gets the number of inputs currently kept for calibration (for testing).
+   *
+   * @return kept input count
+   */
+  int engineSampleCount() {
+    return engineSamples().length;
+  }
+
+  /**
+   * Keeps every ENGINE_SAMPLE_INTERVAL-th input unless it is longer than ENGINE_SAMPLE_MAX_LENGTH;
+   * the tick is racy by design.
+   */
+  private void sampleInput(String input) {
+    int tick = ++sampleTick;
+    if ((tick & (ENGINE_SAMPLE_INTERVAL - 1)) == 0 && input.length() <= ENGINE_SAMPLE_MAX_LENGTH) {
+      engineSamples[(tick / ENGINE_SAMPLE_INTERVAL) & (ENGINE_SAMPLES - 1)] = input;
+    }
+  }
+
+  /** Frozen handle behind an engine, 0 for RE2 or an engine that is not built. */
+  private long engineHandle(MatchEngine engine) {
+    return switch (engine) {
+      case FROZEN_DFA -> frozenHandle;
+      case BIT_PARALLEL -> bitParallelHandle;
+      default -> 0;
+    };
+  }
+
+  /** Static rule before any calibration: DFA tables, then the bit-parallel NFA, then RE2. */
+  private void selectDefaultEngine() {
+    selectEngine(
+        frozenHandle != 0
+            ? MatchEngine.FROZEN_DFA
+            : bitParallelHandle != 0 ? MatchEngine.BIT_PARALLEL : MatchEngine.RE2);
+    samplingEngines = matchEngine != MatchEngine.RE2;
+  }
+
+  private void selectEngine(MatchEngine engine) {
+    matcherHandle = engineHandle(engine);
+    matchEngine = engine;
+  }
+
+  // ========== Java DFA Tier ==========
+
+  /**
+   * Matches a String, stepping the pattern's compact DFA in Java when the input is no longer than
+   * {@link RE2Config#javaDfaMaxInputLength()} - for such inputs the JNI transition and string
+   * conversion cost more than the match. Falls back to RE2 for longer inputs, for patterns whose
+   * DFA is too large to copy, and while the compact DFA is still being built in the background.
+   *
+   * @param input input to match
+   * @param fullMatch true for full match, false for partial match
+   * @param metrics registry to count Java tier matches on
+   * @return true if the input matches
+   * @throws IllegalStateException if pattern is closed
+   */
+  boolean matchString(String input, boolean fullMatch, RE2MetricsRegistry metrics) {
+    if (samplingEngines) {
+      sampleInput(input);
+    }
+    if (javaDfaTier && input.length() <= cache.getConfig().javaDfaMaxInputLength()) {
+      CompactDfa dfa = builtCompactDfa(fullMatch);
+      if (dfa != null && dfa != CompactDfa.NONE) {
+        metrics.incrementCounter(MetricNames.MATCHING_JAVA_DFA_OPERATIONS);
+        return dfa.matches(input);
+      }
+    }
+    long handle = getNativeHandle();
+    long frozen = frozenMatcher();
+    if (frozen != 0) {
+      return jni.frozenMatch(handle, frozen, input, fullMatch);
+    }
+    return fullMatch ? jni.fullMatch(handle, input) : jni.partialMatch(handle, input);
+  }
+
+  /**
+   * Gets the compact DFA if it has been built. Otherwise schedules the build on the {@link
+   * CompactDfaBuilder} thread, so the matching thread never pays for the export.
+   *
+   * @return the compact DFA, or null while it is not built yet
+   */
+  private CompactDfa builtCompactDfa(boolean fullMatch) {
+    CompactDfa dfa = fullMatch ? fullMatchDfa : partialMatchDfa;
+    if (dfa == null) {
+      AtomicBoolean scheduled = fullMatch ? fullMatchDfaScheduled : partialMatchDfaScheduled;
+      if (scheduled.compareAndSet(false, true)) {
+        CompactDfaBuilder.submit(this, fullMatch);
+      }
+    }
+    return dfa;
+  }
+
+  /** Whether a compact DFA has been built and is usable, as opposed to pending or too large. */
+  private static boolean isJavaDfaBuilt(CompactDfa dfa) {
+    return dfa != null && dfa != CompactDfa.NONE;
+  }
+
+  /** Lets the next short-input match schedule a build that the builder had to skip. */
+  void compactDfaBuildSkipped(boolean fullMatch) {
+    (fullMatch ? fullMatchDfaScheduled : partialMatchDfaScheduled).set(false);
+  }
+
+  /**
+   * Gets the compact DFA for full or partial matching, exporting it on first use. Concurrent
+   * first uses may both export it; the tables are identical. Blocks for the export - matching
+   * paths use {@link #builtCompactDfa(boolean)} instead.
+   */
+  CompactDfa compactDfa(boolean fullMatch) {
+    CompactDfa dfa = fullMatch ? fullMatchDfa : partialMatchDfa;
+    if (dfa != null) {
+      checkNotClosed();
+      return dfa;
+    }
+
+    int[] table = jni.compactDfa(getNativeHandle(), fullMatch, CompactDfa.MAX_TABLE_ENTRIES);
+    if (table == null) {
+      // The tier is an optimization only - match natively rather than fail
+      logger.debug("RE2: Compact DFA unavailable for pattern: {}", jni.getError());
+      dfa = CompactDfa.NONE;
+    } else {
+      dfa = table.length == 0 ? CompactDfa.NONE : CompactDfa.fromNative(table, fullMatch);
+    }
+
+    if (fullMatch) {
+      fullMatchDfa = dfa;
+    } else {
+      partialMatchDfa = dfa;
+    }
+    return dfa;
+  }
+
+  // ========== Throughput Metrics ==========
+  // String inputs are measured in UTF-16 chars: exact UTF-8 length would cost a second pass.
+
+  /** Records the input scanned by one matching operation (bytes, input length, throughput). */
+  void recordMatchingInput(
+      RE2MetricsRegistry metrics, String bytesCounter, String inputLengthHistogram, long length) {
+    metrics.recordHistogram(inputLengthHistogram, length);
+    recordBytes(
+        metrics, cache.getMatchingThroughput(), MetricNames.MATCHING_BYTES, bytesCounter, length);
+  }
+
+  /** Records the input scanned by one capture group operation (bytes, input length, throughput). */
+  void recordCaptureInput(
+      RE2MetricsRegistry metrics, String bytesCounter, String inputLengthHistogram, long length) {
+    metrics.recordHistogram(inputLengthHistogram, length);
+    recordBytes(
+        metrics, cache.getCaptureThroughput(), MetricNames.CAPTURE_BYTES, bytesCounter, length);
+  }
+
+  /** Records the inputs of a String bulk operation - one histogram sample per item. */
+  private static void recordInputs(
+      RE2MetricsRegistry metrics,
+      ThroughputMeter meter,
+      String allBytesCounter,
+      String bytesCounter,
+      String inputLengthHistogram,
+      String[] inputs) {
+    long total = 0;
+    for (String input : inputs) {
+      int length = input != null ? input.length() : 0;
+      metrics.recordHistogram(inputLengthHistogram, length);
+      total += length;
+    }
+    recordBytes(metrics, meter, allBytesCounter, bytesCounter, total);
+  }
+
+  /** Records the inputs of a zero-copy bulk operation - one histogram sample per item. */
+  private static void recordInputs(
+      RE2MetricsRegistry metrics,
+      ThroughputMeter meter,
+      String allBytesCounter,
+      String bytesCounter,
+      String inputLengthHistogram,
+      int[] lengths) {
+    long total = 0;
+    for (int length : lengths) {
+      metrics.recordHistogram(inputLengthHistogram, length);
+      total += length;
+    }
+    recordBytes(metrics, meter, allBytesCounter, bytesCounter, total);
+  }
+
+  private static void recordBytes(
+      RE2MetricsRegistry metrics,
+      ThroughputMeter meter,
+      String allBytesCounter,
+      String bytesCounter,
+      long bytes) {
+    metrics.incrementCounter(allBytesCounter, bytes);
+    metrics.incrementCounter(bytesCounter, bytes);
+    meter.mark(bytes);
+  }
+
+  /**
+   * Increments reference count (called by Matcher constructor).
+   *
+   * @throws IllegalStateException if the pattern is closed
+   * @throws ResourceException if maxMatchersPerPattern exceeded
+   */
+  void incrementRefCount() {
+    int current = refCount.incrementAndGet();
+
+    if (closed.get()) {
+      decrementRefCount(); // Roll back (may hand the pattern to the reclaimer)
+      throw new IllegalStateException("RE2: Pattern is closed");
+    }
+    if (current > maxMatchersPerPattern) {
+      refCount.decrementAndGet(); // Roll back
+      throw new ResourceException(
+          "Maximum matchers per pattern exceeded: "
+              + maxMatchersPerPattern
+              + " (current matchers on this pattern: "
+              + current
+              + ")");
+    }
+  }
+
+  /**
+   * Decrements reference count (called by Matcher.close()). Releasing the last reference to a
+   * closed pattern hands it to the reclaimer.
+   */
+  void decrementRefCount() {
+    if (refCount.decrementAndGet() == 0 && closed.get()) {
+      PatternReclaimer.releaseIfUnused(this);
+    }
+  }
+
+  /**
+   * Gets current reference count (for testing/monitoring).
+   *
+   * @return number of active matchers using this pattern
+   */
+  public int getRefCount() {
+    return refCount.get();
+  }
+
+  public boolean isClosed() {
+    return closed.get();
+  }
+
+  /**
+   * Checks if the native pattern pointer is still valid.
+   *
+   * <p>Used for defensive validation to detect memory corruption or other issues that could cause
+   * the native pointer to become invalid.
+   *
+   * @return true if pattern is valid, false if closed or native pointer invalid
+   */
+  public boolean isValid() {
+    if (closed.get()) {
+      return false;
+    }
+    try {
+      return jni.patternOk(nativeHandle);
+    } catch (Exception e) {
+      logger.warn("RE2: Exception while validating pattern", e);
+      return false;
+    }
+  }
+
+  /**
+   * Closes the pattern without blocking. Cached patterns are unaffected (the cache manages their
+   * lifecycle).
+   *
+   * <p>An uncached pattern is marked closed at once, so new operations on it throw {@link
+   * IllegalStateException}. Its native memory is released on a background thread once the last
+   * {@link Matcher}, {@link PatternExpression} or pending {@link AsyncMatcher} request using it
+   * has finished - the calling thread never waits for users or pays for freeing a large DFA. Use
+   * {@link #closeAsync()} to be notified of the release.
+   */
+  @Override
+  public void close() {
+    if (fromCache) {
+      // This is expected behavior when using try-with-resources with cached patterns
+      logger.trace("RE2: Attempted to close cached pattern (ignoring - cache manages lifecycle)");
+      return;
+    }
+
+    if (closed.compareAndSet(false, true)) {
+      int users = refCount.get();
+      if (users > 0) {
+        logger.debug("RE2: Pattern closed with {} active user(s) - release deferred", users);
       }
+      PatternReclaimer.submit(this);
     }
   }
 
+  /**
+   * Closes the pattern as {@link #close()} does, returning a future completed once its native
+   * memory has been released.
+   *
+   * <p>For an uncached pattern, the release happens on a background thread after its last user
+   * has finished. For a cached pattern, closing is a no-op and the future completes when the
+   * cache evicts and frees the pattern. The future completes exceptionally if the native release
+   * fails (the pattern is still accounted as freed).
+   *
+   * @return future completed when the native pattern has been freed
+   * @since 1.3.0
+   */
+  public CompletableFuture<Void> closeAsync() {
+    close();
+    return released.copy();
+  }
+
   /**
    * Force closes the pattern (INTERNAL USE ONLY - called by cache during eviction).
    *
@@ -1673,15 +2740,50 @@ public final class Pattern implements AutoCloseable {
           fromCache,
           releaseRegardless);
 
-      // CRITICAL: Always track freed, even if freePattern throws
-      try {
-        jni.freePattern(nativeHandle);
-      } catch (Exception e) {
-        logger.error("RE2: Error freeing pattern native handle", e);
-      } finally {
-        // Always track freed (all patterns were tracked when allocated)
-        cache.getResourceTracker().trackPatternFreed(cache.getConfig().metricsRegistry());
-      }
+      release();
+    }
+  }
+
+  /**
+   * Frees the native pattern. Called exactly once, after {@code closed} has been set: inline by
+   * {@link #forceClose(boolean)}, or on the reclaimer thread for {@link #close()}.
+   */
+  void release() {
+    Exception failure = null;
+    // CRITICAL: Always track freed, even if freePattern throws
+    try {
+      releaseFrozenDfa();
+      jni.freePattern(nativeHandle);
+    } catch (Exception e) {
+      logger.error("RE2: Error freeing pattern native handle", e);
+      failure = e;
+    } finally {
+      // Always track freed (all patterns were tracked when allocated)
+      cache.getResourceTracker().trackPatternFreed(cache.getConfig().metricsRegistry());
+    }
+
+    // Completed after tracking so waiters observe settled accounting
+    if (failure == null) {
+      released.complete(null);
+    } else {
+      released.completeExceptionally(failure);
+    }
+  }
+
+  /** Frees the frozen matchers; waits for a freeze still running on another thread. */
+  private synchronized void releaseFrozenDfa() {
+    selectEngine(MatchEngine.RE2);
+    samplingEngines = false;
+    Arrays.fill(engineSamples, null);
+    long frozen = frozenHandle;
+    if (frozen != 0) {
+      frozenHandle = 0;
+      jni.freeFrozenDfa(frozen);
+    }
+    long bitParallel = bitParallelHandle;
+    if (bitParallel != 0) {
+      bitParallelHandle = 0;
+      jni.freeFrozenDfa(bitParallel);
     }
   }
 
@@ -1697,6 +2799,7 @@ public final class Pattern implements AutoCloseable {
 
   /** Fully resets the cache including statistics (for testing only). */
   public static void resetCache() {
+    PatternReclaimer.drain(); // Settle pending releases against the current accounting
     cache.reset();
   }
 
@@ -1839,7 +2942,11 @@ public final class Pattern implements AutoCloseable {
     }
 
     long startNanos = System.nanoTime();
-    boolean[] results = jni.fullMatchBulk(nativeHandle, inputs);
+    long frozen = frozenMatcher();
+    boolean[] results =
+        frozen != 0
+            ? jni.frozenMatchBulk(nativeHandle, frozen, inputs, true)
+            : jni.fullMatchBulk(nativeHandle, inputs);
     long durationNanos = System.nanoTime() - startNanos;
 
     // Track metrics - GLOBAL (ALL) + SPECIFIC (String Bulk)
@@ -1855,6 +2962,13 @@ public final class Pattern implements AutoCloseable {
     metrics.incrementCounter(MetricNames.MATCHING_BULK_OPERATIONS);
     metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, inputs.length);
     metrics.recordTimer(MetricNames.MATCHING_BULK_LATENCY, perItemNanos);
+    recordInputs(
+        metrics,
+        cache.getMatchingThroughput(),
+        MetricNames.MATCHING_BYTES,
+        MetricNames.MATCHING_BULK_BYTES,
+        MetricNames.MATCHING_BULK_INPUT_LENGTH,
+        inputs);
 
     return results != null ? results : new boolean[inputs.length];
   }
@@ -1897,7 +3011,11 @@ public final class Pattern implements AutoCloseable {
     }
 
     long startNanos = System.nanoTime();
-    boolean[] results = jni.partialMatchBulk(nativeHandle, inputs);
+    long frozen = frozenMatcher();
+    boolean[] results =
+        frozen != 0
+            ? jni.frozenMatchBulk(nativeHandle, frozen, inputs, false)
+            : jni.partialMatchBulk(nativeHandle, inputs);
     long durationNanos = System.nanoTime() - startNanos;
 
     // Track metrics - GLOBAL (ALL) + SPECIFIC (String Bulk)
@@ -1913,6 +3031,13 @@ public final class Pattern implements AutoCloseable {
     metrics.incrementCounter(MetricNames.MATCHING_BULK_OPERATIONS);
     metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, inputs.length);
     metrics.recordTimer(MetricNames.MATCHING_BULK_LATENCY, perItemNanos);
+    recordInputs(
+        metrics,
+        cache.getMatchingThroughput(),
+        MetricNames.MATCHING_BYTES,
+        MetricNames.MATCHING_BULK_BYTES,
+        MetricNames.MATCHING_BULK_INPUT_LENGTH,
+        inputs);
 
     return results != null ? results : new boolean[inputs.length];
   }
@@ -1995,7 +3120,11 @@ public final class Pattern implements AutoCloseable {
     }
 
     long startNanos = System.nanoTime();
-    boolean[] results = jni.fullMatchDirectBulk(nativeHandle, addresses, lengths);
+    long frozen = frozenMatcher();
+    boolean[] results =
+        frozen != 0
+            ? jni.frozenMatchDirectBulk(nativeHandle, frozen, addresses, lengths, true)
+            : jni.fullMatchDirectBulk(nativeHandle, addresses, lengths);
     long durationNanos = System.nanoTime() - startNanos;
 
     // Track metrics - GLOBAL (ALL) + SPECIFIC (Bulk Zero-Copy)
@@ -2011,6 +3140,13 @@ public final class Pattern implements AutoCloseable {
     metrics.incrementCounter(MetricNames.MATCHING_BULK_ZERO_COPY_OPERATIONS);
     metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, addresses.length);
     metrics.recordTimer(MetricNames.MATCHING_BULK_ZERO_COPY_LATENCY, perItemNanos);
+    recordInputs(
+        metrics,
+        cache.getMatchingThroughput(),
+        MetricNames.MATCHING_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_INPUT_LENGTH,
+        lengths);
 
     return results != null ? results : new boolean[addresses.length];
   }
@@ -2048,7 +3184,11 @@ public final class Pattern implements AutoCloseable {
     }
 
     long startNanos = System.nanoTime();
-    boolean[] results = jni.partialMatchDirectBulk(nativeHandle, addresses, lengths);
+    long frozen = frozenMatcher();
+    boolean[] results =
+        frozen != 0
+            ? jni.frozenMatchDirectBulk(nativeHandle, frozen, addresses, lengths, false)
+            : jni.partialMatchDirectBulk(nativeHandle, addresses, lengths);
     long durationNanos = System.nanoTime() - startNanos;
 
     // Track metrics - GLOBAL (ALL) + SPECIFIC (Bulk Zero-Copy)
@@ -2064,6 +3204,13 @@ public final class Pattern implements AutoCloseable {
     metrics.incrementCounter(MetricNames.MATCHING_BULK_ZERO_COPY_OPERATIONS);
     metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, addresses.length);
     metrics.recordTimer(MetricNames.MATCHING_BULK_ZERO_COPY_LATENCY, perItemNanos);
+    recordInputs(
+        metrics,
+        cache.getMatchingThroughput(),
+        MetricNames.MATCHING_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_INPUT_LENGTH,
+        lengths);
 
     return results != null ? results : new boolean[addresses.length];
   }
@@ -2071,7 +3218,9 @@ public final class Pattern implements AutoCloseable {
   /**
    * Matches multiple ByteBuffers in a single operation (bulk with auto-routing).
    *
-   * <p>Automatically routes each buffer: DirectByteBuffer → zero-copy, heap → String.
+   * <p>Routes each buffer by type in a single native call: direct buffers are passed by address,
+   * heap buffers are copied once into a reused direct scratch buffer. Mixed batches no longer fall
+   * back to decoding every buffer into a String.
    *
    * <p><strong>Example - Bulk process Cassandra cells:</strong>
    *
@@ -2097,38 +3246,11 @@ public final class Pattern implements AutoCloseable {
       return new boolean[0];
     }
 
-    // Check if all are direct - if so, use zero-copy bulk path
-    boolean allDirect = true;
-    for (ByteBuffer buf : buffers) {
-      if (buf != null && !buf.isDirect()) {
-        allDirect = false;
-        break;
-      }
-    }
-
-    if (allDirect) {
-      // Zero-copy path - extract addresses
-      long[] addresses = new long[buffers.length];
-      int[] lengths = new int[buffers.length];
-      for (int i = 0; i < buffers.length; i++) {
-        if (buffers[i] != null) {
-          addresses[i] = ((DirectBuffer) buffers[i]).address() + buffers[i].position();
-          lengths[i] = buffers[i].remaining();
-        }
-      }
-      return matchAll(addresses, lengths);
-    } else {
-      // Mixed or heap - convert to Strings
-      String[] strings = new String[buffers.length];
-      for (int i = 0; i < buffers.length; i++) {
-        if (buffers[i] != null) {
-          byte[] bytes = new byte[buffers[i].remaining()];
-          buffers[i].duplicate().get(bytes);
-          strings[i] = new String(bytes, StandardCharsets.UTF_8);
-        }
-      }
-      return matchAll(strings);
-    }
+    // Route per element - direct by address, heap copied once into scratch - in one native call
+    DirectBatch batch = DirectBatch.of(buffers);
+    boolean[] results = matchAll(batch.addresses, batch.lengths);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    return results;
   }
 
   /**
@@ -2150,38 +3272,11 @@ public final class Pattern implements AutoCloseable {
       return new boolean[0];
     }
 
-    // Check if all are direct
-    boolean allDirect = true;
-    for (ByteBuffer buf : buffers) {
-      if (buf != null && !buf.isDirect()) {
-        allDirect = false;
-        break;
-      }
-    }
-
-    if (allDirect) {
-      // Zero-copy path
-      long[] addresses = new long[buffers.length];
-      int[] lengths = new int[buffers.length];
-      for (int i = 0; i < buffers.length; i++) {
-        if (buffers[i] != null) {
-          addresses[i] = ((DirectBuffer) buffers[i]).address() + buffers[i].position();
-          lengths[i] = buffers[i].remaining();
-        }
-      }
-      return findAll(addresses, lengths);
-    } else {
-      // Mixed or heap - convert to Strings
-      String[] strings = new String[buffers.length];
-      for (int i = 0; i < buffers.length; i++) {
-        if (buffers[i] != null) {
-          byte[] bytes = new byte[buffers[i].remaining()];
-          buffers[i].duplicate().get(bytes);
-          strings[i] = new String(bytes, StandardCharsets.UTF_8);
-        }
-      }
-      return findAll(strings);
-    }
+    // Route per element - direct by address, heap copied once into scratch - in one native call
+    DirectBatch batch = DirectBatch.of(buffers);
+    boolean[] results = findAll(batch.addresses, batch.lengths);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    return results;
   }
 
   /**
@@ -2234,6 +3329,1286 @@ public final class Pattern implements AutoCloseable {
     return jni.findAllMatchesDirect(nativeHandle, address, length);
   }
 
+  // ========== Group-By Aggregation ==========
+
+  /**
+   * Counts rows by the value of a capture group, natively (count-only variant).
+   *
+   * @param inputs rows to match (null rows count as unmatched)
+   * @param keyGroup capture group whose text is the key (0 = whole match)
+   * @return counts per distinct key
+   * @throws NullPointerException if inputs is null
+   * @throws IllegalArgumentException if keyGroup is out of range
+   * @throws IllegalStateException if pattern is closed
+   * @see #aggregate(String[], int, int)
+   * @since 1.3.0
+   */
+  public GroupAggregation aggregate(String[] inputs, int keyGroup) {
+    return aggregate(inputs, keyGroup, GroupAggregation.NO_VALUE_GROUP);
+  }
+
+  /**
+   * Counts rows by the value of a capture group and summarises a numeric group per key, natively.
+   *
+   * <p>Each row is searched (unanchored) once. Keys are hashed in native memory and only distinct
+   * keys are converted to Java Strings, so aggregating a million log lines into a handful of
+   * status codes creates a handful of Strings rather than a million {@link MatchResult}s.
+   *
+   * <pre>{@code
+   * Pattern p = Pattern.compile("\" (\\d{3}) (\\d+)$");
+   * GroupAggregation byStatus = p.aggregate(accessLogLines, 1, 2);
+   * long notFound = byStatus.count("404");
+   * long bytesServed = byStatus.sum("200");
+   * }</pre>
+   *
+   * @param inputs rows to match (null rows count as unmatched)
+   * @param keyGroup capture group whose text is the key (0 = whole match)
+   * @param valueGroup capture group parsed as a base-10 integer, or {@link
+   *     GroupAggregation#NO_VALUE_GROUP}
+   * @return counts and value statistics per distinct key
+   * @throws NullPointerException if inputs is null
+   * @throws IllegalArgumentException if keyGroup or valueGroup is out of range
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if native aggregation fails
+   * @since 1.3.0
+   */
+  public GroupAggregation aggregate(String[] inputs, int keyGroup, int valueGroup) {
+    checkNotClosed();
+    Objects.requireNonNull(inputs, "inputs cannot be null");
+    checkAggregationGroups(keyGroup, valueGroup);
+
+    if (inputs.length == 0) {
+      return GroupAggregation.EMPTY;
+    }
+
+    long startNanos = System.nanoTime();
+    Object[] result = jni.aggregateBulk(nativeHandle, inputs, keyGroup, valueGroup);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (result == null) {
+      throw new NativeLibraryException("Failed to aggregate: " + jni.getError());
+    }
+
+    RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+    recordAggregation(metrics, inputs.length, durationNanos);
+    recordInputs(
+        metrics,
+        cache.getCaptureThroughput(),
+        MetricNames.CAPTURE_BYTES,
+        MetricNames.CAPTURE_BULK_BYTES,
+        MetricNames.CAPTURE_BULK_INPUT_LENGTH,
+        inputs);
+
+    return GroupAggregation.fromNative(result);
+  }
+
+  /**
+   * Aggregates rows held in native memory (zero-copy input).
+   *
+   * @param addresses native memory addresses of UTF-8 rows (0 = skipped, counts as unmatched)
+   * @param lengths byte lengths (must be same length as addresses)
+   * @param keyGroup capture group whose text is the key (0 = whole match)
+   * @param valueGroup capture group parsed as a base-10 integer, or {@link
+   *     GroupAggregation#NO_VALUE_GROUP}
+   * @return counts and value statistics per distinct key
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths or a group is out of range
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if native aggregation fails
+   * @see #aggregate(String[], int, int)
+   * @since 1.3.0
+   */
+  public GroupAggregation aggregate(long[] addresses, int[] lengths, int keyGroup, int valueGroup) {
+    checkNotClosed();
+    Objects.requireNonNull(addresses, "addresses cannot be null");
+    Objects.requireNonNull(lengths, "lengths cannot be null");
+    if (addresses.length != lengths.length) {
+      throw new IllegalArgumentException(
+          "Address and length arrays must have same size: addresses="
+              + addresses.length
+              + ", lengths="
+              + lengths.length);
+    }
+    checkAggregationGroups(keyGroup, valueGroup);
+
+    if (addresses.length == 0) {
+      return GroupAggregation.EMPTY;
+    }
+
+    long startNanos = System.nanoTime();
+    Object[] result =
+        jni.aggregateDirectBulk(nativeHandle, addresses, lengths, keyGroup, valueGroup);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (result == null) {
+      throw new NativeLibraryException("Failed to aggregate: " + jni.getError());
+    }
+
+    RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+    recordAggregation(metrics, addresses.length, durationNanos);
+    recordInputs(
+        metrics,
+        cache.getCaptureThroughput(),
+        MetricNames.CAPTURE_BYTES,
+        MetricNames.CAPTURE_ZERO_COPY_BYTES,
+        MetricNames.CAPTURE_ZERO_COPY_INPUT_LENGTH,
+        lengths);
+
+    return GroupAggregation.fromNative(result);
+  }
+
+  /**
+   * Aggregates rows packed back to back in one native buffer (zero-copy input).
+   *
+   * <p>Row {@code i} spans bytes {@code [offsets[i], offsets[i + 1])} relative to {@code address},
+   * so {@code n} rows need {@code n + 1} offsets. This is the layout produced by columnar readers
+   * that store a string column as one data buffer plus an offsets vector.
+   *
+   * @param address native memory address of the packed buffer
+   * @param offsets row boundaries, non-decreasing, {@code n + 1} entries for {@code n} rows
+   * @param keyGroup capture group whose text is the key (0 = whole match)
+   * @param valueGroup capture group parsed as a base-10 integer, or {@link
+   *     GroupAggregation#NO_VALUE_GROUP}
+   * @return counts and value statistics per distinct key
+   * @throws NullPointerException if offsets is null
+   * @throws IllegalArgumentException if address is 0, offsets are malformed, or a group is out of
+   *     range
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if native aggregation fails
+   * @see #aggregate(long[], int[], int, int)
+   * @since 1.3.0
+   */
+  public GroupAggregation aggregatePacked(
+      long address, int[] offsets, int keyGroup, int valueGroup) {
+    checkNotClosed();
+    checkPackedOffsets(address, offsets);
+    return aggregate(
+        packedAddresses(address, offsets), packedLengths(offsets), keyGroup, valueGroup);
+  }
+
+  /** Validates a packed buffer layout: non-zero base address, n + 1 non-decreasing offsets. */
+  private static void checkPackedOffsets(long address, int[] offsets) {
+    Objects.requireNonNull(offsets, "offsets cannot be null");
+    if (address == 0) {
+      throw new IllegalArgumentException("Address must not be 0");
+    }
+    if (offsets.length == 0) {
+      throw new IllegalArgumentException("offsets must have at least one entry");
+    }
+    if (offsets[0] < 0) {
+      throw new IllegalArgumentException("offsets[0] must not be negative: " + offsets[0]);
+    }
+    for (int i = 0; i + 1 < offsets.length; i++) {
+      if (offsets[i + 1] < offsets[i]) {
+        throw new IllegalArgumentException(
+            "offsets must be non-decreasing: offsets["
+                + i
+                + "]="
+                + offsets[i]
+                + ", offsets["
+                + (i + 1)
+                + "]="
+                + offsets[i + 1]);
+      }
+    }
+  }
+
+  /** Start address of each record in a packed buffer (offsets already validated). */
+  private static long[] packedAddresses(long address, int[] offsets) {
+    long[] addresses = new long[offsets.length - 1];
+    for (int i = 0; i < addresses.length; i++) {
+      addresses[i] = address + offsets[i];
+    }
+    return addresses;
+  }
+
+  /** Byte length of each record in a packed buffer (offsets already validated). */
+  private static int[] packedLengths(int[] offsets) {
+    int[] lengths = new int[offsets.length - 1];
+    for (int i = 0; i < lengths.length; i++) {
+      lengths[i] = offsets[i + 1] - offsets[i];
+    }
+    return lengths;
+  }
+
+  private void checkAggregationGroups(int keyGroup, int valueGroup) {
+    int groups = jni.numCapturingGroups(nativeHandle);
+    if (keyGroup < 0 || keyGroup > groups) {
+      throw new IllegalArgumentException(
+          "keyGroup " + keyGroup + " out of range: pattern has " + groups + " groups");
+    }
+    if (valueGroup < GroupAggregation.NO_VALUE_GROUP || valueGroup > groups) {
+      throw new IllegalArgumentException(
+          "valueGroup " + valueGroup + " out of range: pattern has " + groups + " groups");
+    }
+  }
+
+  private static void recordAggregation(RE2MetricsRegistry metrics, int rows, long durationNanos) {
+    long perItemNanos = durationNanos / rows;
+
+    // Global capture metrics (per-item for comparability)
+    metrics.incrementCounter(MetricNames.CAPTURE_OPERATIONS, rows);
+    metrics.recordTimer(MetricNames.CAPTURE_LATENCY, perItemNanos);
+
+    // Specific bulk capture metrics
+    metrics.incrementCounter(MetricNames.CAPTURE_BULK_OPERATIONS);
+    metrics.incrementCounter(MetricNames.CAPTURE_BULK_ITEMS, rows);
+    metrics.recordTimer(MetricNames.CAPTURE_BULK_LATENCY, perItemNanos);
+  }
+
+  // ========== Split ==========
+
+  /**
+   * Splits input around matches of this pattern, dropping trailing empty fields.
+   *
+   * @param input text to split
+   * @return field boundaries, projected to Strings on demand
+   * @throws NullPointerException if input is null
+   * @throws IllegalStateException if pattern is closed
+   * @see #split(String, int)
+   * @since 1.3.0
+   */
+  public SplitResult split(String input) {
+    return split(input, 0);
+  }
+
+  /**
+   * Splits input around matches of this pattern.
+   *
+   * <p>Follows {@link java.util.regex.Pattern#split(CharSequence, int)}: {@code limit > 0} returns
+   * at most {@code limit} fields with the remainder in the last, {@code limit == 0} drops trailing
+   * empty fields, {@code limit < 0} keeps them. A zero-width match at the start never produces a
+   * leading empty field.
+   *
+   * <pre>{@code
+   * String[] parts = Pattern.compile("\\s*,\\s*").split("a , b,c", 0).fields(0);
+   * // parts = {"a", "b", "c"}
+   * }</pre>
+   *
+   * @param input text to split
+   * @param limit field limit
+   * @return field boundaries, projected to Strings on demand
+   * @throws NullPointerException if input is null
+   * @throws IllegalStateException if pattern is closed
+   * @since 1.3.0
+   */
+  public SplitResult split(String input, int limit) {
+    Objects.requireNonNull(input, "input cannot be null");
+    return splitBulk(new String[] {input}, limit);
+  }
+
+  /**
+   * Splits multiple inputs in a single JNI call, dropping trailing empty fields.
+   *
+   * @param inputs texts to split (null inputs have no fields)
+   * @return field boundaries per input
+   * @throws NullPointerException if inputs is null
+   * @throws IllegalStateException if pattern is closed
+   * @see #splitBulk(String[], int)
+   * @since 1.3.0
+   */
+  public SplitResult splitBulk(String[] inputs) {
+    return splitBulk(inputs, 0);
+  }
+
+  /**
+   * Splits multiple inputs in a single JNI call.
+   *
+   * <p>Tokenising a batch of delimited records is one native call returning primitive offsets;
+   * only the fields read through {@link SplitResult#field} become Strings.
+   *
+   * @param inputs texts to split (null inputs have no fields)
+   * @param limit field limit, as for {@link #split(String, int)}
+   * @return field boundaries per input
+   * @throws NullPointerException if inputs is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native split fails
+   * @since 1.3.0
+   */
+  public SplitResult splitBulk(String[] inputs, int limit) {
+    checkNotClosed();
+    Objects.requireNonNull(inputs, "inputs cannot be null");
+
+    long startNanos = System.nanoTime();
+    int[] packed = jni.splitBulk(nativeHandle, inputs, limit);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (packed == null) {
+      throw new NativeLibraryException("Failed to split: " + jni.getError());
+    }
+
+    if (inputs.length > 0) {
+      RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+      long perItemNanos = durationNanos / inputs.length;
+      metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS, inputs.length);
+      metrics.recordTimer(MetricNames.MATCHING_LATENCY, perItemNanos);
+      metrics.incrementCounter(MetricNames.MATCHING_BULK_OPERATIONS);
+      metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, inputs.length);
+      metrics.recordTimer(MetricNames.MATCHING_BULK_LATENCY, perItemNanos);
+      recordInputs(
+          metrics,
+          cache.getMatchingThroughput(),
+          MetricNames.MATCHING_BYTES,
+          MetricNames.MATCHING_BULK_BYTES,
+          MetricNames.MATCHING_BULK_INPUT_LENGTH,
+          inputs);
+    }
+
+    return SplitResult.fromNative(packed, inputs.length, inputs.clone());
+  }
+
+  /**
+   * Splits multiple memory regions in a single JNI call (zero-copy input).
+   *
+   * <p>Offsets in the result are byte offsets relative to each region's address; read the fields
+   * from the source memory.
+   *
+   * @param addresses native memory addresses of UTF-8 text (0 = no fields)
+   * @param lengths byte lengths (must be same length as addresses)
+   * @param limit field limit, as for {@link #split(String, int)}
+   * @return field boundaries per region
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native split fails
+   * @since 1.3.0
+   */
+  public SplitResult splitBulk(long[] addresses, int[] lengths, int limit) {
+    checkNotClosed();
+    Objects.requireNonNull(addresses, "addresses cannot be null");
+    Objects.requireNonNull(lengths, "lengths cannot be null");
+    if (addresses.length != lengths.length) {
+      throw new IllegalArgumentException(
+          "Address and length arrays must have same size: addresses="
+              + addresses.length
+              + ", lengths="
+              + lengths.length);
+    }
+
+    long startNanos = System.nanoTime();
+    int[] packed = jni.splitDirectBulk(nativeHandle, addresses, lengths, limit);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (packed == null) {
+      throw new NativeLibraryException("Failed to split: " + jni.getError());
+    }
+
+    if (addresses.length > 0) {
+      RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+      long perItemNanos = durationNanos / addresses.length;
+      metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS, addresses.length);
+      metrics.recordTimer(MetricNames.MATCHING_LATENCY, perItemNanos);
+      metrics.incrementCounter(MetricNames.MATCHING_BULK_ZERO_COPY_OPERATIONS);
+      metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, addresses.length);
+      metrics.recordTimer(MetricNames.MATCHING_BULK_ZERO_COPY_LATENCY, perItemNanos);
+      recordInputs(
+          metrics,
+          cache.getMatchingThroughput(),
+          MetricNames.MATCHING_BYTES,
+          MetricNames.MATCHING_ZERO_COPY_BYTES,
+          MetricNames.MATCHING_ZERO_COPY_INPUT_LENGTH,
+          lengths);
+    }
+
+    return SplitResult.fromNative(packed, addresses.length, null);
+  }
+
+  // ========== Bulk Match Offsets (Zero-Copy) ==========
+
+  /**
+   * Extracts capture group offsets for the first match in each memory region (zero-copy bulk).
+   *
+   * <p>One JNI call for the batch; the result holds byte offsets only, no Strings.
+   *
+   * @param addresses native memory addresses of UTF-8 text (0 = no match)
+   * @param lengths byte lengths (must be same length as addresses)
+   * @return group offsets per input (0 or 1 match each)
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #extractGroups(long, int) single-input variant
+   * @since 1.3.0
+   */
+  public MatchOffsets extractGroups(long[] addresses, int[] lengths) {
+    return matchOffsets(addresses, lengths, false, null);
+  }
+
+  /**
+   * Finds all non-overlapping matches in each memory region (zero-copy bulk).
+   *
+   * <p>Replaces one {@link #findAllMatches(long, int)} call per document with one call per batch.
+   * Empty matches advance by one character, as {@link java.util.regex.Matcher#find()} does.
+   *
+   * @param addresses native memory addresses of UTF-8 text (0 = no matches)
+   * @param lengths byte lengths (must be same length as addresses)
+   * @return group offsets for every match of every input
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public MatchOffsets findAllMatches(long[] addresses, int[] lengths) {
+    return matchOffsets(addresses, lengths, true, null);
+  }
+
+  /**
+   * Extracts capture group offsets for the first match in each record of a packed buffer.
+   *
+   * @param address native memory address of the packed buffer
+   * @param offsets record boundaries, non-decreasing, {@code n + 1} entries for {@code n} records
+   * @return group offsets per record, relative to each record's start
+   * @throws NullPointerException if offsets is null
+   * @throws IllegalArgumentException if address is 0 or offsets are malformed
+   * @throws IllegalStateException if pattern is closed
+   * @see #aggregatePacked(long, int[], int, int) for the packed layout
+   * @since 1.3.0
+   */
+  public MatchOffsets extractGroupsPacked(long address, int[] offsets) {
+    checkPackedOffsets(address, offsets);
+    return extractGroups(packedAddresses(address, offsets), packedLengths(offsets));
+  }
+
+  /**
+   * Finds all matches in each record of a packed buffer.
+   *
+   * @param address native memory address of the packed buffer
+   * @param offsets record boundaries, non-decreasing, {@code n + 1} entries for {@code n} records
+   * @return group offsets for every match, relative to each record's start
+   * @throws NullPointerException if offsets is null
+   * @throws IllegalArgumentException if address is 0 or offsets are malformed
+   * @throws IllegalStateException if pattern is closed
+   * @see #aggregatePacked(long, int[], int, int) for the packed layout
+   * @since 1.3.0
+   */
+  public MatchOffsets findAllMatchesPacked(long address, int[] offsets) {
+    checkPackedOffsets(address, offsets);
+    return findAllMatches(packedAddresses(address, offsets), packedLengths(offsets));
+  }
+
+  /**
+   * Extracts capture groups for the first match in each buffer, in one JNI call.
+   *
+   * <p>Offsets are relative to each buffer's position, and groups can be read as Strings through
+   * {@link MatchOffsets#group}. Direct buffers are passed by address; heap buffers are copied once
+   * into a direct scratch buffer, so a mixed batch is still one native call.
+   *
+   * @param buffers UTF-8 inputs, read from position to limit (null = no match)
+   * @return group offsets per buffer
+   * @throws NullPointerException if buffers is null
+   * @throws IllegalStateException if pattern is closed
+   * @since 1.3.0
+   */
+  public MatchOffsets extractGroups(ByteBuffer[] buffers) {
+    return matchOffsets(buffers, false);
+  }
+
+  /**
+   * Finds all matches in each buffer, in one JNI call.
+   *
+   * @param buffers UTF-8 inputs, read from position to limit (null = no matches)
+   * @return group offsets for every match of every buffer
+   * @throws NullPointerException if buffers is null
+   * @throws IllegalStateException if pattern is closed
+   * @see #extractGroups(ByteBuffer[]) for routing and projection
+   * @since 1.3.0
+   */
+  public MatchOffsets findAllMatches(ByteBuffer[] buffers) {
+    return matchOffsets(buffers, true);
+  }
+
+  private MatchOffsets matchOffsets(ByteBuffer[] buffers, boolean all) {
+    checkNotClosed();
+    Objects.requireNonNull(buffers, "buffers cannot be null");
+
+    ByteBuffer[] sources = new ByteBuffer[buffers.length];
+    for (int i = 0; i < buffers.length; i++) {
+      sources[i] = buffers[i] != null ? buffers[i].duplicate() : null;
+    }
+    DirectBatch batch = DirectBatch.of(sources);
+    MatchOffsets result = matchOffsets(batch.addresses, batch.lengths, all, sources);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    return result;
+  }
+
+  private MatchOffsets matchOffsets(
+      long[] addresses, int[] lengths, boolean all, ByteBuffer[] sources) {
+    checkNotClosed();
+    Objects.requireNonNull(addresses, "addresses cannot be null");
+    Objects.requireNonNull(lengths, "lengths cannot be null");
+    if (addresses.length != lengths.length) {
+      throw new IllegalArgumentException(
+          "Address and length arrays must have same size: addresses="
+              + addresses.length
+              + ", lengths="
+              + lengths.length);
+    }
+
+    long startNanos = System.nanoTime();
+    int[] packed =
+        all
+            ? jni.findAllMatchesDirectBulk(nativeHandle, addresses, lengths)
+            : jni.extractGroupsDirectBulk(nativeHandle, addresses, lengths);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (packed == null) {
+      throw new NativeLibraryException("Failed to extract match offsets: " + jni.getError());
+    }
+
+    MatchOffsets result =
+        MatchOffsets.fromNative(
+            packed, addresses.length, jni.numCapturingGroups(nativeHandle), sources);
+
+    if (addresses.length > 0) {
+      RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+      long perItemNanos = durationNanos / addresses.length;
+
+      // Global capture metrics (per-item for comparability)
+      metrics.incrementCounter(MetricNames.CAPTURE_OPERATIONS, addresses.length);
+      metrics.recordTimer(MetricNames.CAPTURE_LATENCY, perItemNanos);
+
+      // Specific bulk zero-copy capture metrics
+      metrics.incrementCounter(MetricNames.CAPTURE_BULK_ZERO_COPY_OPERATIONS);
+      metrics.incrementCounter(MetricNames.CAPTURE_BULK_ITEMS, addresses.length);
+      metrics.recordTimer(MetricNames.CAPTURE_BULK_ZERO_COPY_LATENCY, perItemNanos);
+      if (all) {
+        metrics.incrementCounter(MetricNames.CAPTURE_FINDALL_MATCHES, result.totalMatches());
+      }
+      recordInputs(
+          metrics,
+          cache.getCaptureThroughput(),
+          MetricNames.CAPTURE_BYTES,
+          MetricNames.CAPTURE_ZERO_COPY_BYTES,
+          MetricNames.CAPTURE_ZERO_COPY_INPUT_LENGTH,
+          lengths);
+    }
+
+    return result;
+  }
+
+  // ========== Result Arena Views ==========
+
+  /**
+   * Extracts capture group offsets for the first match into the calling thread's result arena.
+   *
+   * <p>Native code writes the offsets straight into a per-thread off-heap arena and the returned
+   * {@link MatchView} reads them in place, so a steady-state extraction loop allocates nothing:
+   * no String arrays, no result objects, nothing to close. The view is reused by the next view
+   * call on the same thread.
+   *
+   * @param address native memory address of UTF-8 encoded text
+   * @param length number of bytes to read
+   * @return this thread's view over the results (0 or 1 match); offsets only, no text
+   * @throws IllegalArgumentException if address is 0 or length is negative
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #extractGroups(long, int) String-returning variant
+   * @since 1.3.0
+   */
+  public MatchView extractGroupsView(long address, int length) {
+    checkNotClosed();
+    if (address == 0) {
+      throw new IllegalArgumentException("Address must not be 0");
+    }
+    if (length < 0) {
+      throw new IllegalArgumentException("Length must not be negative: " + length);
+    }
+    return matchToArena(address, length, false, null, 0);
+  }
+
+  /**
+   * Finds all non-overlapping matches into the calling thread's result arena.
+   *
+   * @param address native memory address of UTF-8 encoded text
+   * @param length number of bytes to read
+   * @return this thread's view over every match; offsets only, no text
+   * @throws IllegalArgumentException if address is 0 or length is negative
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #extractGroupsView(long, int) for arena semantics
+   * @since 1.3.0
+   */
+  public MatchView findAllMatchesView(long address, int length) {
+    checkNotClosed();
+    if (address == 0) {
+      throw new IllegalArgumentException("Address must not be 0");
+    }
+    if (length < 0) {
+      throw new IllegalArgumentException("Length must not be negative: " + length);
+    }
+    return matchToArena(address, length, true, null, 0);
+  }
+
+  /**
+   * Extracts capture group offsets for the first match in a buffer into the result arena.
+   *
+   * <p>Direct buffers are matched in place; heap buffers are copied into the thread's reusable
+   * off-heap input scratch. Offsets are relative to the buffer's position, which is not moved.
+   *
+   * @param buffer UTF-8 text, read from position to limit
+   * @return this thread's view over the results (0 or 1 match)
+   * @throws NullPointerException if buffer is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #extractGroupsView(long, int) for arena semantics
+   * @since 1.3.0
+   */
+  public MatchView extractGroupsView(ByteBuffer buffer) {
+    return matchToArena(buffer, false);
+  }
+
+  /**
+   * Finds all non-overlapping matches in a buffer into the result arena.
+   *
+   * @param buffer UTF-8 text, read from position to limit
+   * @return this thread's view over every match
+   * @throws NullPointerException if buffer is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #extractGroupsView(ByteBuffer) for routing
+   * @since 1.3.0
+   */
+  public MatchView findAllMatchesView(ByteBuffer buffer) {
+    return matchToArena(buffer, true);
+  }
+
+  /**
+   * Extracts capture group offsets for the first match in a String into the result arena.
+   *
+   * <p>The String is encoded into the thread's reusable off-heap input scratch, so offsets are
+   * UTF-8 byte offsets, not char indexes.
+   *
+   * @param input text to search
+   * @return this thread's view over the results (0 or 1 match)
+   * @throws NullPointerException if input is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public MatchView extractGroupsView(String input) {
+    Objects.requireNonNull(input, "input cannot be null");
+    checkNotClosed();
+    ByteBuffer encoded = ResultArena.current().encode(input);
+    return matchToArena(ResultArena.address(encoded), encoded.limit(), false, encoded, 0);
+  }
+
+  /**
+   * Finds all non-overlapping matches in a String into the result arena.
+   *
+   * @param input text to search
+   * @return this thread's view over every match
+   * @throws NullPointerException if input is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #extractGroupsView(String) for offsets
+   * @since 1.3.0
+   */
+  public MatchView findAllMatchesView(String input) {
+    Objects.requireNonNull(input, "input cannot be null");
+    checkNotClosed();
+    ByteBuffer encoded = ResultArena.current().encode(input);
+    return matchToArena(ResultArena.address(encoded), encoded.limit(), true, encoded, 0);
+  }
+
+  private MatchView matchToArena(ByteBuffer buffer, boolean all) {
+    Objects.requireNonNull(buffer, "buffer cannot be null");
+    checkNotClosed();
+    if (buffer.isDirect()) {
+      long address = ((DirectBuffer) buffer).address() + buffer.position();
+      return matchToArena(address, buffer.remaining(), all, buffer, buffer.position());
+    }
+    ByteBuffer copy = ResultArena.current().copy(buffer);
+    return matchToArena(ResultArena.address(copy), copy.limit(), all, copy, 0);
+  }
+
+  private MatchView matchToArena(
+      long address, int length, boolean all, ByteBuffer source, int sourceOffset) {
+    checkNotClosed();
+    ResultArena arena = ResultArena.current();
+    ByteBuffer results = arena.results();
+
+    int status =
+        jni.matchToArena(
+            nativeHandle,
+            address,
+            length,
+            ResultArena.address(results),
+            results.capacity() / Integer.BYTES,
+            all);
+    if (status == 1) {
+      // Rare: more offsets than the arena holds - grow to the size native code reported
+      results = arena.results(results.getInt(MatchView.REQUIRED_INTS * Integer.BYTES));
+      status =
+          jni.matchToArena(
+              nativeHandle,
+              address,
+              length,
+              ResultArena.address(results),
+              results.capacity() / Integer.BYTES,
+              all);
+    }
+    java.lang.ref.Reference.reachabilityFence(source);
+    if (status != 0) {
+      throw new NativeLibraryException("Failed to match into arena: " + jni.getError());
+    }
+    return arena.view.reset(results, source, sourceOffset);
+  }
+
+  // ========== Scatter-Gather Matching ==========
+
+  /**
+   * Tests if the concatenation of memory segments matches this pattern entirely (zero-copy).
+   *
+   * <p>The segments are matched as one logical input - a match may span segment boundaries -
+   * without first copying them into one buffer. This suits fragmented network data such as the
+   * components of a composite buffer. Where the pattern has a materialized DFA, native code steps
+   * it across the segments in place; otherwise the segments are gathered into per-thread native
+   * scratch before matching.
+   *
+   * <p><strong>Memory Safety:</strong> All segments must remain valid for the duration of this
+   * call.
+   *
+   * @param addresses native memory addresses of UTF-8 segments, in input order (0 allowed for
+   *     empty segments)
+   * @param lengths byte length of each segment (must be same length as addresses)
+   * @return true if the concatenated segments match this pattern entirely
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if the arrays differ in length, a length is negative, or a
+   *     non-empty segment has address 0
+   * @throws IllegalStateException if pattern is closed
+   * @see #matches(long, int) single-segment variant
+   * @since 1.3.0
+   */
+  public boolean matchesGathered(long[] addresses, int[] lengths) {
+    return matchGathered(addresses, lengths, true);
+  }
+
+  /**
+   * Tests if this pattern matches anywhere in the concatenation of memory segments (zero-copy).
+   *
+   * @param addresses native memory addresses of UTF-8 segments, in input order (0 allowed for
+   *     empty segments)
+   * @param lengths byte length of each segment (must be same length as addresses)
+   * @return true if the pattern matches anywhere in the concatenated segments
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if the arrays differ in length, a length is negative, or a
+   *     non-empty segment has address 0
+   * @throws IllegalStateException if pattern is closed
+   * @see #matchesGathered(long[], int[]) for how segments are matched
+   * @since 1.3.0
+   */
+  public boolean findGathered(long[] addresses, int[] lengths) {
+    return matchGathered(addresses, lengths, false);
+  }
+
+  /**
+   * Tests if the concatenation of buffers matches this pattern entirely.
+   *
+   * <p>Each buffer contributes its bytes from position to limit; positions are not moved. Direct
+   * buffers are passed by address, heap buffers are copied once into a reused direct scratch
+   * buffer, and all segments are matched in one native call.
+   *
+   * @param segments UTF-8 segments in input order
+   * @return true if the concatenated segments match this pattern entirely
+   * @throws NullPointerException if segments or any segment is null
+   * @throws IllegalStateException if pattern is closed
+   * @see #matchesGathered(long[], int[]) for how segments are matched
+   * @since 1.3.0
+   */
+  public boolean matchesGathered(ByteBuffer[] segments) {
+    return matchGathered(segments, true);
+  }
+
+  /**
+   * Tests if this pattern matches anywhere in the concatenation of buffers.
+   *
+   * @param segments UTF-8 segments in input order
+   * @return true if the pattern matches anywhere in the concatenated segments
+   * @throws NullPointerException if segments or any segment is null
+   * @throws IllegalStateException if pattern is closed
+   * @see #matchesGathered(ByteBuffer[]) for routing
+   * @since 1.3.0
+   */
+  public boolean findGathered(ByteBuffer[] segments) {
+    return matchGathered(segments, false);
+  }
+
+  private boolean matchGathered(ByteBuffer[] segments, boolean fullMatch) {
+    checkNotClosed();
+    Objects.requireNonNull(segments, "segments cannot be null");
+    for (int i = 0; i < segments.length; i++) {
+      Objects.requireNonNull(segments[i], "segment " + i + " is null");
+    }
+
+    DirectBatch batch = DirectBatch.of(segments);
+    boolean result = matchGathered(batch.addresses, batch.lengths, fullMatch);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    java.lang.ref.Reference.reachabilityFence(segments);
+    return result;
+  }
+
+  private boolean matchGathered(long[] addresses, int[] lengths, boolean fullMatch) {
+    checkNotClosed();
+    Objects.requireNonNull(addresses, "addresses cannot be null");
+    Objects.requireNonNull(lengths, "lengths cannot be null");
+    if (addresses.length != lengths.length) {
+      throw new IllegalArgumentException(
+          "Address and length arrays must have same size: addresses="
+              + addresses.length
+              + ", lengths="
+              + lengths.length);
+    }
+    long totalLength = 0;
+    for (int i = 0; i < addresses.length; i++) {
+      if (lengths[i] < 0) {
+        throw new IllegalArgumentException("Length must not be negative: " + lengths[i]);
+      }
+      if (addresses[i] == 0 && lengths[i] > 0) {
+        throw new IllegalArgumentException("Address must not be 0 for non-empty segment " + i);
+      }
+      totalLength += lengths[i];
+    }
+
+    long startNanos = System.nanoTime();
+    boolean result = jni.matchSegments(nativeHandle, addresses, lengths, fullMatch);
+    long durationNanos = System.nanoTime() - startNanos;
+
+    RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+    metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS);
+    metrics.recordTimer(MetricNames.MATCHING_LATENCY, durationNanos);
+    metrics.recordTimer(
+        fullMatch
+            ? MetricNames.MATCHING_FULL_MATCH_LATENCY
+            : MetricNames.MATCHING_PARTIAL_MATCH_LATENCY,
+        durationNanos);
+    metrics.incrementCounter(MetricNames.MATCHING_ZERO_COPY_OPERATIONS);
+    metrics.recordTimer(MetricNames.MATCHING_ZERO_COPY_LATENCY, durationNanos);
+    recordMatchingInput(
+        metrics,
+        MetricNames.MATCHING_ZERO_COPY_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_INPUT_LENGTH,
+        totalLength);
+
+    return result;
+  }
+
+  // ========== Field-Aware Record Matching ==========
+
+  /**
+   * Full-matches one field of each raw JSON or CSV record (zero-copy), returning a bitmap.
+   *
+   * <p>Native code locates the field inside each record with a SIMD structural scan - quote,
+   * escape and delimiter bitmaps computed 64 bytes at a time, as in simdjson - and matches the
+   * field bytes in place; only fields containing escapes are decoded first. Rows are never parsed
+   * into Java objects, so filtering a batch creates one {@link BitSet} rather than a map per row.
+   *
+   * <pre>{@code
+   * Pattern corporate = Pattern.compile(".*@example\\.com");
+   * BitSet hits = corporate.matchAllField(RecordField.json("user.email"), addresses, lengths);
+   * for (int i = hits.nextSetBit(0); i >= 0; i = hits.nextSetBit(i + 1)) {
+   *     ...
+   * }
+   * }</pre>
+   *
+   * <p><strong>Memory Safety:</strong> All records must remain valid for the duration of this
+   * call.
+   *
+   * @param field field to match in each record
+   * @param addresses native memory addresses of UTF-8 records
+   * @param lengths byte length of each record (must be same length as addresses)
+   * @return bitmap with bit {@code i} set if record {@code i} has the field and it matches
+   *     entirely; records without the field and malformed records are clear
+   * @throws NullPointerException if field, addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see RecordField for field selection and value semantics
+   * @since 1.3.0
+   */
+  public BitSet matchAllField(RecordField field, long[] addresses, int[] lengths) {
+    return matchField(field, addresses, lengths, true);
+  }
+
+  /**
+   * Partial-matches one field of each raw JSON or CSV record (zero-copy), returning a bitmap.
+   *
+   * @param field field to search in each record
+   * @param addresses native memory addresses of UTF-8 records
+   * @param lengths byte length of each record (must be same length as addresses)
+   * @return bitmap with bit {@code i} set if record {@code i} has the field and the pattern is
+   *     found in it
+   * @throws NullPointerException if field, addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #matchAllField(RecordField, long[], int[]) for how fields are located
+   * @since 1.3.0
+   */
+  public BitSet findAllField(RecordField field, long[] addresses, int[] lengths) {
+    return matchField(field, addresses, lengths, false);
+  }
+
+  /**
+   * Full-matches one field of each record buffer, returning a bitmap. Heap and direct buffers
+   * are routed per element as in {@link #matchAll(ByteBuffer[])}; positions are not moved.
+   *
+   * @param field field to match in each record
+   * @param records UTF-8 records (read from position to limit; null elements do not match)
+   * @return bitmap with bit {@code i} set if record {@code i} has the field and it matches
+   *     entirely
+   * @throws NullPointerException if field or records is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #matchAllField(RecordField, long[], int[]) for how fields are located
+   * @since 1.3.0
+   */
+  public BitSet matchAllField(RecordField field, ByteBuffer[] records) {
+    return matchField(field, records, true);
+  }
+
+  /**
+   * Partial-matches one field of each record buffer, returning a bitmap.
+   *
+   * @param field field to search in each record
+   * @param records UTF-8 records (read from position to limit; null elements do not match)
+   * @return bitmap with bit {@code i} set if record {@code i} has the field and the pattern is
+   *     found in it
+   * @throws NullPointerException if field or records is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #matchAllField(RecordField, ByteBuffer[]) for routing
+   * @since 1.3.0
+   */
+  public BitSet findAllField(RecordField field, ByteBuffer[] records) {
+    return matchField(field, records, false);
+  }
+
+  /**
+   * Full-matches one field of each record packed into one off-heap buffer (zero-copy), e.g.
+   * newline-delimited JSON. Record {@code i} spans {@code offsets[i]} to {@code offsets[i + 1]}.
+   *
+   * @param field field to match in each record
+   * @param address base address of the packed buffer
+   * @param offsets n + 1 non-decreasing record boundaries relative to address
+   * @return bitmap with bit {@code i} set if record {@code i} has the field and it matches
+   *     entirely
+   * @throws NullPointerException if field or offsets is null
+   * @throws IllegalArgumentException if address is 0 or offsets are invalid
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public BitSet matchAllFieldPacked(RecordField field, long address, int[] offsets) {
+    checkPackedOffsets(address, offsets);
+    return matchField(field, packedAddresses(address, offsets), packedLengths(offsets), true);
+  }
+
+  /**
+   * Partial-matches one field of each record packed into one off-heap buffer (zero-copy).
+   *
+   * @param field field to search in each record
+   * @param address base address of the packed buffer
+   * @param offsets n + 1 non-decreasing record boundaries relative to address
+   * @return bitmap with bit {@code i} set if record {@code i} has the field and the pattern is
+   *     found in it
+   * @throws NullPointerException if field or offsets is null
+   * @throws IllegalArgumentException if address is 0 or offsets are invalid
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public BitSet findAllFieldPacked(RecordField field, long address, int[] offsets) {
+    checkPackedOffsets(address, offsets);
+    return matchField(field, packedAddresses(address, offsets), packedLengths(offsets), false);
+  }
+
+  private BitSet matchField(RecordField field, ByteBuffer[] records, boolean fullMatch) {
+    checkNotClosed();
+    Objects.requireNonNull(field, "field cannot be null");
+    Objects.requireNonNull(records, "records cannot be null");
+
+    // Route per element - direct by address, heap copied once into scratch - in one native call
+    DirectBatch batch = DirectBatch.of(records);
+    BitSet results = matchField(field, batch.addresses, batch.lengths, fullMatch);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    java.lang.ref.Reference.reachabilityFence(records);
+    return results;
+  }
+
+  private BitSet matchField(RecordField field, long[] addresses, int[] lengths, boolean fullMatch) {
+    checkNotClosed();
+    Objects.requireNonNull(field, "field cannot be null");
+    Objects.requireNonNull(addresses, "addresses cannot be null");
+    Objects.requireNonNull(lengths, "lengths cannot be null");
+    if (addresses.length != lengths.length) {
+      throw new IllegalArgumentException(
+          "Address and length arrays must have same size: addresses="
+              + addresses.length
+              + ", lengths="
+              + lengths.length);
+    }
+
+    if (addresses.length == 0) {
+      return new BitSet();
+    }
+
+    long startNanos = System.nanoTime();
+    long[] words =
+        jni.matchFieldBulk(
+            nativeHandle,
+            addresses,
+            lengths,
+            field.format(),
+            field.selector(),
+            field.column(),
+            fullMatch);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (words == null) {
+      throw new NativeLibraryException("Failed to match record fields: " + jni.getError());
+    }
+
+    RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+    long perItemNanos = durationNanos / addresses.length;
+    metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS, addresses.length);
+    metrics.recordTimer(MetricNames.MATCHING_LATENCY, perItemNanos);
+    metrics.recordTimer(
+        fullMatch
+            ? MetricNames.MATCHING_FULL_MATCH_LATENCY
+            : MetricNames.MATCHING_PARTIAL_MATCH_LATENCY,
+        perItemNanos);
+    metrics.incrementCounter(MetricNames.MATCHING_BULK_ZERO_COPY_OPERATIONS);
+    metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, addresses.length);
+    metrics.recordTimer(MetricNames.MATCHING_BULK_ZERO_COPY_LATENCY, perItemNanos);
+    recordInputs(
+        metrics,
+        cache.getMatchingThroughput(),
+        MetricNames.MATCHING_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_INPUT_LENGTH,
+        lengths);
+
+    return BitSet.valueOf(words);
+  }
+
+  // ========== Sorted Batch Matching ==========
+
+  /**
+   * Full-matches a batch of sorted keys, resuming each key from the automaton state shared with
+   * the previous one.
+   *
+   * <p>Native code walks the keys in order over a DFA materialized from the RE2 program. For each
+   * key it finds the common prefix with the previous key and continues from the DFA state reached
+   * at the end of that prefix, so only the differing suffix is scanned. Sorted primary or
+   * clustering keys with long shared prefixes ({@code "user:00017:..."}) therefore cost roughly
+   * their distinct bytes rather than their total bytes.
+   *
+   * <p>Results are identical to {@link #matchAll(String[])} for any input order - unsorted keys
+   * just share less. Patterns whose DFA does not fit the pattern's memory budget (or a native
+   * library built without RE2 internals) match each key with RE2 instead.
+   *
+   * <pre>{@code
+   * Pattern pattern = Pattern.compile("tenant:acme:[a-z]+:\\d+");
+   * boolean[] results = pattern.matchAllSorted(sortedKeys);
+   * }</pre>
+   *
+   * @param inputs keys to match, ideally in sorted order (null elements do not match)
+   * @return boolean array parallel to inputs indicating full matches
+   * @throws NullPointerException if inputs is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @see #findAllSorted(String[]) partial match variant
+   * @since 1.3.0
+   */
+  public boolean[] matchAllSorted(String[] inputs) {
+    return matchSorted(inputs, true);
+  }
+
+  /**
+   * Partial-matches a batch of sorted keys, resuming each key from the automaton state shared
+   * with the previous one.
+   *
+   * <p>Results are identical to {@link #findAll(String[])}. See {@link #matchAllSorted(String[])}.
+   *
+   * @param inputs keys to search, ideally in sorted order (null elements do not match)
+   * @return boolean array parallel to inputs indicating if the pattern was found in each
+   * @throws NullPointerException if inputs is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public boolean[] findAllSorted(String[] inputs) {
+    return matchSorted(inputs, false);
+  }
+
+  /**
+   * Full-matches sorted keys in off-heap memory (zero-copy), resuming each from the automaton
+   * state shared with the previous key.
+   *
+   * <p>Results are identical to {@link #matchAll(long[], int[])}. See {@link
+   * #matchAllSorted(String[])}.
+   *
+   * <p><strong>Memory Safety:</strong> All memory regions must remain valid for the duration of
+   * this call.
+   *
+   * @param addresses native memory addresses of the keys, ideally in sorted order
+   * @param lengths byte lengths (must be same length as addresses)
+   * @return boolean array parallel to inputs indicating full matches
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public boolean[] matchAllSorted(long[] addresses, int[] lengths) {
+    return matchSorted(addresses, lengths, true);
+  }
+
+  /**
+   * Partial-matches sorted keys in off-heap memory (zero-copy), resuming each from the automaton
+   * state shared with the previous key.
+   *
+   * <p>Results are identical to {@link #findAll(long[], int[])}. See {@link
+   * #matchAllSorted(String[])}.
+   *
+   * @param addresses native memory addresses of the keys, ideally in sorted order
+   * @param lengths byte lengths (must be same length as addresses)
+   * @return boolean array parallel to inputs indicating if the pattern was found in each
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public boolean[] findAllSorted(long[] addresses, int[] lengths) {
+    return matchSorted(addresses, lengths, false);
+  }
+
+  /**
+   * Full-matches sorted key buffers, resuming each from the automaton state shared with the
+   * previous key. Heap and direct buffers are routed per element as in {@link
+   * #matchAll(ByteBuffer[])}.
+   *
+   * @param buffers key buffers (read from position to limit), ideally in sorted order
+   * @return boolean array parallel to buffers indicating full matches
+   * @throws NullPointerException if buffers is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public boolean[] matchAllSorted(ByteBuffer[] buffers) {
+    checkNotClosed();
+    Objects.requireNonNull(buffers, "buffers cannot be null");
+
+    // Route per element - direct by address, heap copied once into scratch - in one native call
+    DirectBatch batch = DirectBatch.of(buffers);
+    boolean[] results = matchSorted(batch.addresses, batch.lengths, true);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    return results;
+  }
+
+  /**
+   * Partial-matches sorted key buffers, resuming each from the automaton state shared with the
+   * previous key. Heap and direct buffers are routed per element as in {@link
+   * #findAll(ByteBuffer[])}.
+   *
+   * @param buffers key buffers (read from position to limit), ideally in sorted order
+   * @return boolean array parallel to buffers indicating if the pattern was found in each
+   * @throws NullPointerException if buffers is null
+   * @throws IllegalStateException if pattern is closed
+   * @throws NativeLibraryException if the native call fails
+   * @since 1.3.0
+   */
+  public boolean[] findAllSorted(ByteBuffer[] buffers) {
+    checkNotClosed();
+    Objects.requireNonNull(buffers, "buffers cannot be null");
+
+    // Route per element - direct by address, heap copied once into scratch - in one native call
+    DirectBatch batch = DirectBatch.of(buffers);
+    boolean[] results = matchSorted(batch.addresses, batch.lengths, false);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    return results;
+  }
+
+  private boolean[] matchSorted(String[] inputs, boolean fullMatch) {
+    Objects.requireNonNull(inputs, "inputs cannot be null");
+    checkNotClosed();
+
+    if (inputs.length == 0) {
+      return new boolean[0];
+    }
+
+    long startNanos = System.nanoTime();
+    boolean[] results = jni.matchSortedBulk(nativeHandle, inputs, fullMatch);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (results == null) {
+      throw new NativeLibraryException("Failed to match sorted batch: " + jni.getError());
+    }
+
+    RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+    long perItemNanos = durationNanos / inputs.length;
+    metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS, inputs.length);
+    metrics.recordTimer(MetricNames.MATCHING_LATENCY, perItemNanos);
+    metrics.recordTimer(
+        fullMatch
+            ? MetricNames.MATCHING_FULL_MATCH_LATENCY
+            : MetricNames.MATCHING_PARTIAL_MATCH_LATENCY,
+        perItemNanos);
+    metrics.incrementCounter(MetricNames.MATCHING_BULK_OPERATIONS);
+    metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, inputs.length);
+    metrics.recordTimer(MetricNames.MATCHING_BULK_LATENCY, perItemNanos);
+    recordInputs(
+        metrics,
+        cache.getMatchingThroughput(),
+        MetricNames.MATCHING_BYTES,
+        MetricNames.MATCHING_BULK_BYTES,
+        MetricNames.MATCHING_BULK_INPUT_LENGTH,
+        inputs);
+
+    return results;
+  }
+
+  private boolean[] matchSorted(long[] addresses, int[] lengths, boolean fullMatch) {
+    checkNotClosed();
+    Objects.requireNonNull(addresses, "addresses cannot be null");
+    Objects.requireNonNull(lengths, "lengths cannot be null");
+    if (addresses.length != lengths.length) {
+      throw new IllegalArgumentException(
+          "Address and length arrays must have same size: addresses="
+              + addresses.length
+              + ", lengths="
+              + lengths.length);
+    }
+
+    if (addresses.length == 0) {
+      return new boolean[0];
+    }
+
+    long startNanos = System.nanoTime();
+    boolean[] results = jni.matchSortedDirectBulk(nativeHandle, addresses, lengths, fullMatch);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (results == null) {
+      throw new NativeLibraryException("Failed to match sorted batch: " + jni.getError());
+    }
+
+    RE2MetricsRegistry metrics = cache.getConfig().metricsRegistry();
+    long perItemNanos = durationNanos / addresses.length;
+    metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS, addresses.length);
+    metrics.recordTimer(MetricNames.MATCHING_LATENCY, perItemNanos);
+    metrics.recordTimer(
+        fullMatch
+            ? MetricNames.MATCHING_FULL_MATCH_LATENCY
+            : MetricNames.MATCHING_PARTIAL_MATCH_LATENCY,
+        perItemNanos);
+    metrics.incrementCounter(MetricNames.MATCHING_BULK_ZERO_COPY_OPERATIONS);
+    metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, addresses.length);
+    metrics.recordTimer(MetricNames.MATCHING_BULK_ZERO_COPY_LATENCY, perItemNanos);
+    recordInputs(
+        metrics,
+        cache.getMatchingThroughput(),
+        MetricNames.MATCHING_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_BYTES,
+        MetricNames.MATCHING_ZERO_COPY_INPUT_LENGTH,
+        lengths);
+
+    return results;
+  }
+
   // ========== ByteBuffer API (Automatic Zero-Copy Routing) ==========
 
   /**
@@ -0,0 +1,290 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.nio.ByteBuffer;
+import java.util.Objects;
+
+/**
+ * Byte-at-a-time DFA for a pattern's full-match semantics - returned by {@link
+ * Pattern#automaton()}.
+ *
+ * <p>Intersects a regex with a sorted term dictionary, trie or FST the way Lucene's {@code
+ * AutomatonQuery} does: walk the structure depth first, {@link #step(int, byte) step} the state
+ * along each edge and skip any subtree whose state {@link #isDead(int) is dead}. Only viable
+ * branches are visited instead of every term.
+ *
+ * <pre>{@code
+ * PatternAutomaton automaton = pattern.automaton().orElseThrow();
+ * void visit(TrieNode node, int state) {
+ *     if (automaton.isMatch(state) && node.isTerm()) emit(node.term());
+ *     for (TrieNode child : node.children()) {
+ *         int next = automaton.step(state, child.label());
+ *         if (!automaton.isDead(next)) visit(child, next);
+ *     }
+ * }
+ * visit(root, automaton.start());
+ * }</pre>
+ *
+ * <p>The transition table is the pattern's DFA, materialized from the RE2 program in native code
+ * (bounded by the pattern's memory budget) and copied to the heap once, so stepping involves no
+ * JNI calls. States are plain ints: {@link #DEAD} or {@code 0 .. stateCount() - 1}. States from
+ * which no match is reachable are folded into {@link #DEAD}, so pruning is exact. Immutable,
+ * thread-safe and independent of the pattern's lifetime.
+ *
+ * @since 1.3.0
+ */
+public final class PatternAutomaton {
+
+  /** State id after input that can no longer lead to a match. */
+  public static final int DEAD = -1;
+
+  // Native layout: { stateCount, classes, bytemap[256], match[states], next[states * classes] }
+  private static final int HEADER = 2 + 256;
+
+  private final int stateCount;
+  private final int classes;
+  private final int[] byteClass;
+  private final int[] next;
+  private final boolean[] accepting;
+  private final int start;
+
+  private PatternAutomaton(
+      int stateCount, int classes, int[] byteClass, int[] next, boolean[] accepting, int start) {
+    this.stateCount = stateCount;
+    this.classes = classes;
+    this.byteClass = byteClass;
+    this.next = next;
+    this.accepting = accepting;
+    this.start = start;
+  }
+
+  /**
+   * Builds an automaton from the native DFA table.
+   *
+   * <p>The native table follows RE2's DFA: match flags are delayed by one byte and the last class
+   * is the end-of-text transition. Here a state accepts when its end-of-text transition reaches a
+   * matching state, and transitions into states that cannot reach an accepting one become {@link
+   * #DEAD}.
+   *
+   * @param packed native table, non-empty
+   */
+  static PatternAutomaton fromNative(int[] packed) {
+    if (packed.length < HEADER) {
+      throw new NativeLibraryException("DFA table too short: " + packed.length);
+    }
+    int stateCount = packed[0];
+    int classes = packed[1];
+    long expected = HEADER + stateCount + (long) stateCount * classes;
+    if (stateCount <= 0 || classes < 2 || packed.length != expected) {
+      throw new NativeLibraryException(
+          "DFA table length " + packed.length + " does not match " + stateCount + " states");
+    }
+
+    int[] byteClass = new int[256];
+    System.arraycopy(packed, 2, byteClass, 0, 256);
+    int matchBase = HEADER;
+    int nextBase = HEADER + stateCount;
+    int[] next = new int[stateCount * classes];
+    System.arraycopy(packed, nextBase, next, 0, next.length);
+
+    boolean[] accepting = new boolean[stateCount];
+    for (int s = 0; s < stateCount; s++) {
+      int end = next[s * classes + classes - 1];
+      accepting[s] = end >= 0 && packed[matchBase + end] != 0;
+    }
+
+    boolean[] live = liveStates(next, stateCount, classes, accepting);
+    for (int i = 0; i < next.length; i++) {
+      if (next[i] >= 0 && !live[next[i]]) {
+        next[i] = DEAD;
+      }
+    }
+    return new PatternAutomaton(
+        stateCount, classes, byteClass, next, accepting, live[0] ? 0 : DEAD);
+  }
+
+  /** Marks states that can reach an accepting state (reverse breadth-first search). */
+  private static boolean[] liveStates(
+      int[] next, int stateCount, int classes, boolean[] accepting) {
+    // Reverse edges in compressed form: sources of the edges into state t are
+    // sources[firstSource[t] .. firstSource[t + 1])
+    int[] firstSource = new int[stateCount + 1];
+    for (int s = 0; s < stateCount; s++) {
+      for (int c = 0; c < classes - 1; c++) {
+        int t = next[s * classes + c];
+        if (t >= 0) {
+          firstSource[t + 1]++;
+        }
+      }
+    }
+    for (int t = 0; t < stateCount; t++) {
+      firstSource[t + 1] += firstSource[t];
+    }
+    int[] sources = new int[firstSource[stateCount]];
+    int[] fill = firstSource.clone();
+    for (int s = 0; s < stateCount; s++) {
+      for (int c = 0; c < classes - 1; c++) {
+        int t = next[s * classes + c];
+        if (t >= 0) {
+          sources[fill[t]++] = s;
+        }
+      }
+    }
+
+    boolean[] live = new boolean[stateCount];
+    int[] queue = new int[stateCount];
+    int tail = 0;
+    for (int s = 0; s < stateCount; s++) {
+      if (accepting[s]) {
+        live[s] = true;
+        queue[tail++] = s;
+      }
+    }
+    for (int head = 0; head < tail; head++) {
+      int t = queue[head];
+      for (int i = firstSource[t]; i < firstSource[t + 1]; i++) {
+        if (!live[sources[i]]) {
+          live[sources[i]] = true;
+          queue[tail++] = sources[i];
+        }
+      }
+    }
+    return live;
+  }
+
+  /**
+   * Gets the state before any input.
+   *
+   * @return start state, or {@link #DEAD} if the pattern can never match
+   */
+  public int start() {
+    return start;
+  }
+
+  /**
+   * Advances a state by one byte.
+   *
+   * @param state current state
+   * @param b next input byte
+   * @return the next state, or {@link #DEAD}
+   * @throws IndexOutOfBoundsException if state is not a state of this automaton
+   */
+  public int step(int state, byte b) {
+    if (state == DEAD) {
+      return DEAD;
+    }
+    Objects.checkIndex(state, stateCount);
+    return next[state * classes + byteClass[b & 0xFF]];
+  }
+
+  /**
+   * Advances a state over a run of bytes, e.g. a multi-byte trie edge or term suffix. Stops early
+   * once the state is dead.
+   *
+   * @param state current state
+   * @param bytes input bytes
+   * @param offset first byte to consume
+   * @param length number of bytes to consume
+   * @return the state after the bytes, or {@link #DEAD}
+   * @throws IndexOutOfBoundsException if state or the byte range is out of bounds
+   */
+  public int step(int state, byte[] bytes, int offset, int length) {
+    Objects.checkFromIndexSize(offset, length, bytes.length);
+    if (state != DEAD) {
+      Objects.checkIndex(state, stateCount);
+    }
+    int end = offset + length;
+    for (int i = offset; i < end && state != DEAD; i++) {
+      state = next[state * classes + byteClass[bytes[i] & 0xFF]];
+    }
+    return state;
+  }
+
+  /**
+   * Advances a state over a buffer's remaining bytes (position to limit) without moving its
+   * position. Stops early once the state is dead.
+   *
+   * @param state current state
+   * @param buffer input bytes, heap or direct
+   * @return the state after the bytes, or {@link #DEAD}
+   * @throws IndexOutOfBoundsException if state is not a state of this automaton
+   */
+  public int step(int state, ByteBuffer buffer) {
+    if (state != DEAD) {
+      Objects.checkIndex(state, stateCount);
+    }
+    int end = buffer.limit();
+    for (int i = buffer.position(); i < end && state != DEAD; i++) {
+      state = next[state * classes + byteClass[buffer.get(i) & 0xFF]];
+    }
+    return state;
+  }
+
+  /**
+   * Whether the input consumed so far fully matches the pattern.
+   *
+   * @param state current state
+   * @return true if the bytes stepped from {@link #start()} to this state match
+   */
+  public boolean isMatch(int state) {
+    return state != DEAD && accepting[Objects.checkIndex(state, stateCount)];
+  }
+
+  /**
+   * Whether no continuation of the input consumed so far can match - callers prune here.
+   *
+   * @param state current state
+   * @return true for {@link #DEAD}
+   */
+  public boolean isDead(int state) {
+    return state == DEAD;
+  }
+
+  /**
+   * Tests a whole input, equivalent to {@link Pattern#matches(String)} on its UTF-8 bytes.
+   *
+   * @param bytes input bytes
+   * @return true if the input fully matches
+   */
+  public boolean matches(byte[] bytes) {
+    return isMatch(step(start, bytes, 0, bytes.length));
+  }
+
+  /**
+   * Gets the number of states in the transition table.
+   *
+   * @return state count (ids are {@code 0 .. stateCount() - 1})
+   */
+  public int stateCount() {
+    return stateCount;
+  }
+
+  /**
+   * Gets the number of byte classes - bytes the pattern cannot tell apart share a class.
+   *
+   * @return byte class count
+   */
+  public int byteClassCount() {
+    return classes - 1;
+  }
+
+  @Override
+  public String toString() {
+    return "PatternAutomaton{states=" + stateCount + ", byteClasses=" + byteClassCount() + "}";
+  }
+}
@@ -0,0 +1,313 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * How RE2 will execute a compiled pattern - returned by {@link Pattern#explain()}.
+ *
+ * <p>RE2 picks an engine per call: the DFA answers "does it match and where", then a submatch
+ * engine extracts capture groups - one-pass if the program is one-pass, BitState if the text is
+ * short enough, otherwise the NFA. When the DFA exhausts its memory budget RE2 also falls back to
+ * the NFA, which is typically an order of magnitude slower. This report surfaces the facts behind
+ * those choices so pattern authors can see which construct pushes a pattern onto a slow path.
+ *
+ * <p>Fields that need RE2 internals the native library was built without are reported as {@link
+ * #UNKNOWN}.
+ *
+ * <pre>{@code
+ * Pattern p = Pattern.compile("(\\w+)@(\\w+)\\.com");
+ * System.out.println(p.explain());
+ * }</pre>
+ *
+ * @param pattern the regex pattern string
+ * @param programSize forward program size (RE2's cost measure)
+ * @param reverseProgramSize reverse program size, used to find match starts
+ * @param captureGroups number of capturing groups
+ * @param onePass 1 if the program is one-pass, 0 if not, {@link #UNKNOWN}
+ * @param bitStateMaxTextBytes longest text BitState can search, 0 if unusable, {@link #UNKNOWN}
+ * @param dfaStates states in the fully built DFA, {@link #DFA_OVER_BUDGET}, {@link #UNKNOWN}
+ * @param anchorStart 1 if anchored at start of text, 0 if not, {@link #UNKNOWN}
+ * @param anchorEnd 1 if anchored at end of text, 0 if not, {@link #UNKNOWN}
+ * @param bytemapRange number of byte classes the DFA distinguishes, {@link #UNKNOWN}
+ * @param maxMemBytes RE2 max_mem budget the pattern was compiled with
+ * @param fanout program fanout histogram (see {@link Pattern#getProgramFanout()})
+ * @param dfaFailures DFA budget exhaustions observed so far, {@link #UNKNOWN}
+ * @param matchEngine engine answering match/no-match queries (see {@link Pattern#matchEngine()})
+ * @param shortInputEngine engine for short Strings (see {@link Pattern#shortInputEngine()})
+ * @param engineShortlist engines the pattern can use (see {@link Pattern#engineShortlist()})
+ * @param guidance human-readable notes on constructs that cause slow paths
+ * @since 1.3.0
+ */
+public record PatternExplanation(
+    String pattern,
+    long programSize,
+    long reverseProgramSize,
+    int captureGroups,
+    int onePass,
+    long bitStateMaxTextBytes,
+    long dfaStates,
+    int anchorStart,
+    int anchorEnd,
+    int bytemapRange,
+    long maxMemBytes,
+    int[] fanout,
+    long dfaFailures,
+    MatchEngine matchEngine,
+    MatchEngine shortInputEngine,
+    List<MatchEngine> engineShortlist,
+    List<String> guidance) {
+
+  /** Field value when the native library cannot determine it. */
+  public static final long UNKNOWN = -1;
+
+  /** {@link #dfaStates()} value when the full DFA does not fit in the pattern's budget. */
+  public static final long DFA_OVER_BUDGET = -2;
+
+  /** Most capture groups RE2's one-pass engine supports (Prog::kMaxOnePassCapture). */
+  public static final int MAX_ONE_PASS_CAPTURES = 5;
+
+  /** Program size above which compilation and DFA construction become noticeably costly. */
+  static final long LARGE_PROGRAM_SIZE = 1000;
+
+  /** Fanout bucket (log2 of branching) at or above which alternations dominate DFA cost. */
+  static final int HIGH_FANOUT_BUCKET = 5;
+
+  // Indexes into the array returned by RE2NativeJNI.explain() - keep in sync with re2_jni.cpp
+  static final int EXPLAIN_PROGRAM_SIZE = 0;
+  static final int EXPLAIN_REVERSE_PROGRAM_SIZE = 1;
+  static final int EXPLAIN_CAPTURE_GROUPS = 2;
+  static final int EXPLAIN_ONE_PASS = 3;
+  static final int EXPLAIN_BIT_STATE_MAX_TEXT = 4;
+  static final int EXPLAIN_DFA_STATES = 5;
+  static final int EXPLAIN_ANCHOR_START = 6;
+  static final int EXPLAIN_ANCHOR_END = 7;
+  static final int EXPLAIN_BYTEMAP_RANGE = 8;
+  static final int EXPLAIN_MAX_MEM = 9;
+  static final int EXPLAIN_FIELD_COUNT = 10;
+
+  /** Engines RE2 can use to execute a search. */
+  public enum Engine {
+    /** Lazily built DFA - fastest; answers match/no-match and match bounds only. */
+    DFA,
+    /** One-pass NFA - linear time submatch extraction for unambiguous anchored patterns. */
+    ONE_PASS,
+    /** Bounded backtracker - fast submatch extraction for short texts. */
+    BIT_STATE,
+    /** Pike VM - always applicable, slowest. */
+    NFA,
+    /** The native library cannot tell (RE2 internals unavailable). */
+    UNKNOWN
+  }
+
+  public PatternExplanation {
+    fanout = fanout == null ? new int[0] : fanout.clone();
+    engineShortlist = List.copyOf(engineShortlist);
+    guidance = List.copyOf(guidance);
+  }
+
+  /** Builds an explanation from the native field array. */
+  static PatternExplanation fromNative(
+      String pattern,
+      long[] fields,
+      int[] fanout,
+      long dfaFailures,
+      MatchEngine matchEngine,
+      MatchEngine shortInputEngine,
+      List<MatchEngine> engineShortlist) {
+    if (fields.length < EXPLAIN_FIELD_COUNT) {
+      throw new NativeLibraryException(
+          "explain returned " + fields.length + " fields, expected " + EXPLAIN_FIELD_COUNT);
+    }
+    // Guidance is derived from the other fields, so build those first
+    PatternExplanation raw =
+        new PatternExplanation(
+            pattern,
+            fields[EXPLAIN_PROGRAM_SIZE],
+            fields[EXPLAIN_REVERSE_PROGRAM_SIZE],
+            (int) fields[EXPLAIN_CAPTURE_GROUPS],
+            (int) fields[EXPLAIN_ONE_PASS],
+            fields[EXPLAIN_BIT_STATE_MAX_TEXT],
+            fields[EXPLAIN_DFA_STATES],
+            (int) fields[EXPLAIN_ANCHOR_START],
+            (int) fields[EXPLAIN_ANCHOR_END],
+            (int) fields[EXPLAIN_BYTEMAP_RANGE],
+            fields[EXPLAIN_MAX_MEM],
+            fanout,
+            dfaFailures,
+            matchEngine,
+            shortInputEngine,
+            engineShortlist,
+            Collections.emptyList());
+    return new PatternExplanation(
+        pattern,
+        raw.programSize,
+        raw.reverseProgramSize,
+        raw.captureGroups,
+        raw.onePass,
+        raw.bitStateMaxTextBytes,
+        raw.dfaStates,
+        raw.anchorStart,
+        raw.anchorEnd,
+        raw.bytemapRange,
+        raw.maxMemBytes,
+        raw.fanout,
+        raw.dfaFailures,
+        raw.matchEngine,
+        raw.shortInputEngine,
+        raw.engineShortlist,
+        raw.deriveGuidance());
+  }
+
+  @Override
+  public int[] fanout() {
+    return fanout.clone();
+  }
+
+  /** Whether the DFA is known to exceed the pattern's memory budget (see {@link #dfaStates()}). */
+  public boolean dfaOverBudget() {
+    return dfaStates == DFA_OVER_BUDGET || dfaFailures > 0;
+  }
+
+  /**
+   * Engine RE2 will use to search text of the given length.
+   *
+   * <p>Without captures ({@link Pattern#matches}, {@link Matcher#find()}) the DFA is used unless
+   * its budget is known to be exhausted. With captures ({@link Pattern#match}) the engine is the
+   * one that extracts the groups.
+   *
+   * @param inputLength text length in bytes
+   * @param captures whether capture groups are being extracted
+   * @return the engine, or {@link Engine#UNKNOWN} if the native library cannot tell
+   */
+  public Engine engineFor(long inputLength, boolean captures) {
+    if (!captures) {
+      return dfaOverBudget() ? Engine.NFA : Engine.DFA;
+    }
+    if (onePass == UNKNOWN) {
+      return Engine.UNKNOWN;
+    }
+    if (onePass == 1 && anchorStart == 1 && captureGroups <= MAX_ONE_PASS_CAPTURES) {
+      return Engine.ONE_PASS;
+    }
+    if (bitStateMaxTextBytes > 0 && inputLength <= bitStateMaxTextBytes) {
+      return Engine.BIT_STATE;
+    }
+    return Engine.NFA;
+  }
+
+  private List<String> deriveGuidance() {
+    List<String> notes = new ArrayList<>();
+    if (dfaOverBudget()) {
+      notes.add(
+          "DFA exceeds its "
+              + maxMemBytes
+              + " byte budget - RE2 falls back to the NFA. Counted repetition ({n}) after an"
+              + " unbounded prefix such as .* or (a|b)* multiplies DFA states; anchor the pattern"
+              + " or bound the prefix, or raise max_mem.");
+    }
+    if (captureGroups > MAX_ONE_PASS_CAPTURES) {
+      notes.add(
+          captureGroups
+              + " capture groups exceeds the one-pass limit of "
+              + MAX_ONE_PASS_CAPTURES
+              + " - use non-capturing groups (?:...) where the value is not needed.");
+    }
+    if (captureGroups > 0 && onePass == 0) {
+      String bitState =
+          bitStateMaxTextBytes > 0
+              ? "BitState up to " + bitStateMaxTextBytes + " bytes of text, NFA beyond that"
+              : "the NFA";
+      notes.add(
+          "Not one-pass - capture extraction uses "
+              + bitState
+              + ". Alternatives or repetitions that can match the same text make a pattern"
+              + " ambiguous; make alternatives start with distinct characters.");
+    }
+    if (captureGroups > 0 && onePass == 1 && anchorStart == 0) {
+      notes.add("One-pass but unanchored - anchor with ^ to use the one-pass engine for captures.");
+    }
+    if (programSize > LARGE_PROGRAM_SIZE) {
+      notes.add(
+          "Program size "
+              + programSize
+              + " is large - Unicode classes such as \\w, \\p{L} or (?i) on non-ASCII expand into"
+              + " many instructions; prefer ASCII classes like [a-zA-Z0-9_] if possible.");
+    }
+    if (fanout.length > HIGH_FANOUT_BUCKET
+        && Arrays.stream(fanout, HIGH_FANOUT_BUCKET, fanout.length).anyMatch(n -> n > 0)) {
+      notes.add(
+          "High fanout - many alternatives branch on the same input. Factor out common prefixes"
+              + " (e.g. foo(?:bar|baz) instead of foobar|foobaz).");
+    }
+    return notes;
+  }
+
+  @Override
+  public String toString() {
+    StringBuilder sb = new StringBuilder();
+    sb.append("Pattern: ").append(pattern).append('\n');
+    sb.append("  program size:         ").append(programSize).append('\n');
+    sb.append("  reverse program size: ").append(reverseProgramSize).append('\n');
+    sb.append("  capture groups:       ").append(captureGroups).append('\n');
+    sb.append("  one-pass:             ").append(flag(onePass)).append('\n');
+    sb.append("  BitState max text:    ").append(bitState()).append('\n');
+    sb.append("  DFA states:           ").append(dfaStatesText()).append('\n');
+    sb.append("  anchored:             start=")
+        .append(flag(anchorStart))
+        .append(" end=")
+        .append(flag(anchorEnd))
+        .append('\n');
+    sb.append("  byte classes:         ").append(known(bytemapRange)).append('\n');
+    sb.append("  max_mem:              ").append(maxMemBytes).append(" bytes\n");
+    sb.append("  fanout histogram:     ").append(Arrays.toString(fanout)).append('\n');
+    sb.append("  DFA failures:         ").append(known(dfaFailures)).append('\n');
+    sb.append("  match engine:         ").append(matchEngine);
+    sb.append(" (short Strings: ").append(shortInputEngine);
+    sb.append(", shortlist: ").append(engineShortlist).append(")\n");
+    sb.append("  submatch engine:      ").append(engineFor(0, true)).append(" (short text), ");
+    sb.append(engineFor(Long.MAX_VALUE, true)).append(" (long text)\n");
+    if (guidance.isEmpty()) {
+      sb.append("  guidance:             none - pattern stays on fast paths\n");
+    } else {
+      for (String note : guidance) {
+        sb.append("  - ").append(note).append('\n');
+      }
+    }
+    return sb.toString();
+  }
+
+  private static String flag(int value) {
+    return value == UNKNOWN ? "unknown" : value == 1 ? "yes" : "no";
+  }
+
+  private static String known(long value) {
+    return value == UNKNOWN ? "unknown" : Long.toString(value);
+  }
+
+  private String bitState() {
+    return bitStateMaxTextBytes == 0 ? "unusable" : known(bitStateMaxTextBytes);
+  }
+
+  private String dfaStatesText() {
+    return dfaStates == DFA_OVER_BUDGET ? "exceeds budget" : known(dfaStates);
+  }
+}
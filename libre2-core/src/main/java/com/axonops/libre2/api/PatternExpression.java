@@ -0,0 +1,773 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import com.axonops.libre2.jni.IRE2Native;
+import com.axonops.libre2.jni.RE2LibraryLoader;
+import com.axonops.libre2.jni.RE2Native;
+import com.axonops.libre2.metrics.MetricNames;
+import com.axonops.libre2.metrics.RE2MetricsRegistry;
+import java.io.ByteArrayOutputStream;
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Objects;
+import java.util.concurrent.atomic.AtomicBoolean;
+import sun.nio.ch.DirectBuffer;
+
+/**
+ * A boolean expression over patterns, literal tests and length predicates, evaluated natively in
+ * one call per input (or per batch).
+ *
+ * <p>Filters such as {@code (p1 AND NOT p2) OR p3} otherwise cost one JNI crossing per pattern, in
+ * an order fixed by the caller. A compiled expression crosses once, short-circuits AND/OR, and
+ * reorders operands as it runs: each AND/OR node samples how often each operand decides it (false
+ * for AND, true for OR) and what the operand costs, and evaluates operands in increasing {@code
+ * cost / P(decisive)} order, so cheap, selective checks run first. {@link #plan()} shows the
+ * current order and statistics.
+ *
+ * <pre>{@code
+ * PatternExpression filter = PatternExpression.compile(
+ *     find(errors).and(not(find(healthCheck))).or(startsWith("FATAL")));
+ *
+ * boolean keep = filter.test(line);
+ * boolean[] kept = filter.testAll(lines);
+ * }</pre>
+ *
+ * <p>Literal and length predicates work on UTF-8 bytes. The expression holds a reference on each
+ * pattern (like a {@link Matcher}) so cached patterns are not freed while it is open.
+ *
+ * <p>Thread-safe. Close the expression when it is no longer used.
+ *
+ * @since 1.3.0
+ */
+public final class PatternExpression implements AutoCloseable {
+
+  static {
+    RE2LibraryLoader.loadLibrary();
+  }
+
+  // Node ops - keep in sync with ExprOp in re2_jni.cpp
+  private static final int OP_MATCHES = 0;
+  private static final int OP_FIND = 1;
+  private static final int OP_CONTAINS = 2;
+  private static final int OP_STARTS_WITH = 3;
+  private static final int OP_ENDS_WITH = 4;
+  private static final int OP_LENGTH = 5;
+  private static final int OP_AND = 6;
+  private static final int OP_OR = 7;
+  private static final int OP_NOT = 8;
+
+  // Native AND/OR nodes take at most 16 children; wider ones are split into nested groups
+  private static final int MAX_CHILDREN = 16;
+  private static final int MAX_DEPTH = 64;
+
+  /**
+   * Operand or operator of an expression tree. Immutable and free of native resources - only
+   * {@link PatternExpression#compile(Node)} allocates.
+   *
+   * @since 1.3.0
+   */
+  public static final class Node {
+    private final int op;
+    private final Pattern pattern;
+    private final String literal;
+    private final int min;
+    private final int max;
+    private final List<Node> children;
+
+    private Node(int op, Pattern pattern, String literal, int min, int max, List<Node> children) {
+      this.op = op;
+      this.pattern = pattern;
+      this.literal = literal;
+      this.min = min;
+      this.max = max;
+      this.children = children;
+    }
+
+    /**
+     * Combines this node with another using AND.
+     *
+     * @param other right operand
+     * @return {@code this AND other}
+     */
+    public Node and(Node other) {
+      return PatternExpression.and(this, other);
+    }
+
+    /**
+     * Combines this node with another using OR.
+     *
+     * @param other right operand
+     * @return {@code this OR other}
+     */
+    public Node or(Node other) {
+      return PatternExpression.or(this, other);
+    }
+
+    /**
+     * Negates this node.
+     *
+     * @return {@code NOT this}
+     */
+    public Node negate() {
+      return PatternExpression.not(this);
+    }
+
+    @Override
+    public String toString() {
+      switch (op) {
+        case OP_MATCHES:
+          return "matches(/" + pattern.pattern() + "/)";
+        case OP_FIND:
+          return "find(/" + pattern.pattern() + "/)";
+        case OP_CONTAINS:
+          return "contains(\"" + literal + "\")";
+        case OP_STARTS_WITH:
+          return "startsWith(\"" + literal + "\")";
+        case OP_ENDS_WITH:
+          return "endsWith(\"" + literal + "\")";
+        case OP_LENGTH:
+          return "length[" + min + ".." + (max < 0 ? "" : String.valueOf(max)) + "]";
+        case OP_NOT:
+          return "NOT " + children.get(0);
+        default:
+          StringBuilder sb = new StringBuilder("(");
+          for (int i = 0; i < children.size(); i++) {
+            if (i > 0) {
+              sb.append(op == OP_AND ? " AND " : " OR ");
+            }
+            sb.append(children.get(i));
+          }
+          return sb.append(')').toString();
+      }
+    }
+  }
+
+  // ========== Expression Nodes ==========
+
+  /**
+   * True if the whole input matches the pattern.
+   *
+   * @param pattern compiled pattern
+   * @return pattern node
+   * @throws NullPointerException if pattern is null
+   */
+  public static Node matches(Pattern pattern) {
+    Objects.requireNonNull(pattern, "pattern cannot be null");
+    return new Node(OP_MATCHES, pattern, null, 0, 0, null);
+  }
+
+  /**
+   * True if the pattern matches anywhere in the input.
+   *
+   * @param pattern compiled pattern
+   * @return pattern node
+   * @throws NullPointerException if pattern is null
+   */
+  public static Node find(Pattern pattern) {
+    Objects.requireNonNull(pattern, "pattern cannot be null");
+    return new Node(OP_FIND, pattern, null, 0, 0, null);
+  }
+
+  /**
+   * True if the input contains the literal.
+   *
+   * @param literal text to look for
+   * @return literal node
+   * @throws NullPointerException if literal is null
+   */
+  public static Node contains(String literal) {
+    return literal(OP_CONTAINS, literal);
+  }
+
+  /**
+   * True if the input starts with the literal.
+   *
+   * @param literal expected prefix
+   * @return literal node
+   * @throws NullPointerException if literal is null
+   */
+  public static Node startsWith(String literal) {
+    return literal(OP_STARTS_WITH, literal);
+  }
+
+  /**
+   * True if the input ends with the literal.
+   *
+   * @param literal expected suffix
+   * @return literal node
+   * @throws NullPointerException if literal is null
+   */
+  public static Node endsWith(String literal) {
+    return literal(OP_ENDS_WITH, literal);
+  }
+
+  /**
+   * True if the input is between min and max UTF-8 bytes long (inclusive).
+   *
+   * @param min minimum length in bytes
+   * @param max maximum length in bytes
+   * @return length node
+   * @throws IllegalArgumentException if min is negative or max is less than min
+   */
+  public static Node lengthBetween(int min, int max) {
+    if (min < 0 || max < min) {
+      throw new IllegalArgumentException("Invalid length bounds: [" + min + ", " + max + "]");
+    }
+    return new Node(OP_LENGTH, null, null, min, max, null);
+  }
+
+  /**
+   * True if the input is at least min UTF-8 bytes long.
+   *
+   * @param min minimum length in bytes
+   * @return length node
+   * @throws IllegalArgumentException if min is negative
+   */
+  public static Node lengthAtLeast(int min) {
+    if (min < 0) {
+      throw new IllegalArgumentException("Minimum length must not be negative: " + min);
+    }
+    return new Node(OP_LENGTH, null, null, min, -1, null);
+  }
+
+  /**
+   * True if the input is at most max UTF-8 bytes long.
+   *
+   * @param max maximum length in bytes
+   * @return length node
+   * @throws IllegalArgumentException if max is negative
+   */
+  public static Node lengthAtMost(int max) {
+    return lengthBetween(0, max);
+  }
+
+  /**
+   * True if every operand is true. Operands may be evaluated in any order.
+   *
+   * @param operands one or more operands
+   * @return AND node
+   * @throws NullPointerException if operands or any operand is null
+   * @throws IllegalArgumentException if there are no operands
+   */
+  public static Node and(Node... operands) {
+    return operator(OP_AND, operands);
+  }
+
+  /**
+   * True if any operand is true. Operands may be evaluated in any order.
+   *
+   * @param operands one or more operands
+   * @return OR node
+   * @throws NullPointerException if operands or any operand is null
+   * @throws IllegalArgumentException if there are no operands
+   */
+  public static Node or(Node... operands) {
+    return operator(OP_OR, operands);
+  }
+
+  /**
+   * True if the operand is false.
+   *
+   * @param operand operand to negate
+   * @return NOT node
+   * @throws NullPointerException if operand is null
+   */
+  public static Node not(Node operand) {
+    Objects.requireNonNull(operand, "operand cannot be null");
+    return new Node(OP_NOT, null, null, 0, 0, List.of(operand));
+  }
+
+  private static Node literal(int op, String literal) {
+    Objects.requireNonNull(literal, "literal cannot be null");
+    return new Node(op, null, literal, 0, 0, null);
+  }
+
+  private static Node operator(int op, Node... operands) {
+    Objects.requireNonNull(operands, "operands cannot be null");
+    if (operands.length == 0) {
+      throw new IllegalArgumentException("At least one operand is required");
+    }
+    for (int i = 0; i < operands.length; i++) {
+      Objects.requireNonNull(operands[i], "operand " + i + " is null");
+    }
+    return new Node(op, null, null, 0, 0, List.of(operands));
+  }
+
+  // ========== Compiled Expression ==========
+
+  private final Node root;
+  private final IRE2Native jni;
+  private final long handle;
+  private final int[] program;
+  private final List<Node> leaves;
+  private final List<Pattern> patterns;
+  private final AtomicBoolean closed = new AtomicBoolean(false);
+
+  private PatternExpression(
+      Node root,
+      IRE2Native jni,
+      long handle,
+      int[] program,
+      List<Node> leaves,
+      List<Pattern> patterns) {
+    this.root = root;
+    this.jni = jni;
+    this.handle = handle;
+    this.program = program;
+    this.leaves = leaves;
+    this.patterns = patterns;
+  }
+
+  /**
+   * Compiles an expression tree for native evaluation.
+   *
+   * <p>Nested ANDs and ORs are flattened ({@code and(and(a, b), c)} is {@code and(a, b, c)}) so
+   * that all their operands are reordered together.
+   *
+   * @param root expression tree
+   * @return compiled expression (must be closed)
+   * @throws NullPointerException if root is null
+   * @throws IllegalArgumentException if the tree is nested more than 64 levels deep
+   * @throws IllegalStateException if a pattern in the tree is closed
+   * @throws ResourceException if a pattern already has its maximum number of users
+   * @throws NativeLibraryException if native compilation fails
+   */
+  public static PatternExpression compile(Node root) {
+    Objects.requireNonNull(root, "root cannot be null");
+
+    Encoder encoder = new Encoder();
+    encoder.encode(root, 0);
+    int[] program = encoder.program();
+
+    List<Pattern> patterns = new ArrayList<>(encoder.patterns.keySet());
+    long[] handles = new long[patterns.size()];
+    List<Pattern> acquired = new ArrayList<>();
+    try {
+      for (Pattern pattern : patterns) {
+        handles[encoder.patterns.get(pattern)] = pattern.getNativeHandle();
+        pattern.incrementRefCount();
+        acquired.add(pattern);
+      }
+
+      IRE2Native jni = RE2Native.INSTANCE;
+      long handle = jni.compileExpression(program, handles, encoder.literals.toByteArray());
+      if (handle == 0) {
+        throw new NativeLibraryException("Failed to compile expression: " + jni.getError());
+      }
+      acquired.clear();
+      return new PatternExpression(
+          root, jni, handle, program, encoder.leaves, Collections.unmodifiableList(patterns));
+    } finally {
+      // Release references taken before a failure
+      for (Pattern pattern : acquired) {
+        pattern.decrementRefCount();
+      }
+    }
+  }
+
+  /** Flattens and encodes a tree as preorder (op, a, b) triples. */
+  private static final class Encoder {
+    private int[] triples = new int[48];
+    private int count;
+    private final List<Node> leaves = new ArrayList<>();
+    private final Map<Pattern, Integer> patterns = new IdentityHashMap<>();
+    private final ByteArrayOutputStream literals = new ByteArrayOutputStream();
+
+    void encode(Node node, int depth) {
+      if (depth >= MAX_DEPTH) {
+        throw new IllegalArgumentException(
+            "Expression nested deeper than " + MAX_DEPTH + " levels");
+      }
+      switch (node.op) {
+        case OP_MATCHES:
+        case OP_FIND:
+          Integer index = patterns.computeIfAbsent(node.pattern, p -> patterns.size());
+          emit(node.op, index, 0, node);
+          break;
+        case OP_CONTAINS:
+        case OP_STARTS_WITH:
+        case OP_ENDS_WITH:
+          byte[] bytes = node.literal.getBytes(StandardCharsets.UTF_8);
+          emit(node.op, literals.size(), bytes.length, node);
+          literals.writeBytes(bytes);
+          break;
+        case OP_LENGTH:
+          emit(node.op, node.min, node.max, node);
+          break;
+        case OP_NOT:
+          emit(OP_NOT, 1, 0, null);
+          encode(node.children.get(0), depth + 1);
+          break;
+        default:
+          List<Node> operands = new ArrayList<>();
+          flatten(node.op, node, operands);
+          encodeGroup(node.op, operands, depth);
+          break;
+      }
+    }
+
+    private static void flatten(int op, Node node, List<Node> operands) {
+      for (Node child : node.children) {
+        if (child.op == op) {
+          flatten(op, child, operands);
+        } else {
+          operands.add(child);
+        }
+      }
+    }
+
+    private void encodeGroup(int op, List<Node> operands, int depth) {
+      if (operands.size() == 1) {
+        encode(operands.get(0), depth);
+        return;
+      }
+      if (depth >= MAX_DEPTH) {
+        throw new IllegalArgumentException(
+            "Expression nested deeper than " + MAX_DEPTH + " levels");
+      }
+      if (operands.size() <= MAX_CHILDREN) {
+        emit(op, operands.size(), 0, null);
+        for (Node operand : operands) {
+          encode(operand, depth + 1);
+        }
+        return;
+      }
+
+      // Too wide for one native node: split into MAX_CHILDREN nested groups of the same op
+      int groupSize = (operands.size() + MAX_CHILDREN - 1) / MAX_CHILDREN;
+      int groups = (operands.size() + groupSize - 1) / groupSize;
+      emit(op, groups, 0, null);
+      for (int start = 0; start < operands.size(); start += groupSize) {
+        int end = Math.min(operands.size(), start + groupSize);
+        encodeGroup(op, operands.subList(start, end), depth + 1);
+      }
+    }
+
+    private void emit(int op, int a, int b, Node leaf) {
+      if (3 * count + 3 > triples.length) {
+        triples = Arrays.copyOf(triples, triples.length * 2);
+      }
+      triples[3 * count] = op;
+      triples[3 * count + 1] = a;
+      triples[3 * count + 2] = b;
+      leaves.add(leaf);
+      count++;
+    }
+
+    int[] program() {
+      return Arrays.copyOf(triples, 3 * count);
+    }
+  }
+
+  // ========== Evaluation ==========
+
+  /**
+   * Evaluates the expression against a String.
+   *
+   * @param input text to test
+   * @return true if the expression holds for the input
+   * @throws NullPointerException if input is null
+   * @throws IllegalStateException if the expression is closed
+   */
+  public boolean test(String input) {
+    Objects.requireNonNull(input, "input cannot be null");
+    checkNotClosed();
+
+    long startNanos = System.nanoTime();
+    boolean result = jni.evaluateExpression(handle, input);
+    recordOperations(1, System.nanoTime() - startNanos);
+    return result;
+  }
+
+  /**
+   * Evaluates the expression against off-heap memory (zero-copy).
+   *
+   * <p><strong>Memory Safety:</strong> The memory must remain valid for the duration of this
+   * call.
+   *
+   * @param address native memory address of UTF-8 text
+   * @param length number of bytes
+   * @return true if the expression holds for the input
+   * @throws IllegalArgumentException if address is 0 or length is negative
+   * @throws IllegalStateException if the expression is closed
+   */
+  public boolean test(long address, int length) {
+    checkNotClosed();
+    if (address == 0) {
+      throw new IllegalArgumentException("Address must not be 0");
+    }
+    if (length < 0) {
+      throw new IllegalArgumentException("Length must not be negative: " + length);
+    }
+
+    long startNanos = System.nanoTime();
+    boolean result = jni.evaluateExpressionDirect(handle, address, length);
+    recordOperations(1, System.nanoTime() - startNanos);
+    return result;
+  }
+
+  /**
+   * Evaluates the expression against a buffer's bytes from position to limit. Direct buffers are
+   * passed by address; heap buffers are copied once into a reused direct scratch buffer. The
+   * position is not moved.
+   *
+   * @param buffer UTF-8 input
+   * @return true if the expression holds for the input
+   * @throws NullPointerException if buffer is null
+   * @throws IllegalStateException if the expression is closed
+   */
+  public boolean test(ByteBuffer buffer) {
+    Objects.requireNonNull(buffer, "buffer cannot be null");
+    checkNotClosed();
+
+    if (buffer.isDirect()) {
+      long address = ((DirectBuffer) buffer).address() + buffer.position();
+      boolean result = evaluateDirect(address, buffer.remaining());
+      java.lang.ref.Reference.reachabilityFence(buffer);
+      return result;
+    }
+
+    DirectBatch batch = DirectBatch.of(new ByteBuffer[] {buffer});
+    boolean result = evaluateDirect(batch.addresses[0], batch.lengths[0]);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    return result;
+  }
+
+  private boolean evaluateDirect(long address, int length) {
+    long startNanos = System.nanoTime();
+    // An empty buffer may have no backing address; only length predicates can see it
+    boolean result =
+        address == 0
+            ? jni.evaluateExpression(handle, "")
+            : jni.evaluateExpressionDirect(handle, address, length);
+    recordOperations(1, System.nanoTime() - startNanos);
+    return result;
+  }
+
+  /**
+   * Evaluates the expression against each String in one native call.
+   *
+   * @param inputs texts to test (null elements are false)
+   * @return results parallel to inputs
+   * @throws NullPointerException if inputs is null
+   * @throws IllegalStateException if the expression is closed
+   * @throws NativeLibraryException if the native call fails
+   */
+  public boolean[] testAll(String[] inputs) {
+    Objects.requireNonNull(inputs, "inputs cannot be null");
+    checkNotClosed();
+    if (inputs.length == 0) {
+      return new boolean[0];
+    }
+
+    long startNanos = System.nanoTime();
+    boolean[] results = jni.evaluateExpressionBulk(handle, inputs);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (results == null) {
+      throw new NativeLibraryException("Failed to evaluate expression: " + jni.getError());
+    }
+    recordBulkOperations(inputs.length, durationNanos);
+    return results;
+  }
+
+  /**
+   * Evaluates the expression against each off-heap input in one native call (zero-copy).
+   *
+   * <p><strong>Memory Safety:</strong> All memory regions must remain valid for the duration of
+   * this call.
+   *
+   * @param addresses native memory addresses of UTF-8 inputs
+   * @param lengths byte lengths (must be same length as addresses)
+   * @return results parallel to the inputs (address 0 is false)
+   * @throws NullPointerException if addresses or lengths is null
+   * @throws IllegalArgumentException if arrays have different lengths
+   * @throws IllegalStateException if the expression is closed
+   * @throws NativeLibraryException if the native call fails
+   */
+  public boolean[] testAll(long[] addresses, int[] lengths) {
+    Objects.requireNonNull(addresses, "addresses cannot be null");
+    Objects.requireNonNull(lengths, "lengths cannot be null");
+    checkNotClosed();
+    if (addresses.length != lengths.length) {
+      throw new IllegalArgumentException(
+          "Address and length arrays must have same size: addresses="
+              + addresses.length
+              + ", lengths="
+              + lengths.length);
+    }
+    if (addresses.length == 0) {
+      return new boolean[0];
+    }
+
+    long startNanos = System.nanoTime();
+    boolean[] results = jni.evaluateExpressionDirectBulk(handle, addresses, lengths);
+    long durationNanos = System.nanoTime() - startNanos;
+    if (results == null) {
+      throw new NativeLibraryException("Failed to evaluate expression: " + jni.getError());
+    }
+    recordBulkOperations(addresses.length, durationNanos);
+    return results;
+  }
+
+  /**
+   * Evaluates the expression against each buffer in one native call. Heap and direct buffers are
+   * routed per element as in {@link Pattern#matchAll(ByteBuffer[])}; positions are not moved.
+   *
+   * @param buffers UTF-8 inputs (read from position to limit; null elements are false)
+   * @return results parallel to buffers
+   * @throws NullPointerException if buffers is null
+   * @throws IllegalStateException if the expression is closed
+   * @throws NativeLibraryException if the native call fails
+   */
+  public boolean[] testAll(ByteBuffer[] buffers) {
+    Objects.requireNonNull(buffers, "buffers cannot be null");
+    checkNotClosed();
+
+    DirectBatch batch = DirectBatch.of(buffers);
+    boolean[] results = testAll(batch.addresses, batch.lengths);
+    java.lang.ref.Reference.reachabilityFence(batch);
+    java.lang.ref.Reference.reachabilityFence(buffers);
+    return results;
+  }
+
+  // ========== Introspection ==========
+
+  /**
+   * Describes the current evaluation plan: one line per node, AND/OR operands in the order they
+   * are currently evaluated, each with its sampled true rate and average cost.
+   *
+   * <pre>
+   * OR [sampled 1024, true 12.5%, 180 ns]
+   *   startsWith("FATAL") [sampled 1024, true 0.1%, 25 ns]
+   *   AND [sampled 1023, true 12.4%, 150 ns]
+   *     ...
+   * </pre>
+   *
+   * @return multi-line plan
+   * @throws IllegalStateException if the expression is closed
+   * @throws NativeLibraryException if the native call fails
+   */
+  public String plan() {
+    checkNotClosed();
+    long[] stats = jni.expressionStats(handle);
+    if (stats == null || stats.length != program.length / 3 * 4) {
+      throw new NativeLibraryException("Failed to read expression statistics: " + jni.getError());
+    }
+
+    StringBuilder sb = new StringBuilder();
+    describe(sb, stats, new int[] {0}, 0);
+    return sb.toString();
+  }
+
+  /** Appends the node at cursor (and its subtree, in evaluation order); advances cursor. */
+  private void describe(StringBuilder sb, long[] stats, int[] cursor, int indent) {
+    int index = cursor[0]++;
+    int op = program[3 * index];
+    int childCount = program[3 * index + 1];
+
+    StringBuilder line = new StringBuilder("  ".repeat(indent));
+    if (op == OP_AND || op == OP_OR || op == OP_NOT) {
+      line.append(op == OP_AND ? "AND" : op == OP_OR ? "OR" : "NOT");
+    } else {
+      line.append(leaves.get(index));
+    }
+    long samples = stats[4 * index];
+    if (samples == 0) {
+      line.append(" [not sampled]");
+    } else {
+      line.append(
+          String.format(
+              " [sampled %d, true %.1f%%, %d ns]",
+              samples,
+              100.0 * stats[4 * index + 1] / samples,
+              stats[4 * index + 2] / samples));
+    }
+    sb.append(line).append('\n');
+
+    if (op != OP_AND && op != OP_OR && op != OP_NOT) {
+      return;
+    }
+
+    // Children follow in declaration order; render each, then emit in evaluation order
+    String[] children = new String[childCount];
+    for (int i = 0; i < childCount; i++) {
+      StringBuilder child = new StringBuilder();
+      describe(child, stats, cursor, indent + 1);
+      children[i] = child.toString();
+    }
+    long order = stats[4 * index + 3];
+    for (int i = 0; i < childCount; i++) {
+      int child = op == OP_NOT ? 0 : (int) ((order >>> (4 * i)) & 0xF);
+      sb.append(children[child]);
+    }
+  }
+
+  /**
+   * Gets the patterns referenced by this expression.
+   *
+   * @return distinct patterns, in first-use order
+   */
+  public List<Pattern> patterns() {
+    return patterns;
+  }
+
+  public boolean isClosed() {
+    return closed.get();
+  }
+
+  /** Frees the native expression and releases the pattern references. Idempotent. */
+  @Override
+  public void close() {
+    if (closed.compareAndSet(false, true)) {
+      jni.freeExpression(handle);
+      for (Pattern pattern : patterns) {
+        pattern.decrementRefCount();
+      }
+    }
+  }
+
+  @Override
+  public String toString() {
+    return root.toString();
+  }
+
+  private void checkNotClosed() {
+    if (closed.get()) {
+      throw new IllegalStateException("RE2: PatternExpression is closed");
+    }
+  }
+
+  private static void recordOperations(int count, long durationNanos) {
+    RE2MetricsRegistry metrics = Pattern.getGlobalCache().getConfig().metricsRegistry();
+    metrics.incrementCounter(MetricNames.MATCHING_OPERATIONS, count);
+    metrics.recordTimer(MetricNames.MATCHING_LATENCY, durationNanos / count);
+  }
+
+  private static void recordBulkOperations(int count, long durationNanos) {
+    recordOperations(count, durationNanos);
+    RE2MetricsRegistry metrics = Pattern.getGlobalCache().getConfig().metricsRegistry();
+    metrics.incrementCounter(MetricNames.MATCHING_BULK_OPERATIONS);
+    metrics.incrementCounter(MetricNames.MATCHING_BULK_ITEMS, count);
+  }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+
+/**
+ * Frees closed uncached patterns off the closing thread.
+ *
+ * <p>{@link Pattern#close()} only marks a pattern closed. Once the last reference holder ({@link
+ * Matcher}, {@link PatternExpression}, {@link AsyncMatcher}) has released it, the native RE2 -
+ * including any DFA state it has grown, which can take a while to free - is deleted on a single
+ * background daemon thread. Closing never waits for users and never pays for the free.
+ */
+final class PatternReclaimer {
+
+  // Closed patterns still referenced; rechecked whenever one of their references is released
+  private static final Set<Pattern> waiting = ConcurrentHashMap.newKeySet();
+  private static volatile boolean started;
+
+  private PatternReclaimer() {
+    // Utility class
+  }
+
+  /** Started on first use so programs that never close uncached patterns pay nothing. */
+  private static final class Worker {
+    static final ExecutorService EXECUTOR =
+        Executors.newSingleThreadExecutor(
+            r -> {
+              Thread t = new Thread(r, "RE2-Pattern-Reclaimer");
+              t.setDaemon(true);
+              return t;
+            });
+  }
+
+  /**
+   * Schedules the release of a pattern that has just been marked closed: now if it is unused,
+   * otherwise when its last reference is released.
+   */
+  static void submit(Pattern pattern) {
+    waiting.add(pattern);
+    releaseIfUnused(pattern);
+  }
+
+  /**
+   * Hands a waiting pattern to the reclaimer thread if nothing references it any more. Called by
+   * {@link #submit} and whenever a closed pattern's reference count drops to zero; whichever
+   * caller observes zero first removes the pattern, so it is released exactly once.
+   */
+  static void releaseIfUnused(Pattern pattern) {
+    if (pattern.getRefCount() <= 0 && waiting.remove(pattern)) {
+      started = true;
+      Worker.EXECUTOR.execute(pattern::release);
+    }
+  }
+
+  /**
+   * Waits until every release handed to the reclaimer thread so far has run (for testing, so
+   * resource accounting is settled before it is reset).
+   */
+  static void drain() {
+    if (!started) {
+      return;
+    }
+    try {
+      Worker.EXECUTOR.submit(() -> {}).get();
+    } catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+    } catch (ExecutionException e) {
+      throw new IllegalStateException("RE2: Pattern reclaimer failed", e.getCause());
+    }
+  }
+
+  /**
+   * Gets the number of closed patterns waiting for their users to finish.
+   *
+   * @return closed patterns not yet handed to the reclaimer thread
+   */
+  static int waitingCount() {
+    return waiting.size();
+  }
+}
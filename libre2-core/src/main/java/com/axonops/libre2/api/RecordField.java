@@ -0,0 +1,166 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.io.ByteArrayOutputStream;
+import java.nio.charset.StandardCharsets;
+import java.util.Arrays;
+import java.util.Objects;
+
+/**
+ * Selects one field of raw JSON or CSV records for field-aware matching - see {@link
+ * Pattern#matchAllField(RecordField, java.nio.ByteBuffer[])}.
+ *
+ * <pre>{@code
+ * RecordField email = RecordField.json("user.email");
+ * RecordField status = RecordField.csv(3);
+ * BitSet hits = Pattern.compile(".*@example\\.com").matchAllField(email, rows);
+ * }</pre>
+ *
+ * <p><strong>JSON:</strong> each record is one JSON object; the path is a sequence of object keys.
+ * String values are matched without their quotes and with escapes decoded, other scalars as their
+ * literal text ({@code 42}, {@code true}, {@code null}) and objects or arrays as their raw JSON
+ * text. Only the first occurrence of a duplicated key is considered.
+ *
+ * <p><strong>CSV:</strong> each record is one row; the column is 0-based. Quoting follows RFC 4180
+ * (delimiters inside double quotes do not split, {@code ""} is a literal quote) and a trailing line
+ * break is not part of the last field.
+ *
+ * <p>Records without the field, and malformed records, never match.
+ *
+ * <p>Immutable and thread-safe.
+ *
+ * @since 1.3.0
+ */
+public final class RecordField {
+
+  // Record formats - keep in sync with RecordFormat in re2_jni.cpp
+  static final int FORMAT_JSON = 0;
+  static final int FORMAT_CSV = 1;
+
+  private final int format;
+  private final byte[] selector;
+  private final int column;
+  private final String description;
+
+  private RecordField(int format, byte[] selector, int column, String description) {
+    this.format = format;
+    this.selector = selector;
+    this.column = column;
+    this.description = description;
+  }
+
+  /**
+   * Selects a JSON field by dot-separated key path, e.g. {@code "user.email"}.
+   *
+   * @param path object keys separated by {@code '.'}
+   * @return field selector
+   * @throws NullPointerException if path is null
+   * @throws IllegalArgumentException if any key is empty
+   * @see #jsonKeys(String...) for keys containing dots
+   */
+  public static RecordField json(String path) {
+    Objects.requireNonNull(path, "path cannot be null");
+    return jsonKeys(path.split("\\.", -1));
+  }
+
+  /**
+   * Selects a JSON field by its sequence of object keys.
+   *
+   * @param keys object keys from the outermost object inwards
+   * @return field selector
+   * @throws NullPointerException if keys or any key is null
+   * @throws IllegalArgumentException if there are no keys, or a key is empty or contains NUL
+   */
+  public static RecordField jsonKeys(String... keys) {
+    Objects.requireNonNull(keys, "keys cannot be null");
+    if (keys.length == 0) {
+      throw new IllegalArgumentException("JSON path must have at least one key");
+    }
+
+    // Native selector: UTF-8 keys separated by NUL bytes
+    ByteArrayOutputStream selector = new ByteArrayOutputStream();
+    for (int i = 0; i < keys.length; i++) {
+      Objects.requireNonNull(keys[i], "key " + i + " is null");
+      if (keys[i].isEmpty() || keys[i].indexOf('\0') >= 0) {
+        throw new IllegalArgumentException(
+            "Invalid JSON key at index " + i + ": '" + keys[i] + "'");
+      }
+      if (i > 0) {
+        selector.write(0);
+      }
+      selector.writeBytes(keys[i].getBytes(StandardCharsets.UTF_8));
+    }
+    return new RecordField(
+        FORMAT_JSON, selector.toByteArray(), -1, "json" + Arrays.toString(keys));
+  }
+
+  /**
+   * Selects a column of comma-separated rows.
+   *
+   * @param column 0-based column index
+   * @return field selector
+   * @throws IllegalArgumentException if column is negative
+   */
+  public static RecordField csv(int column) {
+    return csv(column, ',');
+  }
+
+  /**
+   * Selects a column of delimited rows.
+   *
+   * @param column 0-based column index
+   * @param delimiter ASCII field delimiter, e.g. {@code '\t'} or {@code ';'}
+   * @return field selector
+   * @throws IllegalArgumentException if column is negative, or delimiter is not ASCII or is a
+   *     quote, line break or NUL
+   */
+  public static RecordField csv(int column, char delimiter) {
+    if (column < 0) {
+      throw new IllegalArgumentException("Column must not be negative: " + column);
+    }
+    if (delimiter == 0
+        || delimiter > 0x7F
+        || delimiter == '"'
+        || delimiter == '\n'
+        || delimiter == '\r') {
+      throw new IllegalArgumentException("Invalid CSV delimiter: " + (int) delimiter);
+    }
+    return new RecordField(
+        FORMAT_CSV,
+        new byte[] {(byte) delimiter},
+        column,
+        "csv[column=" + column + ", delimiter=" + (int) delimiter + "]");
+  }
+
+  int format() {
+    return format;
+  }
+
+  byte[] selector() {
+    return selector;
+  }
+
+  int column() {
+    return column;
+  }
+
+  @Override
+  public String toString() {
+    return description;
+  }
+}
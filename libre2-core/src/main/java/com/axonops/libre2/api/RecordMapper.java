@@ -0,0 +1,361 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import com.axonops.libre2.metrics.MetricNames;
+import com.axonops.libre2.metrics.RE2MetricsRegistry;
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.RecordComponent;
+import java.util.Map;
+import java.util.Objects;
+
+/**
+ * Builds records directly from the named groups of a match - see {@link Pattern#mapper(Class)}.
+ *
+ * <pre>{@code
+ * record Access(String user, int status, long bytes, Double latency) {}
+ *
+ * RecordMapper<Access> mapper = Pattern.compile(
+ *     "(?P<user>\\w+) (?P<status>\\d{3}) (?P<bytes>\\d+)(?: (?P<latency>[\\d.]+))?")
+ *     .mapper(Access.class);
+ * Access access = mapper.match("alice 200 5120 0.25");
+ * }</pre>
+ *
+ * <p>Each record component is bound to the named group of the same name when the mapper is
+ * created, so nothing is looked up per row. A row costs one native call, which matches and parses
+ * numeric components, and the record itself: text components are cut from the input with {@code
+ * substring}, and the components are passed to the canonical constructor through a {@link
+ * MethodHandle} chain composed once per mapper.
+ *
+ * <p>Supported component types:
+ *
+ * <ul>
+ *   <li>{@code String}, {@code CharSequence} - the group text, null if the group did not
+ *       participate
+ *   <li>{@code int}, {@code long}, {@code double} - parsed as by {@link Long#parseLong} / {@link
+ *       Double#parseDouble}; the group must participate
+ *   <li>{@code Integer}, {@code Long}, {@code Double} - as the primitives, null if the group did
+ *       not participate
+ * </ul>
+ *
+ * <p>Thread-safe. The mapper uses the pattern's native handle on every call, so it fails with
+ * {@link IllegalStateException} once the pattern is closed.
+ *
+ * @param <T> record type
+ * @since 1.3.0
+ */
+public final class RecordMapper<T extends Record> {
+
+  // Component kinds - keep in sync with FieldKind in re2_jni.cpp
+  private static final int KIND_TEXT = 0;
+  private static final int KIND_LONG = 1;
+  private static final int KIND_DOUBLE = 2;
+
+  // Native slots per component: start, end (UTF-16), status, value
+  private static final int SLOTS = 4;
+  private static final long STATUS_OK = 0;
+  private static final long STATUS_ABSENT = 1;
+  private static final int MAX_COMPONENTS = 4096;
+
+  private static final MethodHandles.Lookup LOOKUP = MethodHandles.lookup();
+
+  private final Pattern pattern;
+  private final Class<T> recordType;
+  private final int[] fieldSpec;
+  private final MethodHandle factory;
+  private final ThreadLocal<long[]> fields;
+
+  private RecordMapper(
+      Pattern pattern, Class<T> recordType, int[] fieldSpec, MethodHandle factory) {
+    this.pattern = pattern;
+    this.recordType = recordType;
+    this.fieldSpec = fieldSpec;
+    this.factory = factory;
+    int slots = fieldSpec.length / 2 * SLOTS;
+    this.fields = ThreadLocal.withInitial(() -> new long[slots]);
+  }
+
+  /**
+   * Binds each component of a record type to the named group of the same name.
+   *
+   * @throws IllegalArgumentException if a component has no named group, has an unsupported type,
+   *     or the canonical constructor is not accessible
+   */
+  static <T extends Record> RecordMapper<T> create(
+      Pattern pattern, Class<T> recordType, Map<String, Integer> namedGroups) {
+    RecordComponent[] components = recordType.getRecordComponents();
+    if (components == null || components.length == 0 || components.length > MAX_COMPONENTS) {
+      throw new IllegalArgumentException(
+          "Record type must have between 1 and " + MAX_COMPONENTS + " components: " + recordType);
+    }
+
+    int[] fieldSpec = new int[2 * components.length];
+    Class<?>[] types = new Class<?>[components.length];
+    MethodHandle[] extractors = new MethodHandle[components.length];
+    for (int i = 0; i < components.length; i++) {
+      String name = components[i].getName();
+      Integer group = namedGroups.get(name);
+      if (group == null) {
+        throw new IllegalArgumentException(
+            "Record component '"
+                + name
+                + "' of "
+                + recordType.getName()
+                + " has no named group of the same name in pattern: "
+                + pattern.pattern());
+      }
+      types[i] = components[i].getType();
+      fieldSpec[2 * i] = group;
+      fieldSpec[2 * i + 1] = kindOf(types[i], name);
+      extractors[i] = extractor(types[i], name, i);
+    }
+
+    MethodHandle constructor;
+    try {
+      Constructor<T> canonical = recordType.getDeclaredConstructor(types);
+      canonical.setAccessible(true);
+      constructor = LOOKUP.unreflectConstructor(canonical);
+    } catch (ReflectiveOperationException | RuntimeException e) {
+      throw new IllegalArgumentException(
+          "Cannot access the canonical constructor of " + recordType.getName(), e);
+    }
+
+    // (C0, ..., Cn-1) -> T becomes (String, long[]) -> T: each component is computed by its
+    // extractor from the same (input, fields) pair. Collecting from the last parameter keeps the
+    // positions of the earlier ones stable.
+    MethodHandle factory = constructor;
+    for (int i = components.length - 1; i >= 0; i--) {
+      factory = MethodHandles.collectArguments(factory, i, extractors[i]);
+    }
+    int[] reorder = new int[2 * components.length];
+    for (int i = 0; i < components.length; i++) {
+      reorder[2 * i + 1] = 1;
+    }
+    factory =
+        MethodHandles.permuteArguments(
+            factory, MethodType.methodType(recordType, String.class, long[].class), reorder);
+    factory = factory.asType(MethodType.methodType(Object.class, String.class, long[].class));
+
+    return new RecordMapper<>(pattern, recordType, fieldSpec, factory);
+  }
+
+  private static int kindOf(Class<?> type, String name) {
+    if (type == String.class || type == CharSequence.class) {
+      return KIND_TEXT;
+    }
+    if (type == int.class || type == long.class || type == Integer.class || type == Long.class) {
+      return KIND_LONG;
+    }
+    if (type == double.class || type == Double.class) {
+      return KIND_DOUBLE;
+    }
+    throw new IllegalArgumentException(
+        "Unsupported type "
+            + type.getName()
+            + " for record component '"
+            + name
+            + "' (supported: String, CharSequence, int, long, double and their wrappers)");
+  }
+
+  /** (String input, long[] fields) -> component value, for the component at index. */
+  private static MethodHandle extractor(Class<?> type, String name, int index) {
+    String method;
+    Class<?> returnType = type;
+    if (type == String.class || type == CharSequence.class) {
+      method = "text";
+      returnType = String.class;
+    } else if (type == int.class) {
+      method = "intValue";
+    } else if (type == Integer.class) {
+      method = "boxedInt";
+    } else if (type == long.class) {
+      method = "longValue";
+    } else if (type == Long.class) {
+      method = "boxedLong";
+    } else if (type == double.class) {
+      method = "doubleValue";
+    } else {
+      method = "boxedDouble";
+    }
+
+    try {
+      MethodHandle handle =
+          LOOKUP.findStatic(
+              RecordMapper.class,
+              method,
+              MethodType.methodType(
+                  returnType, String.class, int.class, String.class, long[].class));
+      return MethodHandles.insertArguments(handle, 0, name, index)
+          .asType(MethodType.methodType(type, String.class, long[].class));
+    } catch (ReflectiveOperationException e) {
+      throw new IllegalStateException("RE2: Missing record mapper extractor " + method, e);
+    }
+  }
+
+  // ========== Mapping ==========
+
+  /**
+   * Builds a record if the entire input matches.
+   *
+   * @param input text to match
+   * @return record built from the named groups, or null if the input does not match
+   * @throws NullPointerException if input is null
+   * @throws IllegalStateException if the pattern is closed
+   * @throws NumberFormatException if a numeric group is not a valid number
+   * @throws IllegalArgumentException if a group behind a primitive component did not participate
+   */
+  public T match(String input) {
+    return map(input, true);
+  }
+
+  /**
+   * Builds a record from the first match anywhere in the input.
+   *
+   * @param input text to search
+   * @return record built from the named groups, or null if there is no match
+   * @throws NullPointerException if input is null
+   * @throws IllegalStateException if the pattern is closed
+   * @throws NumberFormatException if a numeric group is not a valid number
+   * @throws IllegalArgumentException if a group behind a primitive component did not participate
+   */
+  public T find(String input) {
+    return map(input, false);
+  }
+
+  private T map(String input, boolean fullMatch) {
+    Objects.requireNonNull(input, "input cannot be null");
+    long handle = pattern.getNativeHandle();
+    long[] slots = fields.get();
+
+    long startNanos = System.nanoTime();
+    int status = pattern.jni.mapFields(handle, input, fullMatch, fieldSpec, slots);
+    long durationNanos = System.nanoTime() - startNanos;
+
+    RE2MetricsRegistry metrics = Pattern.getGlobalCache().getConfig().metricsRegistry();
+    metrics.incrementCounter(MetricNames.CAPTURE_OPERATIONS);
+    metrics.recordTimer(MetricNames.CAPTURE_LATENCY, durationNanos);
+    metrics.incrementCounter(MetricNames.CAPTURE_STRING_OPERATIONS);
+    metrics.recordTimer(MetricNames.CAPTURE_STRING_LATENCY, durationNanos);
+    pattern.recordCaptureInput(
+        metrics,
+        MetricNames.CAPTURE_STRING_BYTES,
+        MetricNames.CAPTURE_STRING_INPUT_LENGTH,
+        input.length());
+
+    if (status < 0) {
+      throw new NativeLibraryException("Failed to map fields: " + pattern.jni.getError());
+    }
+    if (status == 0) {
+      return null;
+    }
+
+    try {
+      return recordType.cast((Object) factory.invokeExact(input, slots));
+    } catch (RuntimeException | Error e) {
+      throw e;
+    } catch (Throwable t) {
+      throw new IllegalStateException("RE2: Record constructor failed", t);
+    }
+  }
+
+  /**
+   * Gets the record type built by this mapper.
+   *
+   * @return record class
+   */
+  public Class<T> recordType() {
+    return recordType;
+  }
+
+  @Override
+  public String toString() {
+    return "RecordMapper[" + recordType.getName() + " <- /" + pattern.pattern() + "/]";
+  }
+
+  // ========== Component Extractors ==========
+  // Bound to (name, index) per component; name is only used in error messages.
+
+  private static String text(String name, int index, String input, long[] fields) {
+    int slot = index * SLOTS;
+    if (fields[slot] < 0) {
+      return null;
+    }
+    return input.substring((int) fields[slot], (int) fields[slot + 1]);
+  }
+
+  private static long longValue(String name, int index, String input, long[] fields) {
+    int slot = index * SLOTS;
+    long status = fields[slot + 2];
+    if (status == STATUS_OK) {
+      return fields[slot + 3];
+    }
+    if (status == STATUS_ABSENT) {
+      throw absent(name);
+    }
+    // Not parsed natively (non-ASCII digits, overflow, malformed): Java decides
+    return Long.parseLong(input, (int) fields[slot], (int) fields[slot + 1], 10);
+  }
+
+  private static Long boxedLong(String name, int index, String input, long[] fields) {
+    if (fields[index * SLOTS + 2] == STATUS_ABSENT) {
+      return null;
+    }
+    return longValue(name, index, input, fields);
+  }
+
+  private static int intValue(String name, int index, String input, long[] fields) {
+    long value = longValue(name, index, input, fields);
+    if ((int) value != value) {
+      throw new NumberFormatException("Value of group '" + name + "' out of int range: " + value);
+    }
+    return (int) value;
+  }
+
+  private static Integer boxedInt(String name, int index, String input, long[] fields) {
+    if (fields[index * SLOTS + 2] == STATUS_ABSENT) {
+      return null;
+    }
+    return intValue(name, index, input, fields);
+  }
+
+  private static double doubleValue(String name, int index, String input, long[] fields) {
+    int slot = index * SLOTS;
+    long status = fields[slot + 2];
+    if (status == STATUS_OK) {
+      return Double.longBitsToDouble(fields[slot + 3]);
+    }
+    if (status == STATUS_ABSENT) {
+      throw absent(name);
+    }
+    return Double.parseDouble(input.substring((int) fields[slot], (int) fields[slot + 1]));
+  }
+
+  private static Double boxedDouble(String name, int index, String input, long[] fields) {
+    if (fields[index * SLOTS + 2] == STATUS_ABSENT) {
+      return null;
+    }
+    return doubleValue(name, index, input, fields);
+  }
+
+  private static IllegalArgumentException absent(String name) {
+    return new IllegalArgumentException(
+        "Group '" + name + "' did not participate in the match (primitive component)");
+  }
+}
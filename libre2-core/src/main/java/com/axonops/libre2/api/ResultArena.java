@@ -0,0 +1,136 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.CharBuffer;
+import java.nio.charset.CharsetEncoder;
+import java.nio.charset.CodingErrorAction;
+import java.nio.charset.StandardCharsets;
+import sun.nio.ch.DirectBuffer;
+
+/**
+ * Per-thread off-heap memory behind {@link MatchView}: a result region native code writes match
+ * offsets into, and an input region for Strings and heap buffers that must be copied off-heap.
+ *
+ * <p>Both regions are reused while they stay under their retention limits; a larger result or
+ * input gets a one-off buffer that lives until the next call on the thread. Only the owning
+ * thread touches its arena.
+ */
+final class ResultArena {
+
+  /** Result ints allocated up front per thread. */
+  static final int INITIAL_RESULT_INTS = 1024;
+
+  /** Largest result region kept per thread. */
+  static final int MAX_RETAINED_RESULT_INTS = 1 << 18;
+
+  /** Largest input region kept per thread. */
+  static final int MAX_RETAINED_INPUT_BYTES = 1 << 20;
+
+  private static final ThreadLocal<ResultArena> ARENA = ThreadLocal.withInitial(ResultArena::new);
+
+  final MatchView view = new MatchView();
+
+  private ByteBuffer results;
+  private ByteBuffer input;
+  private final CharsetEncoder encoder =
+      StandardCharsets.UTF_8
+          .newEncoder()
+          .onMalformedInput(CodingErrorAction.REPLACE)
+          .onUnmappableCharacter(CodingErrorAction.REPLACE);
+
+  private ResultArena() {
+    this.results = ByteBuffer.allocateDirect(INITIAL_RESULT_INTS * Integer.BYTES);
+    this.results.order(ByteOrder.nativeOrder());
+  }
+
+  static ResultArena current() {
+    return ARENA.get();
+  }
+
+  /**
+   * Gets a result region of at least the given size.
+   *
+   * @param ints minimum capacity in ints
+   * @return native-order, int-aligned direct buffer
+   */
+  ByteBuffer results(int ints) {
+    long bytes = (long) ints * Integer.BYTES;
+    if (results.capacity() >= bytes) {
+      return results;
+    }
+    if (bytes > Integer.MAX_VALUE) {
+      throw new IllegalArgumentException("Result too large for an arena: " + ints + " ints");
+    }
+    ByteBuffer grown = ByteBuffer.allocateDirect((int) bytes).order(ByteOrder.nativeOrder());
+    if (ints <= MAX_RETAINED_RESULT_INTS) {
+      results = grown;
+    }
+    return grown;
+  }
+
+  /** Gets the retained result region (at least {@link #INITIAL_RESULT_INTS}). */
+  ByteBuffer results() {
+    return results;
+  }
+
+  /**
+   * Copies a String off-heap as UTF-8.
+   *
+   * @param text text to encode
+   * @return direct buffer holding the bytes from position 0 to limit
+   */
+  ByteBuffer encode(String text) {
+    // Three bytes per UTF-16 unit covers every code point (surrogate pairs need four per two)
+    ByteBuffer target = input((int) Math.min(Integer.MAX_VALUE, 3L * text.length()));
+    encoder.reset();
+    encoder.encode(CharBuffer.wrap(text), target, true);
+    encoder.flush(target);
+    return target.flip();
+  }
+
+  /**
+   * Copies a heap buffer's remaining bytes off-heap without moving its position.
+   *
+   * @param buffer heap buffer
+   * @return direct buffer holding the bytes from position 0 to limit
+   */
+  ByteBuffer copy(ByteBuffer buffer) {
+    ByteBuffer target = input(buffer.remaining());
+    target.put(buffer.duplicate());
+    return target.flip();
+  }
+
+  static long address(ByteBuffer direct) {
+    return ((DirectBuffer) direct).address();
+  }
+
+  private ByteBuffer input(int bytes) {
+    if (bytes > MAX_RETAINED_INPUT_BYTES) {
+      return ByteBuffer.allocateDirect(bytes);
+    }
+    if (input == null || input.capacity() < bytes) {
+      // Round up so slowly growing inputs do not reallocate every call
+      int capacity = Integer.highestOneBit(Math.max(bytes, 256) - 1) << 1;
+      input = ByteBuffer.allocateDirect(Math.min(capacity, MAX_RETAINED_INPUT_BYTES));
+    }
+    input.clear();
+    return input;
+  }
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.api;
+
+import java.util.Objects;
+
+/**
+ * Field boundaries of one or more inputs split around a pattern - returned by {@link
+ * Pattern#split(String)} and {@link Pattern#splitBulk(String[])}.
+ *
+ * <p>The split runs natively and comes back as primitive offsets: a field count per input plus a
+ * start/end pair per field. No Strings are created until a field is read, so tokenising a batch of
+ * delimited records and reading two columns creates two Strings per record, not one per field.
+ *
+ * <pre>{@code
+ * Pattern comma = Pattern.compile("\\s*,\\s*");
+ * SplitResult rows = comma.splitBulk(csvLines);
+ * for (int row = 0; row < rows.inputCount(); row++) {
+ *     if (rows.fieldCount(row) > 2) {
+ *         String id = rows.field(row, 0);
+ *         String status = rows.field(row, 2);
+ *     }
+ * }
+ * }</pre>
+ *
+ * <p>For String inputs offsets are char indexes, as for {@link String#substring(int, int)}. For
+ * zero-copy inputs they are byte offsets relative to each input's address, and fields cannot be
+ * projected to Strings by this class ({@link #hasText()} is false).
+ *
+ * <p>Immutable and thread-safe.
+ *
+ * @since 1.3.0
+ */
+public final class SplitResult {
+
+  private final String[] sources;
+  private final int[] packed;
+  private final int[] firstField;
+
+  private SplitResult(String[] sources, int[] packed, int[] firstField) {
+    this.sources = sources;
+    this.packed = packed;
+    this.firstField = firstField;
+  }
+
+  /**
+   * Builds a result from the native layout {@code { fieldCount per input, start, end, ... }}.
+   *
+   * @param packed native split result
+   * @param inputCount number of inputs split
+   * @param sources the String inputs, or null for zero-copy inputs
+   */
+  static SplitResult fromNative(int[] packed, int inputCount, String[] sources) {
+    if (packed.length < inputCount) {
+      throw new NativeLibraryException(
+          "Split result has " + packed.length + " entries for " + inputCount + " inputs");
+    }
+    int[] firstField = new int[inputCount + 1];
+    for (int i = 0; i < inputCount; i++) {
+      firstField[i + 1] = firstField[i] + packed[i];
+    }
+    if (packed.length != inputCount + 2L * firstField[inputCount]) {
+      throw new NativeLibraryException(
+          "Split result length " + packed.length + " does not match its field counts");
+    }
+    return new SplitResult(sources, packed, firstField);
+  }
+
+  /**
+   * Gets the number of inputs that were split.
+   *
+   * @return input count
+   */
+  public int inputCount() {
+    return firstField.length - 1;
+  }
+
+  /**
+   * Gets the number of fields in an input (0 for null inputs).
+   *
+   * @param input input index
+   * @return field count
+   */
+  public int fieldCount(int input) {
+    Objects.checkIndex(input, inputCount());
+    return firstField[input + 1] - firstField[input];
+  }
+
+  /**
+   * Gets the number of fields across all inputs.
+   *
+   * @return total field count
+   */
+  public int totalFields() {
+    return firstField[inputCount()];
+  }
+
+  /**
+   * Gets the start offset of a field (inclusive).
+   *
+   * @param input input index
+   * @param field field index within the input
+   * @return start offset
+   */
+  public int start(int input, int field) {
+    return packed[offset(input, field)];
+  }
+
+  /**
+   * Gets the end offset of a field (exclusive).
+   *
+   * @param input input index
+   * @param field field index within the input
+   * @return end offset
+   */
+  public int end(int input, int field) {
+    return packed[offset(input, field) + 1];
+  }
+
+  /**
+   * Gets the length of a field, in chars for String inputs or bytes for zero-copy inputs.
+   *
+   * @param input input index
+   * @param field field index within the input
+   * @return field length
+   */
+  public int length(int input, int field) {
+    int offset = offset(input, field);
+    return packed[offset + 1] - packed[offset];
+  }
+
+  /**
+   * Whether fields can be projected to Strings (the inputs were Strings).
+   *
+   * @return true for String inputs, false for zero-copy inputs
+   */
+  public boolean hasText() {
+    return sources != null;
+  }
+
+  /**
+   * Gets a field as a String, created on demand.
+   *
+   * @param input input index
+   * @param field field index within the input
+   * @return the field text
+   * @throws IndexOutOfBoundsException if input or field is out of range
+   * @throws IllegalStateException if the inputs were zero-copy ({@link #hasText()} is false)
+   */
+  public String field(int input, int field) {
+    int offset = offset(input, field);
+    if (sources == null) {
+      throw new IllegalStateException(
+          "Zero-copy split results hold byte offsets only - read fields from the source memory");
+    }
+    return sources[input].substring(packed[offset], packed[offset + 1]);
+  }
+
+  /**
+   * Gets all fields of an input as Strings.
+   *
+   * @param input input index
+   * @return fields, empty for null inputs
+   * @throws IllegalStateException if the inputs were zero-copy
+   */
+  public String[] fields(int input) {
+    String[] fields = new String[fieldCount(input)];
+    for (int i = 0; i < fields.length; i++) {
+      fields[i] = field(input, i);
+    }
+    return fields;
+  }
+
+  /**
+   * Gets one field of every input - a column of a delimited batch.
+   *
+   * @param field field index
+   * @return field text per input, null where the input has fewer fields
+   * @throws IllegalStateException if the inputs were zero-copy
+   */
+  public String[] column(int field) {
+    String[] column = new String[inputCount()];
+    for (int i = 0; i < column.length; i++) {
+      if (field >= 0 && field < fieldCount(i)) {
+        column[i] = field(i, field);
+      }
+    }
+    return column;
+  }
+
+  @Override
+  public String toString() {
+    return "SplitResult{inputs=" + inputCount() + ", fields=" + totalFields() + "}";
+  }
+
+  private int offset(int input, int field) {
+    Objects.checkIndex(field, fieldCount(input));
+    return inputCount() + 2 * (firstField[input] + field);
+  }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.cache;
+
+import com.axonops.libre2.api.Pattern;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * Accounts RE2 max_mem granted to cached patterns against a process-wide budget.
+ *
+ * <p>Two modes, chosen by {@link RE2Config#dfaMemoryBudgetBytes()}:
+ *
+ * <ul>
+ *   <li><b>Global budget</b> ({@code > 0}) - every cached pattern is charged its full max_mem.
+ *       New patterns start at {@code dfaColdMaxMemBytes}; hot ones are promoted and cold ones
+ *       demoted by the cache so the total stays within the budget.
+ *   <li><b>Recompilation only</b> ({@code 0}) - patterns compile with RE2's default max_mem and
+ *       only the extra granted by DFA recompilation is charged, against {@code
+ *       dfaRecompileBudgetBytes}.
+ * </ul>
+ *
+ * <p>A hard ceiling: every charge is reserved with CAS before the compilation it pays for exists,
+ * and refused if it would exceed the limit. A charge is returned only when its compilation is
+ * freed, so patterns waiting in deferred cleanup (evicted while in use, or replaced by a
+ * recompilation) stay counted. Materialized DFA tables, frozen tables and bit-parallel NFAs are
+ * sized from the same max_mem but are not charged separately.
+ */
+final class DfaMemoryGovernor {
+  private final boolean global;
+  private final long baselineBytes;
+  private final long limitBytes;
+  private final long coldMaxMemBytes;
+  private final AtomicLong committedBytes = new AtomicLong(0);
+
+  DfaMemoryGovernor(RE2Config config) {
+    this.global = config.dfaMemoryBudgetBytes() > 0;
+    this.baselineBytes = global ? 0 : Pattern.DEFAULT_MAX_MEM_BYTES;
+    this.limitBytes = global ? config.dfaMemoryBudgetBytes() : config.dfaRecompileBudgetBytes();
+    this.coldMaxMemBytes = global ? config.dfaColdMaxMemBytes() : Pattern.DEFAULT_MAX_MEM_BYTES;
+  }
+
+  /** Whether the global budget is enabled (every pattern charged, allowances assigned). */
+  boolean isGlobal() {
+    return global;
+  }
+
+  /** max_mem a newly cached pattern is compiled with. */
+  long admissionMaxMemBytes() {
+    return coldMaxMemBytes;
+  }
+
+  /**
+   * Reserves the charge of a compilation with the given max_mem.
+   *
+   * @return true if reserved, false if it would exceed the limit
+   */
+  boolean tryReserve(long maxMemBytes) {
+    long charge = chargeOf(maxMemBytes);
+    long current;
+    do {
+      current = committedBytes.get();
+      if (charge > 0 && current + charge > limitBytes) {
+        return false;
+      }
+    } while (!committedBytes.compareAndSet(current, current + charge));
+    return true;
+  }
+
+  /**
+   * Moves a reservation from one max_mem to another (a compile fell back to a larger max_mem).
+   *
+   * @return true if moved, false if the larger charge would exceed the limit (reservation kept)
+   */
+  boolean tryResize(long fromMaxMemBytes, long toMaxMemBytes) {
+    long delta = chargeOf(toMaxMemBytes) - chargeOf(fromMaxMemBytes);
+    long current;
+    do {
+      current = committedBytes.get();
+      if (delta > 0 && current + delta > limitBytes) {
+        return false;
+      }
+    } while (!committedBytes.compareAndSet(current, current + delta));
+    return true;
+  }
+
+  /** Returns a charge once its compilation has been freed (or a reservation went unused). */
+  void release(long maxMemBytes) {
+    committedBytes.addAndGet(-chargeOf(maxMemBytes));
+  }
+
+  long committedBytes() {
+    return committedBytes.get();
+  }
+
+  long limitBytes() {
+    return limitBytes;
+  }
+
+  private long chargeOf(long maxMemBytes) {
+    return Math.max(0, maxMemBytes - baselineBytes);
+  }
+}
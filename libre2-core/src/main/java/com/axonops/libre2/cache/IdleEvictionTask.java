@@ -100,7 +100,11 @@ final class IdleEvictionTask {
         if (now - lastIdleScan >= idleScanIntervalMs) {
           // Full scan: idle eviction + deferred cleanup
           int evicted = cache.evictIdlePatterns();
-          logger.debug("RE2: Idle eviction scan complete - evicted: {}", evicted);
+          int recompiled = cache.scanDfaFailures();
+          logger.debug(
+              "RE2: Idle eviction scan complete - evicted: {}, DFA recompiled: {}",
+              evicted,
+              recompiled);
           lastIdleScan = now;
         } else {
           // Quick scan: just deferred cleanup
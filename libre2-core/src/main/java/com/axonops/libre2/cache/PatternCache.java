@@ -16,10 +16,16 @@
 
 package com.axonops.libre2.cache;
 
+import com.axonops.libre2.api.MatchEngine;
 import com.axonops.libre2.api.Pattern;
+import com.axonops.libre2.api.ResourceException;
+import com.axonops.libre2.jni.RE2LibraryLoader;
+import com.axonops.libre2.jni.RE2Native;
 import com.axonops.libre2.metrics.MetricNames;
 import com.axonops.libre2.metrics.RE2MetricsRegistry;
+import com.axonops.libre2.metrics.ThroughputMeter;
 import com.axonops.libre2.util.PatternHasher;
+import java.util.ArrayList;
 import java.util.Comparator;
 import java.util.List;
 import java.util.Map;
@@ -29,6 +35,8 @@ import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.atomic.AtomicInteger;
 import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicReference;
+import java.util.concurrent.atomic.LongAdder;
 import java.util.stream.Collectors;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
@@ -59,6 +67,16 @@ public final class PatternCache {
     return resourceTracker;
   }
 
+  /** Bytes scanned by matching operations - backs the matching throughput gauge. */
+  public ThroughputMeter getMatchingThroughput() {
+    return matchingThroughput;
+  }
+
+  /** Bytes scanned by capture group operations - backs the capture throughput gauge. */
+  public ThroughputMeter getCaptureThroughput() {
+    return captureThroughput;
+  }
+
   // ConcurrentHashMap for lock-free reads/writes
   private ConcurrentHashMap<CacheKey, CachedPattern> cache;
   private IdleEvictionTask evictionTask;
@@ -88,6 +106,13 @@ public final class PatternCache {
   // Invalid pattern recompilations (defensive check triggered)
   private final AtomicLong invalidPatternRecompilations = new AtomicLong(0);
 
+  // DFA memory: max_mem charged against the recompilation or global budget
+  private volatile DfaMemoryGovernor dfaGovernor;
+
+  // Bytes scanned, for the derived bytes-per-second gauges
+  private final ThroughputMeter matchingThroughput = new ThroughputMeter();
+  private final ThroughputMeter captureThroughput = new ThroughputMeter();
+
   /**
    * Creates a new pattern cache with the given configuration.
    *
@@ -96,6 +121,8 @@ public final class PatternCache {
   public PatternCache(RE2Config config) {
     this.config = config;
     this.resourceTracker = new com.axonops.libre2.util.ResourceTracker();
+    this.dfaGovernor = new DfaMemoryGovernor(config);
+    applyDfaFailureTracking(config);
 
     if (config.cacheEnabled()) {
       // ConcurrentHashMap for lock-free concurrent access
@@ -137,6 +164,39 @@ public final class PatternCache {
     }
   }
 
+  /**
+   * Turns native DFA failure tracking on when the configuration asks for it or acts on it
+   * (recompilation, global budget), and off otherwise. Process-wide; affects patterns compiled
+   * afterwards.
+   */
+  private static void applyDfaFailureTracking(RE2Config config) {
+    boolean wanted =
+        config.dfaFailureTrackingEnabled()
+            || config.dfaRecompileEnabled()
+            || config.dfaMemoryBudgetBytes() > 0;
+    RE2LibraryLoader.loadLibrary();
+    boolean tracking = RE2Native.INSTANCE.setDfaFailureTracking(wanted);
+    if (wanted && !tracking) {
+      logger.debug("RE2: DFA failure tracking unavailable in this native build");
+    }
+  }
+
+  /**
+   * Gets the max_mem newly cached patterns are compiled with.
+   *
+   * <p>RE2's default unless the global DFA memory budget is enabled, in which case new patterns
+   * start with {@link RE2Config#dfaColdMaxMemBytes()}.
+   *
+   * @return max_mem in bytes
+   * @since 1.3.0
+   */
+  public long getDfaAdmissionMaxMemBytes() {
+    if (!config.cacheEnabled()) {
+      return Pattern.DEFAULT_MAX_MEM_BYTES;
+    }
+    return dfaGovernor.admissionMaxMemBytes();
+  }
+
   /**
    * Gets or compiles a pattern.
    *
@@ -172,6 +232,7 @@ public final class PatternCache {
         // Remove invalid pattern and decrement memory
         if (cache.remove(key, cached)) {
           totalNativeMemoryBytes.addAndGet(-cached.memoryBytes());
+          cached.releaseCharge();
         }
         // Fall through to recompile below
       } else {
@@ -193,17 +254,40 @@ public final class PatternCache {
     // Track whether this thread compiled a new pattern
     final long[] addedMemory = {0};
 
-    CachedPattern newCached =
-        cache.computeIfAbsent(
-            key,
-            k -> {
-              // This lambda executes atomically for this key only
-              // Other keys can be accessed concurrently
-              Pattern pattern = compiler.get();
-              CachedPattern created = new CachedPattern(pattern);
-              addedMemory[0] = created.memoryBytes();
-              return created;
-            });
+    // Hard DFA budget: reserve the new pattern's charge before compiling it
+    DfaMemoryGovernor governor = dfaGovernor;
+    long admissionMaxMem = governor.admissionMaxMemBytes();
+    if (!reserveForAdmission(governor, admissionMaxMem)) {
+      throw dfaBudgetExhausted(governor, admissionMaxMem);
+    }
+    final boolean[] charged = {false};
+
+    CachedPattern newCached;
+    try {
+      newCached =
+          cache.computeIfAbsent(
+              key,
+              k -> {
+                // This lambda executes atomically for this key only
+                // Other keys can be accessed concurrently
+                Pattern pattern = compiler.get();
+                long maxMem = pattern.getMaxMemBytes();
+                if (maxMem != admissionMaxMem && !governor.tryResize(admissionMaxMem, maxMem)) {
+                  // Program needed a larger max_mem than the budget has left
+                  pattern.forceClose();
+                  throw dfaBudgetExhausted(governor, maxMem);
+                }
+                CachedPattern created = new CachedPattern(pattern);
+                created.charge(governor);
+                charged[0] = true;
+                addedMemory[0] = created.memoryBytes();
+                return created;
+              });
+    } finally {
+      if (!charged[0]) {
+        governor.release(admissionMaxMem); // Cache hit on a race, or compilation failed
+      }
+    }
 
     // If we compiled a new pattern, update memory tracking
     if (addedMemory[0] > 0) {
@@ -284,7 +368,7 @@ public final class PatternCache {
         totalNativeMemoryBytes.addAndGet(-cached.memoryBytes());
 
         if (cached.pattern().getRefCount() > 0) {
-          // Pattern in use - defer cleanup
+          // Pattern in use - defer cleanup (stays charged against the DFA budget until freed)
           deferredCleanup.add(cached);
           evictionsDeferred.incrementAndGet();
 
@@ -388,6 +472,387 @@ public final class PatternCache {
     return evicted;
   }
 
+  /**
+   * Samples DFA failures and accesses of cached patterns and reassigns their max_mem allowances
+   * (called by background thread alongside idle eviction).
+   *
+   * <p>Every scan adds the failures each pattern saw since the previous scan to {@link
+   * MetricNames#DFA_FAILURES}. If {@link RE2Config#dfaRecompileEnabled()} or the global DFA memory
+   * budget is set, patterns that need more DFA memory are promoted - recompiled with double their
+   * max_mem, capped at {@code dfaRecompileMaxMemBytes} - hottest first while the budget allows. A
+   * pattern needs more when it saw at least {@code dfaRecompileFailureThreshold} new failures or,
+   * under the global budget with failures undetectable, when it was used since the last scan and
+   * sits below RE2's default max_mem.
+   *
+   * <p>Under the global budget, promoted patterns unused since the last scan are demoted back to
+   * their starting allowance (least recently used first) to make room for hotter ones.
+   *
+   * <p>Recompiled copies replace the cache entry; the old compilation goes to deferred cleanup and
+   * is freed once unused and at least {@code evictionProtectionMs} after the replacement.
+   *
+   * <p>If {@link RE2Config#dfaFreezeHotPatterns()} is set, the most used patterns then have their
+   * DFA frozen into lock-free tables.
+   *
+   * @return number of patterns promoted
+   */
+  int scanDfaFailures() {
+    if (!config.cacheEnabled()) {
+      return 0;
+    }
+
+    RE2MetricsRegistry metrics = config.metricsRegistry();
+    DfaMemoryGovernor governor = dfaGovernor;
+    boolean promote = config.dfaRecompileEnabled() || governor.isGlobal();
+    long totalFailures = 0;
+    List<DfaCandidate> sampled = new ArrayList<>();
+    List<DfaCandidate> needy = new ArrayList<>();
+    List<DfaCandidate> idle = new ArrayList<>();
+
+    for (Map.Entry<CacheKey, CachedPattern> entry : cache.entrySet()) {
+      CachedPattern cached = entry.getValue();
+      DfaCandidate candidate =
+          new DfaCandidate(
+              entry.getKey(), cached, cached.sampleDfaFailures(), cached.sampleAccesses());
+      sampled.add(candidate);
+      totalFailures += Math.max(0, candidate.failures());
+
+      boolean needsMore =
+          candidate.failures() >= 0
+              ? candidate.failures() >= config.dfaRecompileFailureThreshold()
+              : governor.isGlobal()
+                  && candidate.accesses() > 0
+                  && cached.maxMemBytes() < Pattern.DEFAULT_MAX_MEM_BYTES;
+      if (promote && needsMore) {
+        needy.add(candidate);
+      } else if (governor.isGlobal()
+          && candidate.accesses() == 0
+          && cached.maxMemBytes() > cached.floorMaxMemBytes()) {
+        idle.add(candidate);
+      }
+    }
+
+    if (totalFailures > 0) {
+      metrics.incrementCounter(MetricNames.DFA_FAILURES, totalFailures);
+    }
+
+    // Hottest first: they gain the most from the limited budget
+    needy.sort(
+        Comparator.comparingLong(DfaCandidate::accesses)
+            .thenComparingLong(DfaCandidate::failures)
+            .reversed());
+    // Least recently used first: they give their allowance back first
+    idle.sort(Comparator.comparingLong(c -> c.cached().lastAccessTimeNanos()));
+
+    int promoted = 0;
+    int demoted = 0;
+    int nextIdle = 0;
+    for (DfaCandidate candidate : needy) {
+      long currentMaxMem = candidate.cached().maxMemBytes();
+      // Without failure detection, hotness alone only earns RE2's default
+      long ceiling =
+          candidate.failures() >= 0
+              ? config.dfaRecompileMaxMemBytes()
+              : Math.min(Pattern.DEFAULT_MAX_MEM_BYTES, config.dfaRecompileMaxMemBytes());
+      long newMaxMem = Math.min(currentMaxMem * 2, ceiling);
+      if (newMaxMem <= currentMaxMem) {
+        continue; // Already at the per-pattern cap
+      }
+
+      // Reserve the replacement's full charge before compiling it; the old compilation stays
+      // charged until deferred cleanup frees it
+      boolean reserved = governor.tryReserve(newMaxMem);
+      while (!reserved && nextIdle < idle.size()) {
+        if (demote(idle.get(nextIdle++), governor)) {
+          demoted++;
+          cleanupDeferredPatterns(); // Frees the demoted compilation if its grace period is over
+        }
+        reserved = governor.tryReserve(newMaxMem);
+      }
+      if (!reserved) {
+        metrics.incrementCounter(MetricNames.CACHE_DFA_BUDGET_REJECTIONS);
+        logger.debug(
+            "RE2: DFA promotion skipped, budget exhausted - {}/{} committed, maxMem {} -> {}: {}",
+            governor.committedBytes(),
+            governor.limitBytes(),
+            currentMaxMem,
+            newMaxMem,
+            candidate.key());
+        continue;
+      }
+
+      if (replaceCompilation(candidate.key(), candidate.cached(), newMaxMem, governor)) {
+        metrics.incrementCounter(MetricNames.CACHE_DFA_RECOMPILATIONS);
+        promoted++;
+        logger.debug(
+            "RE2: Promoted pattern - failures: {}, accesses: {}, maxMem: {} -> {}: {}",
+            candidate.failures(),
+            candidate.accesses(),
+            currentMaxMem,
+            newMaxMem,
+            candidate.key());
+      } else {
+        governor.release(newMaxMem);
+      }
+    }
+
+    // Return the charge of replaced compilations whose grace period is already over
+    if (promoted > 0) {
+      cleanupDeferredPatterns();
+    }
+
+    int frozen = freezeHotPatterns(sampled);
+    int switched = calibrateFrozenPatterns(sampled);
+
+    if (totalFailures > 0 || promoted > 0 || demoted > 0 || frozen > 0 || switched > 0) {
+      logger.debug(
+          "RE2: DFA budget scan completed - failures: {}, promoted: {}, demoted: {}, frozen: {}, engine switches: {}, committed: {}/{}",
+          totalFailures,
+          promoted,
+          demoted,
+          frozen,
+          switched,
+          governor.committedBytes(),
+          governor.limitBytes());
+    }
+
+    return promoted;
+  }
+
+  /**
+   * Freezes the DFA of the hottest cached patterns (see {@link Pattern#freezeDfa()}) so their
+   * matches run on immutable tables without RE2's DFA cache lock.
+   *
+   * <p>At most {@link RE2Config#dfaFreezeHotPatterns()} cached patterns are frozen at a time;
+   * each scan fills free slots with the patterns used most since the previous scan. A pattern is
+   * tried once per cache entry: its DFA tables and its bit-parallel NFA (see {@link
+   * Pattern#freezeBitParallel()}) are both built where eligible, so calibration can pick between
+   * them, and a pattern eligible for neither is not retried until recompiled. Frozen matchers are
+   * freed when their pattern is evicted, which frees its slot.
+   *
+   * @param sampled every cached pattern with its accesses since the previous scan
+   * @return number of patterns frozen
+   */
+  private int freezeHotPatterns(List<DfaCandidate> sampled) {
+    int slots = config.dfaFreezeHotPatterns();
+    if (slots <= 0) {
+      return 0;
+    }
+    for (DfaCandidate candidate : sampled) {
+      Pattern pattern = candidate.cached().pattern();
+      if (pattern.isDfaFrozen() || pattern.isBitParallelFrozen()) {
+        slots--;
+      }
+    }
+
+    sampled.sort(Comparator.comparingLong(DfaCandidate::accesses).reversed());
+    int frozen = 0;
+    for (DfaCandidate candidate : sampled) {
+      CachedPattern cached = candidate.cached();
+      if (slots <= 0 || candidate.accesses() == 0) {
+        break;
+      }
+      // Skip entries replaced by a promotion in this scan and patterns already tried
+      if (cached.freezeAttempted || cache.get(candidate.key()) != cached) {
+        continue;
+      }
+
+      cached.freezeAttempted = true;
+      try {
+        boolean dfa = cached.pattern().freezeDfa();
+        if (cached.pattern().freezeBitParallel() || dfa) {
+          frozen++;
+          slots--;
+          config.metricsRegistry().incrementCounter(MetricNames.CACHE_DFA_FROZEN);
+          if (logger.isDebugEnabled()) {
+            logger.debug(
+                "RE2: Froze hot pattern - accesses: {}, engines: {}: {}",
+                candidate.accesses(),
+                cached.pattern().engineShortlist(),
+                candidate.key());
+          }
+        }
+      } catch (IllegalStateException e) {
+        // Evicted concurrently
+      } catch (RuntimeException e) {
+        logger.warn("RE2: Failed to freeze DFA of pattern {}", candidate.key(), e);
+      }
+    }
+    return frozen;
+  }
+
+  /**
+   * Re-selects the match engine of frozen cached patterns used since the previous scan, timing
+   * their engines on recently sampled inputs (see {@link Pattern#calibrateEngines()}).
+   *
+   * @param sampled every cached pattern with its accesses since the previous scan
+   * @return number of patterns whose engine changed
+   */
+  private int calibrateFrozenPatterns(List<DfaCandidate> sampled) {
+    if (config.dfaFreezeHotPatterns() <= 0) {
+      return 0;
+    }
+    int switched = 0;
+    for (DfaCandidate candidate : sampled) {
+      Pattern pattern = candidate.cached().pattern();
+      if (candidate.accesses() == 0 || !(pattern.isDfaFrozen() || pattern.isBitParallelFrozen())) {
+        continue;
+      }
+      try {
+        MatchEngine before = pattern.matchEngine();
+        if (pattern.calibrateEngines() != before) {
+          switched++;
+          config.metricsRegistry().incrementCounter(MetricNames.CACHE_ENGINE_SWITCHES);
+        }
+      } catch (IllegalStateException e) {
+        // Evicted concurrently
+      } catch (RuntimeException e) {
+        logger.warn("RE2: Failed to calibrate engines of pattern {}", candidate.key(), e);
+      }
+    }
+    return switched;
+  }
+
+  /** Counts cached patterns whose match engine is the given one. */
+  private long patternsOnEngine(MatchEngine engine) {
+    ConcurrentHashMap<CacheKey, CachedPattern> current = cache;
+    return current == null
+        ? 0
+        : current.values().stream().filter(c -> c.pattern().matchEngine() == engine).count();
+  }
+
+  /**
+   * Reserves a new pattern's DFA charge, making room under the global budget when it is full:
+   * frees deferred compilations that are no longer needed, then evicts least recently used
+   * patterns outside {@code evictionProtectionMs}. An evicted pattern still in use only returns its
+   * charge once deferred cleanup frees it.
+   *
+   * @return true if the charge was reserved
+   */
+  private boolean reserveForAdmission(DfaMemoryGovernor governor, long maxMemBytes) {
+    if (governor.tryReserve(maxMemBytes)) {
+      return true;
+    }
+    cleanupDeferredPatterns();
+    if (governor.tryReserve(maxMemBytes)) {
+      return true;
+    }
+
+    long cutoffTime = System.nanoTime() - config.evictionProtectionMs() * 1_000_000L;
+    List<Map.Entry<CacheKey, CachedPattern>> coldest =
+        cache.entrySet().stream()
+            .filter(e -> e.getValue().lastAccessTimeNanos() < cutoffTime)
+            .sorted(Comparator.comparingLong(e -> e.getValue().lastAccessTimeNanos()))
+            .collect(Collectors.toList());
+
+    for (Map.Entry<CacheKey, CachedPattern> entry : coldest) {
+      CachedPattern cached = entry.getValue();
+      if (!cache.remove(entry.getKey(), cached)) {
+        continue;
+      }
+      totalNativeMemoryBytes.addAndGet(-cached.memoryBytes());
+
+      if (cached.pattern().getRefCount() > 0) {
+        deferredCleanup.add(cached);
+        evictionsDeferred.incrementAndGet();
+        long deferredMemory = deferredNativeMemoryBytes.addAndGet(cached.memoryBytes());
+        updatePeakDeferredMemory(deferredMemory);
+        updatePeakDeferredPatternCount(deferredCleanup.size());
+      } else {
+        cached.forceClose();
+        evictionsLRU.incrementAndGet();
+        config.metricsRegistry().incrementCounter(MetricNames.CACHE_EVICTIONS_LRU);
+      }
+      logger.trace("RE2: DFA budget evicting pattern: {}", entry.getKey());
+
+      if (governor.tryReserve(maxMemBytes)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /** Counts a refused admission and builds the exception reporting it. */
+  private ResourceException dfaBudgetExhausted(DfaMemoryGovernor governor, long maxMemBytes) {
+    config.metricsRegistry().incrementCounter(MetricNames.CACHE_DFA_BUDGET_REJECTIONS);
+    return new ResourceException(
+        "DFA memory budget exhausted: "
+            + governor.committedBytes()
+            + " of "
+            + governor.limitBytes()
+            + " bytes committed, cannot admit a pattern with max_mem "
+            + maxMemBytes);
+  }
+
+  /**
+   * Recompiles a promoted pattern back to its starting allowance. The difference returns to the
+   * budget once deferred cleanup frees the promoted compilation.
+   *
+   * @return true if the cache entry was replaced
+   */
+  private boolean demote(DfaCandidate candidate, DfaMemoryGovernor governor) {
+    CachedPattern cached = candidate.cached();
+    long currentMaxMem = cached.maxMemBytes();
+    long newMaxMem = cached.floorMaxMemBytes();
+    if (!governor.tryReserve(newMaxMem)) {
+      return false;
+    }
+    if (!replaceCompilation(candidate.key(), cached, newMaxMem, governor)) {
+      governor.release(newMaxMem);
+      return false;
+    }
+
+    config.metricsRegistry().incrementCounter(MetricNames.CACHE_DFA_DEMOTIONS);
+    logger.debug(
+        "RE2: Demoted pattern - maxMem: {} -> {}: {}", currentMaxMem, newMaxMem, candidate.key());
+    return true;
+  }
+
+  /**
+   * Recompiles a cached pattern with a different max_mem and swaps it into the cache. The caller
+   * reserves the new compilation's charge; it moves to the new entry on success.
+   *
+   * @return true if the cache entry was replaced
+   */
+  private boolean replaceCompilation(
+      CacheKey key, CachedPattern cached, long newMaxMem, DfaMemoryGovernor governor) {
+    Pattern replacement;
+    try {
+      replacement = cached.pattern().recompileWithMaxMem(newMaxMem);
+    } catch (RuntimeException e) {
+      // Closed by a concurrent eviction, resource limit hit, etc. - try again next scan
+      logger.debug("RE2: DFA recompilation failed: {}", key, e);
+      return false;
+    }
+
+    CachedPattern fresh =
+        new CachedPattern(replacement, cached.lastAccessTimeNanos(), cached.floorMaxMemBytes());
+    if (!cache.replace(key, cached, fresh)) {
+      // Entry evicted or replaced meanwhile - drop our copy
+      fresh.forceClose();
+      return false;
+    }
+    fresh.charge(governor);
+
+    totalNativeMemoryBytes.addAndGet(fresh.memoryBytes() - cached.memoryBytes());
+    updatePeakMemory();
+    retire(cached);
+    return true;
+  }
+
+  /**
+   * Hands a replaced compilation to deferred cleanup. It is never freed inline: the patterns this
+   * path replaces are hot, and direct, bulk and record mapper calls take no reference, so a thread
+   * may still be inside a native call on it. Deferred cleanup frees it once no matcher uses it and
+   * {@code evictionProtectionMs} has passed since it was replaced.
+   */
+  private void retire(CachedPattern cached) {
+    cached.retire(System.nanoTime());
+    deferredCleanup.add(cached);
+    long deferredMemory = deferredNativeMemoryBytes.addAndGet(cached.memoryBytes());
+    updatePeakDeferredMemory(deferredMemory);
+    updatePeakDeferredPatternCount(deferredCleanup.size());
+  }
+
   /**
    * Cleans up deferred patterns that are no longer in use.
    *
@@ -395,9 +860,10 @@ public final class PatternCache {
    */
   int cleanupDeferredPatterns() {
     int cleaned = 0;
+    long graceCutoff = System.nanoTime() - config.evictionProtectionMs() * 1_000_000L;
 
     for (CachedPattern deferred : deferredCleanup) {
-      if (deferred.pattern().getRefCount() == 0) {
+      if (deferred.pattern().getRefCount() == 0 && deferred.graceExpired(graceCutoff)) {
         // Now safe to free
         logger.trace("RE2: Cleaning up deferred pattern");
         deferred.forceClose();
@@ -407,7 +873,9 @@ public final class PatternCache {
         deferredNativeMemoryBytes.addAndGet(-deferred.memoryBytes());
 
         // Note: evictionsDeferred already incremented when added to deferred list
-        config.metricsRegistry().incrementCounter(MetricNames.CACHE_EVICTIONS_DEFERRED);
+        if (!deferred.isRetired()) {
+          config.metricsRegistry().incrementCounter(MetricNames.CACHE_EVICTIONS_DEFERRED);
+        }
         cleaned++;
       }
     }
@@ -493,7 +961,7 @@ public final class PatternCache {
 
     // Reset memory tracking (all non-deferred patterns removed)
     totalNativeMemoryBytes.set(0);
-    // Note: deferred memory is tracked separately
+    // Note: deferred memory is tracked separately, and stays charged to the DFA budget until freed
   }
 
   /** Resets cache statistics (for testing only). */
@@ -557,6 +1025,8 @@ public final class PatternCache {
 
     // Update config
     this.config = newConfig;
+    this.dfaGovernor = new DfaMemoryGovernor(newConfig);
+    applyDfaFailureTracking(newConfig);
 
     // Reinitialize if cache enabled
     if (newConfig.cacheEnabled()) {
@@ -630,6 +1100,23 @@ public final class PatternCache {
     metrics.registerGauge(
         "cache.deferred.native_memory.peak.bytes", peakDeferredNativeMemoryBytes::get);
 
+    // DFA memory budget (gauges read the current governor, replaced on reconfigure)
+    metrics.registerGauge(
+        "cache.dfa.max_mem.committed.bytes", () -> dfaGovernor.committedBytes());
+    metrics.registerGauge("cache.dfa.max_mem.budget.bytes", () -> dfaGovernor.limitBytes());
+
+    // Selected match engines (counted over the cache on each read)
+    metrics.registerGauge(
+        "cache.engine.frozen_dfa.current.count", () -> patternsOnEngine(MatchEngine.FROZEN_DFA));
+    metrics.registerGauge(
+        "cache.engine.bit_parallel.current.count",
+        () -> patternsOnEngine(MatchEngine.BIT_PARALLEL));
+
+    // Throughput (bytes counters and input-length histograms are recorded directly by Pattern)
+    metrics.registerGauge(
+        "matching.throughput.bytes_per_second", matchingThroughput::bytesPerSecond);
+    metrics.registerGauge("capture.throughput.bytes_per_second", captureThroughput::bytesPerSecond);
+
     logger.debug("RE2: Metrics registered - cache gauges, resource gauges, deferred gauges");
   }
 
@@ -643,6 +1130,9 @@ public final class PatternCache {
     }
   }
 
+  /** Cached pattern sampled by a DFA budget scan (failures -1 when undetectable). */
+  private record DfaCandidate(CacheKey key, CachedPattern cached, long failures, long accesses) {}
+
   /**
    * Cached pattern with atomic access time tracking.
    *
@@ -652,11 +1142,32 @@ public final class PatternCache {
     private final Pattern pattern;
     private final AtomicLong lastAccessTimeNanos;
     private final long memoryBytes;
+    private final long floorMaxMemBytes;
+    private final LongAdder accesses = new LongAdder();
+
+    // Budget this compilation's max_mem is charged to (null once returned, or never charged)
+    private final AtomicReference<DfaMemoryGovernor> chargedTo = new AtomicReference<>();
+
+    // Counts at the previous scan (only touched by the eviction thread)
+    private long lastDfaFailures;
+    private long lastAccesses;
+
+    // Whether the scan has tried to freeze this entry's DFA (only touched by the eviction thread)
+    private boolean freezeAttempted;
+
+    // Set when a recompilation replaced this entry (freed only after a grace period)
+    private volatile boolean retired;
+    private volatile long retiredAtNanos;
 
     CachedPattern(Pattern pattern) {
+      this(pattern, System.nanoTime(), pattern.getMaxMemBytes());
+    }
+
+    CachedPattern(Pattern pattern, long lastAccessTimeNanos, long floorMaxMemBytes) {
       this.pattern = pattern;
-      this.lastAccessTimeNanos = new AtomicLong(System.nanoTime());
+      this.lastAccessTimeNanos = new AtomicLong(lastAccessTimeNanos);
       this.memoryBytes = pattern.getNativeMemoryBytes();
+      this.floorMaxMemBytes = floorMaxMemBytes;
     }
 
     Pattern pattern() {
@@ -671,12 +1182,81 @@ public final class PatternCache {
       return memoryBytes;
     }
 
+    long maxMemBytes() {
+      return pattern.getMaxMemBytes();
+    }
+
+    /** max_mem this entry was admitted with - demotion never goes below it. */
+    long floorMaxMemBytes() {
+      return floorMaxMemBytes;
+    }
+
+    /** Returns cache hits since the previous call. */
+    long sampleAccesses() {
+      long current = accesses.sum();
+      long delta = current - lastAccesses;
+      lastAccesses = current;
+      return delta;
+    }
+
+    /**
+     * Returns DFA failures since the previous call.
+     *
+     * @return new failures, or -1 if the native library cannot detect them
+     */
+    long sampleDfaFailures() {
+      long current;
+      try {
+        current = pattern.getDfaFailureCount();
+      } catch (IllegalStateException e) {
+        return 0; // Closed by a concurrent eviction
+      }
+      if (current < 0) {
+        return -1;
+      }
+      long delta = current - lastDfaFailures;
+      lastDfaFailures = current;
+      return delta;
+    }
+
     void touch() {
       lastAccessTimeNanos.set(System.nanoTime());
+      accesses.increment();
     }
 
+    /** Frees the compilation (unless still in use) and returns its DFA charge once freed. */
     void forceClose() {
       pattern.forceClose();
+      if (pattern.isClosed()) {
+        releaseCharge();
+      }
+    }
+
+    /** Records that this compilation's max_mem is charged to the given budget. */
+    void charge(DfaMemoryGovernor governor) {
+      chargedTo.set(governor);
+    }
+
+    /** Returns the DFA charge (at most once). */
+    void releaseCharge() {
+      DfaMemoryGovernor governor = chargedTo.getAndSet(null);
+      if (governor != null) {
+        governor.release(pattern.getMaxMemBytes());
+      }
+    }
+
+    void retire(long nowNanos) {
+      retiredAtNanos = nowNanos;
+      retired = true;
+    }
+
+    boolean isRetired() {
+      return retired;
+    }
+
+    /** Whether a replaced entry's grace period ended before the cutoff (evictions have none). */
+    boolean graceExpired(long cutoffNanos) {
+      return !retired || retiredAtNanos - cutoffNanos <= 0;
     }
   }
 
@@ -16,6 +16,7 @@
 
 package com.axonops.libre2.cache;
 
+import com.axonops.libre2.api.Pattern;
 import com.axonops.libre2.metrics.NoOpMetricsRegistry;
 import com.axonops.libre2.metrics.RE2MetricsRegistry;
 import java.util.Objects;
@@ -171,6 +172,75 @@ import java.util.Objects;
  *   <li>Only disable if absolute maximum performance required
  * </ul>
  *
+ * <h3>DFA Budget Recompilation</h3>
+ *
+ * <ul>
+ *   <li><b>Default: disabled</b>
+ *   <li>RE2 gives each pattern a memory budget (max_mem, 8MB) for its program and DFA caches; when
+ *       the DFA exhausts it, matching silently falls back to the much slower NFA
+ *   <li>When enabled, the idle eviction scan recompiles cached patterns whose DFA failed at least
+ *       {@code dfaRecompileFailureThreshold} times since the last scan, doubling max_mem up to
+ *       {@code dfaRecompileMaxMemBytes}
+ *   <li>Extra budget across all cached patterns is capped by {@code dfaRecompileBudgetBytes}
+ *   <li>Monitor {@code matching.dfa.failures.total.count} - requires a native build with Abseil
+ *       logging (otherwise failures cannot be detected and nothing is recompiled)
+ *   <li>Turns on DFA failure tracking (see below)
+ * </ul>
+ *
+ * <h3>DFA Failure Tracking</h3>
+ *
+ * <ul>
+ *   <li><b>Default: disabled</b> - patterns compile with RE2's {@code log_errors} option off
+ *   <li>When enabled (or implied by DFA recompilation or the global DFA memory budget), patterns
+ *       compiled afterwards count their DFA out-of-memory events for {@code
+ *       Pattern.getDfaFailureCount()} and {@code matching.dfa.failures.total.count}
+ *   <li>RE2 reports those events, and parse errors, through Abseil logging; whether they also
+ *       reach stderr follows the process's Abseil stderr threshold, which the library leaves alone
+ *   <li>Process-wide: the most recently created or reconfigured cache decides
+ * </ul>
+ *
+ * <h3>Global DFA Memory Budget</h3>
+ *
+ * <ul>
+ *   <li><b>Default: disabled (0)</b> - every cached pattern may use RE2's 8MB max_mem, so 50K
+ *       patterns could in theory claim hundreds of GB of DFA memory
+ *   <li>When set, every cached pattern's max_mem is charged against {@code dfaMemoryBudgetBytes}.
+ *       New patterns start at {@code dfaColdMaxMemBytes}; the idle eviction scan promotes hot
+ *       patterns that need more (DFA failures, or recent use if failures can't be detected) up to
+ *       {@code dfaRecompileMaxMemBytes}, demoting cold promoted patterns to make room
+ *   <li>Hard ceiling: a new pattern's max_mem is reserved before it compiles. When the budget is
+ *       full the cache evicts least recently used patterns outside {@code evictionProtectionMs};
+ *       if that is not enough, compilation fails with {@code ResourceException}
+ *   <li>Evicted or replaced patterns stay charged until their native memory is freed. Materialized
+ *       and frozen DFA tables and bit-parallel NFAs are not charged separately
+ *   <li>Monitor {@code cache.dfa.max_mem.committed.bytes} against {@code
+ *       cache.dfa.max_mem.budget.bytes}
+ * </ul>
+ *
+ * <h3>Java DFA Tier</h3>
+ *
+ * <ul>
+ *   <li><b>Default: 32 chars</b> - for inputs this short the JNI transition and string conversion
+ *       cost more than the match itself
+ *   <li>{@code Matcher.matches()} / {@code find()} on Strings no longer than {@code
+ *       javaDfaMaxInputLength} run on a compact copy of the pattern's DFA in Java, with no JNI call
+ *   <li>Only patterns whose DFA is small (at most {@code 16K} states × byte classes) get a compact
+ *       DFA; others always match natively. It is built once per pattern on a background thread
+ *       after the first short-input match, which (like any until it is ready) matches natively
+ *   <li>Set to 0 to disable; monitor {@code matching.java_dfa.operations.total.count}
+ * </ul>
+ *
+ * <h3>Frozen DFA Tables</h3>
+ *
+ * <ul>
+ *   <li><b>Default: 0 (disabled)</b>
+ *   <li>The idle eviction scan freezes the DFA of up to {@code dfaFreezeHotPatterns} of the most
+ *       used cached patterns into immutable tables, so their matches skip RE2's DFA cache lock
+ *   <li>Only patterns with at most {@code 1024} DFA states are frozen; smaller programs with
+ *       larger DFAs get a bit-parallel NFA instead. Captures and replacement still run in RE2
+ *   <li>Requires a native build with RE2 internals; monitor {@code cache.dfa.frozen.total.count}
+ * </ul>
+ *
  * @param cacheEnabled Enable pattern caching (if false, users manage patterns manually)
  * @param maxCacheSize Maximum patterns in cache before LRU eviction (must be > 0 if cache enabled)
  * @param idleTimeoutSeconds Evict patterns unused for this duration (must be > 0 if cache enabled)
@@ -187,6 +257,24 @@ import java.util.Objects;
  *     overhead)
  * @param metricsRegistry Metrics implementation (use {@link
  *     com.axonops.libre2.metrics.NoOpMetricsRegistry} for zero overhead)
+ * @param dfaRecompileEnabled Recompile cached patterns whose DFA keeps exhausting its memory budget
+ *     (since 1.3.0)
+ * @param dfaRecompileFailureThreshold DFA failures per eviction scan that mark a pattern for
+ *     recompilation (must be > 0 if enabled)
+ * @param dfaRecompileMaxMemBytes Largest max_mem a pattern may be recompiled with (must be greater
+ *     than RE2's 8MB default if enabled)
+ * @param dfaRecompileBudgetBytes Total extra max_mem granted across all cached patterns (must be >
+ *     0 if enabled)
+ * @param dfaMemoryBudgetBytes Process-wide max_mem budget across all cached patterns (0 disables;
+ *     since 1.3.0)
+ * @param dfaColdMaxMemBytes max_mem new cached patterns start with under the global budget (must be
+ *     > 0 and ≤ dfaRecompileMaxMemBytes if the budget is enabled)
+ * @param javaDfaMaxInputLength Longest String (in chars) matched by the Java DFA tier (0 disables;
+ *     since 1.3.0)
+ * @param dfaFreezeHotPatterns Most-used cached patterns whose DFA is frozen into lock-free tables
+ *     (0 disables; since 1.3.0)
+ * @param dfaFailureTrackingEnabled Count DFA memory exhaustion per pattern even without DFA
+ *     recompilation or the global budget (since 1.3.0)
  * @since 1.0.0
  * @see com.axonops.libre2.cache.PatternCache
  * @see com.axonops.libre2.metrics.MetricNames
@@ -201,7 +289,31 @@ public record RE2Config(
     int maxSimultaneousCompiledPatterns,
     int maxMatchersPerPattern,
     boolean validateCachedPatterns,
-    RE2MetricsRegistry metricsRegistry) {
+    RE2MetricsRegistry metricsRegistry,
+    boolean dfaRecompileEnabled,
+    long dfaRecompileFailureThreshold,
+    long dfaRecompileMaxMemBytes,
+    long dfaRecompileBudgetBytes,
+    long dfaMemoryBudgetBytes,
+    long dfaColdMaxMemBytes,
+    int javaDfaMaxInputLength,
+    int dfaFreezeHotPatterns,
+    boolean dfaFailureTrackingEnabled) {
+
+  /** Default DFA failures per eviction scan before a cached pattern is recompiled. */
+  static final long DEFAULT_DFA_RECOMPILE_FAILURE_THRESHOLD = 100;
+
+  /** Default cap on a recompiled pattern's max_mem (64MB). */
+  static final long DEFAULT_DFA_RECOMPILE_MAX_MEM_BYTES = 64L << 20;
+
+  /** Default total extra max_mem granted across all cached patterns (256MB). */
+  static final long DEFAULT_DFA_RECOMPILE_BUDGET_BYTES = 256L << 20;
+
+  /** Default max_mem new cached patterns start with under the global budget (1MB). */
+  static final long DEFAULT_DFA_COLD_MAX_MEM_BYTES = 1L << 20;
+
+  /** Default longest String matched by the Java DFA tier (32 chars). */
+  static final int DEFAULT_JAVA_DFA_MAX_INPUT_LENGTH = 32;
 
   /**
    * Default configuration for production use.
@@ -226,8 +338,16 @@ public record RE2Config(
           100000, // Max 100K simultaneous active patterns
           10000, // Max 10K matchers per pattern
           true, // Validate cached patterns (defensive check)
-          NoOpMetricsRegistry.INSTANCE // Metrics disabled (zero overhead)
-          );
+          NoOpMetricsRegistry.INSTANCE, // Metrics disabled (zero overhead)
+          false, // DFA budget recompilation disabled
+          DEFAULT_DFA_RECOMPILE_FAILURE_THRESHOLD,
+          DEFAULT_DFA_RECOMPILE_MAX_MEM_BYTES,
+          DEFAULT_DFA_RECOMPILE_BUDGET_BYTES,
+          0, // No global DFA memory budget
+          DEFAULT_DFA_COLD_MAX_MEM_BYTES,
+          DEFAULT_JAVA_DFA_MAX_INPUT_LENGTH,
+          0, // No frozen DFA tables
+          false); // DFA failures not tracked
 
   /** Configuration with caching disabled. Users manage all pattern resources manually. */
   public static final RE2Config NO_CACHE =
@@ -241,8 +361,16 @@ public record RE2Config(
           100000, // Still enforce simultaneous limit
           10000, // Still enforce matcher limit
           false, // No validation needed when no cache
-          NoOpMetricsRegistry.INSTANCE // Metrics disabled
-          );
+          NoOpMetricsRegistry.INSTANCE, // Metrics disabled
+          false, // No recompilation without a cache
+          DEFAULT_DFA_RECOMPILE_FAILURE_THRESHOLD,
+          DEFAULT_DFA_RECOMPILE_MAX_MEM_BYTES,
+          DEFAULT_DFA_RECOMPILE_BUDGET_BYTES,
+          0, // No global DFA memory budget
+          DEFAULT_DFA_COLD_MAX_MEM_BYTES,
+          DEFAULT_JAVA_DFA_MAX_INPUT_LENGTH,
+          0, // No frozen DFA tables
+          false); // DFA failures not tracked
 
   /**
    * Compact constructor with validation.
@@ -319,6 +447,103 @@ public record RE2Config(
                 + ")");
       }
     }
+
+    // Validate DFA recompilation only if enabled
+    if (dfaRecompileEnabled) {
+      if (dfaRecompileFailureThreshold <= 0) {
+        throw new IllegalArgumentException(
+            "dfaRecompileFailureThreshold must be positive when DFA recompilation enabled");
+      }
+      if (dfaRecompileMaxMemBytes <= Pattern.DEFAULT_MAX_MEM_BYTES) {
+        throw new IllegalArgumentException(
+            "dfaRecompileMaxMemBytes ("
+                + dfaRecompileMaxMemBytes
+                + ") must exceed RE2's default max_mem ("
+                + Pattern.DEFAULT_MAX_MEM_BYTES
+                + ")");
+      }
+      if (dfaRecompileBudgetBytes <= 0) {
+        throw new IllegalArgumentException(
+            "dfaRecompileBudgetBytes must be positive when DFA recompilation enabled");
+      }
+    }
+
+    // Validate global DFA memory budget only if enabled
+    if (dfaMemoryBudgetBytes < 0) {
+      throw new IllegalArgumentException("dfaMemoryBudgetBytes must be non-negative (0 disables)");
+    }
+    if (dfaMemoryBudgetBytes > 0) {
+      if (dfaColdMaxMemBytes <= 0) {
+        throw new IllegalArgumentException(
+            "dfaColdMaxMemBytes must be positive when DFA memory budget enabled");
+      }
+      if (dfaColdMaxMemBytes > dfaRecompileMaxMemBytes) {
+        throw new IllegalArgumentException(
+            "dfaColdMaxMemBytes ("
+                + dfaColdMaxMemBytes
+                + ") cannot exceed dfaRecompileMaxMemBytes ("
+                + dfaRecompileMaxMemBytes
+                + ")");
+      }
+      if (dfaMemoryBudgetBytes < dfaColdMaxMemBytes) {
+        throw new IllegalArgumentException(
+            "dfaMemoryBudgetBytes ("
+                + dfaMemoryBudgetBytes
+                + ") must be >= dfaColdMaxMemBytes ("
+                + dfaColdMaxMemBytes
+                + ")");
+      }
+    }
+
+    if (javaDfaMaxInputLength < 0) {
+      throw new IllegalArgumentException(
+          "javaDfaMaxInputLength must be non-negative (0 disables)");
+    }
+
+    if (dfaFreezeHotPatterns < 0) {
+      throw new IllegalArgumentException(
+          "dfaFreezeHotPatterns must be non-negative (0 disables)");
+    }
+  }
+
+  /**
+   * Creates a configuration with DFA budget recompilation, the global DFA memory budget and DFA
+   * failure tracking disabled.
+   *
+   * <p>Equivalent to the 1.2 constructor; DFA memory, Java DFA tier and frozen DFA settings take
+   * their defaults.
+   */
+  public RE2Config(
+      boolean cacheEnabled,
+      int maxCacheSize,
+      long idleTimeoutSeconds,
+      long evictionScanIntervalSeconds,
+      long deferredCleanupIntervalSeconds,
+      long evictionProtectionMs,
+      int maxSimultaneousCompiledPatterns,
+      int maxMatchersPerPattern,
+      boolean validateCachedPatterns,
+      RE2MetricsRegistry metricsRegistry) {
+    this(
+        cacheEnabled,
+        maxCacheSize,
+        idleTimeoutSeconds,
+        evictionScanIntervalSeconds,
+        deferredCleanupIntervalSeconds,
+        evictionProtectionMs,
+        maxSimultaneousCompiledPatterns,
+        maxMatchersPerPattern,
+        validateCachedPatterns,
+        metricsRegistry,
+        false,
+        DEFAULT_DFA_RECOMPILE_FAILURE_THRESHOLD,
+        DEFAULT_DFA_RECOMPILE_MAX_MEM_BYTES,
+        DEFAULT_DFA_RECOMPILE_BUDGET_BYTES,
+        0,
+        DEFAULT_DFA_COLD_MAX_MEM_BYTES,
+        DEFAULT_JAVA_DFA_MAX_INPUT_LENGTH,
+        0,
+        false);
   }
 
   /**
@@ -356,6 +581,15 @@ public record RE2Config(
     private int maxMatchersPerPattern = 10000;
     private boolean validateCachedPatterns = true;
     private RE2MetricsRegistry metricsRegistry = NoOpMetricsRegistry.INSTANCE;
+    private boolean dfaRecompileEnabled = false;
+    private long dfaRecompileFailureThreshold = DEFAULT_DFA_RECOMPILE_FAILURE_THRESHOLD;
+    private long dfaRecompileMaxMemBytes = DEFAULT_DFA_RECOMPILE_MAX_MEM_BYTES;
+    private long dfaRecompileBudgetBytes = DEFAULT_DFA_RECOMPILE_BUDGET_BYTES;
+    private long dfaMemoryBudgetBytes = 0;
+    private long dfaColdMaxMemBytes = DEFAULT_DFA_COLD_MAX_MEM_BYTES;
+    private int javaDfaMaxInputLength = DEFAULT_JAVA_DFA_MAX_INPUT_LENGTH;
+    private int dfaFreezeHotPatterns = 0;
+    private boolean dfaFailureTrackingEnabled = false;
 
     /**
      * Enable or disable pattern caching.
@@ -545,6 +779,167 @@ public record RE2Config(
       return this;
     }
 
+    /**
+     * Enable or disable recompilation of patterns that exhaust their DFA memory budget.
+     *
+     * <p><b>Default: disabled (false)</b>
+     *
+     * <p>When enabled, each idle eviction scan recompiles cached patterns whose DFA ran out of
+     * memory at least {@code dfaRecompileFailureThreshold} times since the previous scan, with
+     * double the max_mem (capped at {@code dfaRecompileMaxMemBytes}). Hottest patterns are
+     * recompiled first. The old compilation is freed once unused, no sooner than {@code
+     * evictionProtectionMs} after the swap.
+     *
+     * @param enabled true to recompile chronic DFA failures, false to leave them on the NFA
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder dfaRecompileEnabled(boolean enabled) {
+      this.dfaRecompileEnabled = enabled;
+      return this;
+    }
+
+    /**
+     * Set DFA failures per eviction scan that mark a cached pattern for recompilation.
+     *
+     * <p><b>Default: 100</b>
+     *
+     * @param threshold failures per scan interval (must be > 0)
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder dfaRecompileFailureThreshold(long threshold) {
+      this.dfaRecompileFailureThreshold = threshold;
+      return this;
+    }
+
+    /**
+     * Set the largest max_mem a pattern may be recompiled with.
+     *
+     * <p><b>Default: 64MB</b>
+     *
+     * <p>Patterns already at this limit are left alone even if their DFA keeps failing.
+     *
+     * @param bytes per-pattern max_mem cap (must exceed RE2's 8MB default)
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder dfaRecompileMaxMemBytes(long bytes) {
+      this.dfaRecompileMaxMemBytes = bytes;
+      return this;
+    }
+
+    /**
+     * Set total extra max_mem that may be granted across all cached patterns.
+     *
+     * <p><b>Default: 256MB</b>
+     *
+     * <p>Extra budget is returned when a recompiled pattern is evicted. Recompilations that would
+     * exceed it are skipped (see {@code cache.dfa.budget.rejections.total.count}).
+     *
+     * @param bytes total extra max_mem in bytes (must be > 0)
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder dfaRecompileBudgetBytes(long bytes) {
+      this.dfaRecompileBudgetBytes = bytes;
+      return this;
+    }
+
+    /**
+     * Set the process-wide max_mem budget shared by all cached patterns.
+     *
+     * <p><b>Default: 0 (disabled)</b> - each pattern gets RE2's 8MB default
+     *
+     * <p>When set, new patterns compile with {@code dfaColdMaxMemBytes} and the idle eviction scan
+     * reassigns allowances from observed hotness: hot patterns that need more DFA memory are
+     * promoted (up to {@code dfaRecompileMaxMemBytes}), cold promoted patterns are demoted to make
+     * room. Replaces {@code dfaRecompileBudgetBytes} as the limit for promotions.
+     *
+     * <p>Size it as {@code working set × dfaColdMaxMemBytes} plus headroom for hot patterns.
+     *
+     * @param bytes total max_mem across cached patterns (0 disables, must be ≥ dfaColdMaxMemBytes)
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder dfaMemoryBudgetBytes(long bytes) {
+      this.dfaMemoryBudgetBytes = bytes;
+      return this;
+    }
+
+    /**
+     * Set the max_mem new cached patterns start with under the global DFA memory budget.
+     *
+     * <p><b>Default: 1MB</b>
+     *
+     * <p>Ignored unless {@code dfaMemoryBudgetBytes} is set. Patterns whose program alone does not
+     * fit are compiled with RE2's 8MB default instead.
+     *
+     * @param bytes starting max_mem (must be > 0 and ≤ dfaRecompileMaxMemBytes)
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder dfaColdMaxMemBytes(long bytes) {
+      this.dfaColdMaxMemBytes = bytes;
+      return this;
+    }
+
+    /**
+     * Set the longest String matched by the Java DFA tier.
+     *
+     * <p><b>Default: 32 chars</b>
+     *
+     * <p>{@code Matcher.matches()} and {@code Matcher.find()} on inputs up to this length step a
+     * compact copy of the pattern's DFA in Java instead of calling into RE2, for patterns whose DFA
+     * is small enough to copy. Results are identical either way.
+     *
+     * @param chars longest input in chars (0 disables the tier)
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder javaDfaMaxInputLength(int chars) {
+      this.javaDfaMaxInputLength = chars;
+      return this;
+    }
+
+    /**
+     * Set how many of the most used cached patterns have their DFA frozen.
+     *
+     * <p><b>Default: 0 (disabled)</b>
+     *
+     * <p>Each idle eviction scan freezes the DFA of the cached patterns used most since the
+     * previous scan, keeping at most this many frozen at a time. Frozen patterns match on
+     * immutable tables without RE2's DFA cache lock, which removes contention when many threads
+     * share one pattern. Patterns whose DFA is too large stay on RE2.
+     *
+     * @param patterns most frozen patterns at a time (0 disables)
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder dfaFreezeHotPatterns(int patterns) {
+      this.dfaFreezeHotPatterns = patterns;
+      return this;
+    }
+
+    /**
+     * Enable or disable counting of DFA memory exhaustion per pattern.
+     *
+     * <p><b>Default: disabled (false)</b> - always on while DFA recompilation or the global DFA
+     * memory budget is enabled, which act on the counts
+     *
+     * <p>Applies process-wide to patterns compiled after the cache is created. It compiles them
+     * with RE2's {@code log_errors} option, so RE2 also logs its parse and compile errors through
+     * Abseil; the process's Abseil stderr threshold decides whether those reach stderr.
+     *
+     * @param enabled true to count DFA failures without acting on them
+     * @return this builder
+     * @since 1.3.0
+     */
+    public Builder dfaFailureTrackingEnabled(boolean enabled) {
+      this.dfaFailureTrackingEnabled = enabled;
+      return this;
+    }
+
     /**
      * Build immutable configuration.
      *
@@ -565,7 +960,16 @@ public record RE2Config(
           maxSimultaneousCompiledPatterns,
           maxMatchersPerPattern,
           validateCachedPatterns,
-          metricsRegistry);
+          metricsRegistry,
+          dfaRecompileEnabled,
+          dfaRecompileFailureThreshold,
+          dfaRecompileMaxMemBytes,
+          dfaRecompileBudgetBytes,
+          dfaMemoryBudgetBytes,
+          dfaColdMaxMemBytes,
+          javaDfaMaxInputLength,
+          dfaFreezeHotPatterns,
+          dfaFailureTrackingEnabled);
     }
   }
 }
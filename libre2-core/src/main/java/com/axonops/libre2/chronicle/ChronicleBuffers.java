@@ -0,0 +1,114 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.chronicle;
+
+import com.axonops.libre2.api.Pattern;
+import java.nio.ByteBuffer;
+import java.util.Objects;
+import net.openhft.chronicle.bytes.BytesStore;
+import net.openhft.chronicle.bytes.MappedBytes;
+
+/**
+ * Matches Chronicle {@code Bytes} / {@link BytesStore}s in place - requires {@code
+ * chronicle-bytes} on the classpath.
+ *
+ * <p>The readable range ({@code readPosition()} to {@code readLimit()}) is matched; positions are
+ * not moved. Native (direct memory) stores are matched by address with no copy. Heap stores and
+ * {@link MappedBytes}, whose readable range may span separately mapped chunks, are copied once.
+ *
+ * <pre>{@code
+ * Bytes<?> bytes = Bytes.allocateElasticDirect();
+ * bytes.append("user=alice id=42");
+ * boolean found = ChronicleBuffers.find(pattern, bytes);
+ * }</pre>
+ *
+ * @since 1.3.0
+ */
+public final class ChronicleBuffers {
+
+  private ChronicleBuffers() {
+    // Utility class
+  }
+
+  /**
+   * Tests if the readable bytes match the pattern entirely.
+   *
+   * @param pattern compiled pattern
+   * @param bytes UTF-8 bytes (readable range is matched)
+   * @return true if the readable bytes match the pattern entirely
+   * @throws NullPointerException if pattern or bytes is null
+   * @throws IllegalArgumentException if more than {@code Integer.MAX_VALUE} bytes are readable
+   * @throws IllegalStateException if pattern is closed
+   */
+  public static boolean matches(Pattern pattern, BytesStore<?, ?> bytes) {
+    return match(pattern, bytes, true);
+  }
+
+  /**
+   * Tests if the pattern matches anywhere in the readable bytes.
+   *
+   * @param pattern compiled pattern
+   * @param bytes UTF-8 bytes (readable range is matched)
+   * @return true if the pattern matches anywhere in the readable bytes
+   * @throws NullPointerException if pattern or bytes is null
+   * @throws IllegalArgumentException if more than {@code Integer.MAX_VALUE} bytes are readable
+   * @throws IllegalStateException if pattern is closed
+   */
+  public static boolean find(Pattern pattern, BytesStore<?, ?> bytes) {
+    return match(pattern, bytes, false);
+  }
+
+  private static boolean match(Pattern pattern, BytesStore<?, ?> bytes, boolean fullMatch) {
+    Objects.requireNonNull(pattern, "pattern cannot be null");
+    Objects.requireNonNull(bytes, "bytes cannot be null");
+
+    long remaining = bytes.readRemaining();
+    if (route(remaining, bytes.isDirectMemory(), bytes instanceof MappedBytes) == Route.ADDRESS) {
+      long address = bytes.addressForRead(bytes.readPosition());
+      int length = (int) remaining;
+      return fullMatch ? pattern.matches(address, length) : pattern.find(address, length);
+    }
+
+    ByteBuffer copy = ByteBuffer.wrap(bytes.toByteArray());
+    return fullMatch ? pattern.matches(copy) : pattern.find(copy);
+  }
+
+  /** How a store's readable range is handed to native code. */
+  enum Route {
+    /** Matched in place by address. */
+    ADDRESS,
+    /** Copied once into a heap buffer. */
+    COPY
+  }
+
+  /**
+   * Chooses the route for a store's readable range. Kept free of Chronicle types so it can be
+   * tested without Chronicle's JVM flags.
+   *
+   * @param readRemaining readable byte count
+   * @param directMemory whether the store is backed by native memory
+   * @param mapped whether the store is a {@link MappedBytes}, which may span separately mapped
+   *     chunks
+   * @throws IllegalArgumentException if more than {@code Integer.MAX_VALUE} bytes are readable
+   */
+  static Route route(long readRemaining, boolean directMemory, boolean mapped) {
+    if (readRemaining > Integer.MAX_VALUE) {
+      throw new IllegalArgumentException("Readable range too large to match: " + readRemaining);
+    }
+    return directMemory && !mapped ? Route.ADDRESS : Route.COPY;
+  }
+}
@@ -31,6 +31,8 @@ public interface IRE2Native {
   // Pattern lifecycle
   long compile(String pattern, boolean caseSensitive);
 
+  long compileWithMaxMem(String pattern, boolean caseSensitive, long maxMem);
+
   void freePattern(long handle);
 
   boolean patternOk(long handle);
@@ -43,6 +45,12 @@ public interface IRE2Native {
 
   long patternMemory(long handle);
 
+  boolean setDfaFailureTracking(boolean enabled);
+
+  long dfaFailureCount(long handle);
+
+  long scratchAllocations();
+
   // Matching operations
   boolean fullMatch(long handle, String text);
 
@@ -72,6 +80,59 @@ public interface IRE2Native {
 
   String[][] findAllMatchesDirect(long handle, long address, int length);
 
+  // Group-by aggregation
+  Object[] aggregateBulk(long handle, String[] texts, int keyGroup, int valueGroup);
+
+  Object[] aggregateDirectBulk(
+      long handle, long[] addresses, int[] lengths, int keyGroup, int valueGroup);
+
+  int[] splitBulk(long handle, String[] texts, int limit);
+
+  int[] splitDirectBulk(long handle, long[] addresses, int[] lengths, int limit);
+
+  int[] extractGroupsDirectBulk(long handle, long[] addresses, int[] lengths);
+
+  int[] findAllMatchesDirectBulk(long handle, long[] addresses, int[] lengths);
+
+  boolean[] matchSortedBulk(long handle, String[] texts, boolean fullMatch);
+
+  boolean[] matchSortedDirectBulk(
+      long handle, long[] addresses, int[] lengths, boolean fullMatch);
+
+  int matchToArena(
+      long handle, long textAddress, int textLength, long arenaAddress, int arenaInts, boolean all);
+
+  boolean matchSegments(
+      long handle, long[] segmentAddresses, int[] segmentLengths, boolean fullMatch);
+
+  long[] matchFieldBulk(
+      long handle,
+      long[] recordAddresses,
+      int[] recordLengths,
+      int format,
+      byte[] selector,
+      int column,
+      boolean fullMatch);
+
+  // Pattern expressions
+  long compileExpression(int[] program, long[] patternHandles, byte[] literals);
+
+  void freeExpression(long expressionHandle);
+
+  boolean evaluateExpression(long expressionHandle, String text);
+
+  boolean evaluateExpressionDirect(long expressionHandle, long textAddress, int textLength);
+
+  boolean[] evaluateExpressionBulk(long expressionHandle, String[] texts);
+
+  boolean[] evaluateExpressionDirectBulk(
+      long expressionHandle, long[] textAddresses, int[] textLengths);
+
+  long[] expressionStats(long expressionHandle);
+
+  // Record mapping
+  int mapFields(long handle, String text, boolean fullMatch, int[] fieldSpec, long[] fields);
+
   String[] getNamedGroups(long handle);
 
   // Replace operations
@@ -87,8 +148,35 @@ public interface IRE2Native {
 
   String[] replaceAllDirectBulk(long handle, long[] addresses, int[] lengths, String replacement);
 
+  int maskDirect(long handle, long address, int length, byte[] mask);
+
+  long maskDirectBulk(long handle, long[] addresses, int[] lengths, byte[] mask);
+
   // Utility methods
   String quoteMeta(String text);
 
   int[] programFanout(long handle);
+
+  long[] explain(long handle);
+
+  int[] dfaTable(long handle);
+
+  int[] compactDfa(long handle, boolean fullMatch, int maxEntries);
+
+  // Frozen DFA tables
+  long freezeDfa(long handle, int maxStates);
+
+  long freezeBitParallel(long handle);
+
+  void freeFrozenDfa(long frozenHandle);
+
+  boolean frozenMatch(long handle, long frozenHandle, String text, boolean fullMatch);
+
+  boolean frozenMatchDirect(
+      long handle, long frozenHandle, long textAddress, int textLength, boolean fullMatch);
+
+  boolean[] frozenMatchBulk(long handle, long frozenHandle, String[] texts, boolean fullMatch);
+
+  boolean[] frozenMatchDirectBulk(
+      long handle, long frozenHandle, long[] textAddresses, int[] textLengths, boolean fullMatch);
 }
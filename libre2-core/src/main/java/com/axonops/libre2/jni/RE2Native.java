@@ -37,6 +37,11 @@ public final class RE2Native implements IRE2Native {
     return RE2NativeJNI.compile(pattern, caseSensitive);
   }
 
+  @Override
+  public long compileWithMaxMem(String pattern, boolean caseSensitive, long maxMem) {
+    return RE2NativeJNI.compileWithMaxMem(pattern, caseSensitive, maxMem);
+  }
+
   @Override
   public void freePattern(long handle) {
     RE2NativeJNI.freePattern(handle);
@@ -67,6 +72,21 @@ public final class RE2Native implements IRE2Native {
     return RE2NativeJNI.patternMemory(handle);
   }
 
+  @Override
+  public boolean setDfaFailureTracking(boolean enabled) {
+    return RE2NativeJNI.setDfaFailureTracking(enabled);
+  }
+
+  @Override
+  public long dfaFailureCount(long handle) {
+    return RE2NativeJNI.dfaFailureCount(handle);
+  }
+
+  @Override
+  public long scratchAllocations() {
+    return RE2NativeJNI.scratchAllocations();
+  }
+
   @Override
   public boolean fullMatch(long handle, String text) {
     return RE2NativeJNI.fullMatch(handle, text);
@@ -132,6 +152,121 @@ public final class RE2Native implements IRE2Native {
     return RE2NativeJNI.findAllMatchesDirect(handle, address, length);
   }
 
+  @Override
+  public Object[] aggregateBulk(long handle, String[] texts, int keyGroup, int valueGroup) {
+    return RE2NativeJNI.aggregateBulk(handle, texts, keyGroup, valueGroup);
+  }
+
+  @Override
+  public Object[] aggregateDirectBulk(
+      long handle, long[] addresses, int[] lengths, int keyGroup, int valueGroup) {
+    return RE2NativeJNI.aggregateDirectBulk(handle, addresses, lengths, keyGroup, valueGroup);
+  }
+
+  @Override
+  public int[] splitBulk(long handle, String[] texts, int limit) {
+    return RE2NativeJNI.splitBulk(handle, texts, limit);
+  }
+
+  @Override
+  public int[] splitDirectBulk(long handle, long[] addresses, int[] lengths, int limit) {
+    return RE2NativeJNI.splitDirectBulk(handle, addresses, lengths, limit);
+  }
+
+  @Override
+  public int[] extractGroupsDirectBulk(long handle, long[] addresses, int[] lengths) {
+    return RE2NativeJNI.extractGroupsDirectBulk(handle, addresses, lengths);
+  }
+
+  @Override
+  public int[] findAllMatchesDirectBulk(long handle, long[] addresses, int[] lengths) {
+    return RE2NativeJNI.findAllMatchesDirectBulk(handle, addresses, lengths);
+  }
+
+  @Override
+  public boolean[] matchSortedBulk(long handle, String[] texts, boolean fullMatch) {
+    return RE2NativeJNI.matchSortedBulk(handle, texts, fullMatch);
+  }
+
+  @Override
+  public boolean[] matchSortedDirectBulk(
+      long handle, long[] addresses, int[] lengths, boolean fullMatch) {
+    return RE2NativeJNI.matchSortedDirectBulk(handle, addresses, lengths, fullMatch);
+  }
+
+  @Override
+  public int matchToArena(
+      long handle,
+      long textAddress,
+      int textLength,
+      long arenaAddress,
+      int arenaInts,
+      boolean all) {
+    return RE2NativeJNI.matchToArena(
+        handle, textAddress, textLength, arenaAddress, arenaInts, all);
+  }
+
+  @Override
+  public boolean matchSegments(
+      long handle, long[] segmentAddresses, int[] segmentLengths, boolean fullMatch) {
+    return RE2NativeJNI.matchSegments(handle, segmentAddresses, segmentLengths, fullMatch);
+  }
+
+  @Override
+  public long[] matchFieldBulk(
+      long handle,
+      long[] recordAddresses,
+      int[] recordLengths,
+      int format,
+      byte[] selector,
+      int column,
+      boolean fullMatch) {
+    return RE2NativeJNI.matchFieldBulk(
+        handle, recordAddresses, recordLengths, format, selector, column, fullMatch);
+  }
+
+  @Override
+  public long compileExpression(int[] program, long[] patternHandles, byte[] literals) {
+    return RE2NativeJNI.compileExpression(program, patternHandles, literals);
+  }
+
+  @Override
+  public void freeExpression(long expressionHandle) {
+    RE2NativeJNI.freeExpression(expressionHandle);
+  }
+
+  @Override
+  public boolean evaluateExpression(long expressionHandle, String text) {
+    return RE2NativeJNI.evaluateExpression(expressionHandle, text);
+  }
+
+  @Override
+  public boolean evaluateExpressionDirect(long expressionHandle, long textAddress, int textLength) {
+    return RE2NativeJNI.evaluateExpressionDirect(expressionHandle, textAddress, textLength);
+  }
+
+  @Override
+  public boolean[] evaluateExpressionBulk(long expressionHandle, String[] texts) {
+    return RE2NativeJNI.evaluateExpressionBulk(expressionHandle, texts);
+  }
+
+  @Override
+  public boolean[] evaluateExpressionDirectBulk(
+      long expressionHandle, long[] textAddresses, int[] textLengths) {
+    return RE2NativeJNI.evaluateExpressionDirectBulk(expressionHandle, textAddresses, textLengths);
+  }
+
+  @Override
+  public long[] expressionStats(long expressionHandle) {
+    return RE2NativeJNI.expressionStats(expressionHandle);
+  }
+
+  @Override
+  public int mapFields(
+      long handle, String text, boolean fullMatch, int[] fieldSpec, long[] fields) {
+    return RE2NativeJNI.mapFields(handle, text, fullMatch, fieldSpec, fields);
+  }
+
   @Override
   public String[] getNamedGroups(long handle) {
     return RE2NativeJNI.getNamedGroups(handle);
@@ -168,6 +303,16 @@ public final class RE2Native implements IRE2Native {
     return RE2NativeJNI.replaceAllDirectBulk(handle, addresses, lengths, replacement);
   }
 
+  @Override
+  public int maskDirect(long handle, long address, int length, byte[] mask) {
+    return RE2NativeJNI.maskDirect(handle, address, length, mask);
+  }
+
+  @Override
+  public long maskDirectBulk(long handle, long[] addresses, int[] lengths, byte[] mask) {
+    return RE2NativeJNI.maskDirectBulk(handle, addresses, lengths, mask);
+  }
+
   @Override
   public String quoteMeta(String text) {
     return RE2NativeJNI.quoteMeta(text);
@@ -177,4 +322,58 @@ public final class RE2Native implements IRE2Native {
   public int[] programFanout(long handle) {
     return RE2NativeJNI.programFanout(handle);
   }
+
+  @Override
+  public long[] explain(long handle) {
+    return RE2NativeJNI.explain(handle);
+  }
+
+  @Override
+  public int[] dfaTable(long handle) {
+    return RE2NativeJNI.dfaTable(handle);
+  }
+
+  @Override
+  public int[] compactDfa(long handle, boolean fullMatch, int maxEntries) {
+    return RE2NativeJNI.compactDfa(handle, fullMatch, maxEntries);
+  }
+
+  @Override
+  public long freezeDfa(long handle, int maxStates) {
+    return RE2NativeJNI.freezeDfa(handle, maxStates);
+  }
+
+  @Override
+  public long freezeBitParallel(long handle) {
+    return RE2NativeJNI.freezeBitParallel(handle);
+  }
+
+  @Override
+  public void freeFrozenDfa(long frozenHandle) {
+    RE2NativeJNI.freeFrozenDfa(frozenHandle);
+  }
+
+  @Override
+  public boolean frozenMatch(long handle, long frozenHandle, String text, boolean fullMatch) {
+    return RE2NativeJNI.frozenMatch(handle, frozenHandle, text, fullMatch);
+  }
+
+  @Override
+  public boolean frozenMatchDirect(
+      long handle, long frozenHandle, long textAddress, int textLength, boolean fullMatch) {
+    return RE2NativeJNI.frozenMatchDirect(handle, frozenHandle, textAddress, textLength, fullMatch);
+  }
+
+  @Override
+  public boolean[] frozenMatchBulk(
+      long handle, long frozenHandle, String[] texts, boolean fullMatch) {
+    return RE2NativeJNI.frozenMatchBulk(handle, frozenHandle, texts, fullMatch);
+  }
+
+  @Override
+  public boolean[] frozenMatchDirectBulk(
+      long handle, long frozenHandle, long[] textAddresses, int[] textLengths, boolean fullMatch) {
+    return RE2NativeJNI.frozenMatchDirectBulk(
+        handle, frozenHandle, textAddresses, textLengths, fullMatch);
+  }
 }
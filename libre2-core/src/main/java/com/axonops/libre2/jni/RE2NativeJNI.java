@@ -71,6 +71,20 @@ final class RE2NativeJNI {
    */
   static native long compile(String pattern, boolean caseSensitive);
 
+  /**
+   * Compiles a regular expression pattern with an explicit RE2 memory budget.
+   *
+   * <p>{@code maxMem} bounds the compiled program plus its DFA caches. RE2's default is 8MB; when a
+   * DFA exhausts its share of the budget too often RE2 falls back to the much slower NFA.
+   *
+   * @param pattern regex pattern string (UTF-8)
+   * @param caseSensitive true for case-sensitive, false for case-insensitive
+   * @param maxMem RE2 max_mem budget in bytes (must be positive)
+   * @return native handle to compiled pattern, or 0 on error (MUST be freed)
+   * @since 1.3.0
+   */
+  static native long compileWithMaxMem(String pattern, boolean caseSensitive, long maxMem);
+
   /**
    * Frees a compiled pattern. Safe to call with 0 handle (no-op).
    *
@@ -138,6 +152,43 @@ final class RE2NativeJNI {
    */
   static native long patternMemory(long handle);
 
+  /**
+   * Turns DFA failure tracking on or off for patterns compiled afterwards.
+   *
+   * <p>While on, patterns compile with RE2's {@code log_errors} option so their "DFA out of memory"
+   * events can be counted. RE2 then also logs parse and compile errors through Abseil.
+   *
+   * @param enabled whether to track DFA failures
+   * @return true if tracking is now on, false if off or unavailable in this native build
+   * @since 1.3.0
+   */
+  static native boolean setDfaFailureTracking(boolean enabled);
+
+  /**
+   * Gets how many times this pattern's DFA ran out of memory (RE2 then falls back to the NFA).
+   *
+   * <p>Counted natively by capturing RE2's "DFA out of memory" log events and attributing them to
+   * the pattern executing on the current thread.
+   *
+   * @param handle compiled pattern handle
+   * @return cumulative DFA failure count, 0 if handle is 0, or -1 if detection is unavailable in
+   *     this native build or tracking is off
+   * @since 1.3.0
+   */
+  static native long dfaFailureCount(long handle);
+
+  /**
+   * Gets how many times the calling thread's native scratch buffers (capture group pieces, result
+   * staging, String conversion) have allocated or grown.
+   *
+   * <p>Hot paths reuse per-thread scratch, so the count stays constant across repeated calls of
+   * the same shape. Intended for allocation regression tests.
+   *
+   * @return cumulative scratch allocation count for the calling thread
+   * @since 1.3.0
+   */
+  static native long scratchAllocations();
+
   // ========== Bulk Matching Operations ==========
 
   /**
@@ -273,6 +324,38 @@ final class RE2NativeJNI {
   static native String[] replaceAllDirectBulk(
       long handle, long[] textAddresses, int[] textLengths, String replacement);
 
+  // ========== In-Place Masking ==========
+
+  /**
+   * Overwrites every non-empty match in off-heap text with the mask bytes, repeated from the start
+   * of each match. The text keeps its length; nothing is allocated.
+   *
+   * <p><strong>Memory Safety:</strong> The text must remain valid and writable for the duration of
+   * this call.
+   *
+   * @param handle compiled pattern handle
+   * @param textAddress native memory address of UTF-8 text
+   * @param textLength number of bytes
+   * @param mask 1 to 256 mask bytes
+   * @return number of matches masked, or -1 on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native int maskDirect(long handle, long textAddress, int textLength, byte[] mask);
+
+  /**
+   * Masks every match in multiple off-heap regions in place, e.g. records packed into one buffer.
+   * Regions must not overlap.
+   *
+   * @param handle compiled pattern handle
+   * @param textAddresses native memory addresses (0 entries are skipped)
+   * @param textLengths number of bytes for each address
+   * @param mask 1 to 256 mask bytes
+   * @return total number of matches masked, or -1 on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native long maskDirectBulk(
+      long handle, long[] textAddresses, int[] textLengths, byte[] mask);
+
   // ========== Utility Operations ==========
 
   /**
@@ -293,6 +376,134 @@ final class RE2NativeJNI {
    */
   static native int[] programFanout(long handle);
 
+  /**
+   * Describes how RE2 will execute a compiled pattern. Values are indexed by the {@code EXPLAIN_*}
+   * constants in {@link com.axonops.libre2.api.PatternExplanation}; fields that need RE2 internals
+   * the native library was built without are -1.
+   *
+   * @param handle compiled pattern handle
+   * @return explanation fields, or null on error
+   * @since 1.3.0
+   */
+  static native long[] explain(long handle);
+
+  /**
+   * Exports the pattern's full-match DFA, materialized from the RE2 program and bounded by the
+   * pattern's memory budget, for byte-at-a-time stepping. Layout as read by {@link
+   * com.axonops.libre2.api.PatternAutomaton}.
+   *
+   * @param handle compiled pattern handle
+   * @return DFA table, an empty array if the DFA is unavailable, or null on error
+   * @since 1.3.0
+   */
+  static native int[] dfaTable(long handle);
+
+  /**
+   * Exports a small DFA for full or partial matching, built with a budget sized for maxEntries
+   * transitions. Layout as read by {@code com.axonops.libre2.api.CompactDfa}.
+   *
+   * @param handle compiled pattern handle
+   * @param fullMatch true for the full-match DFA, false for partial match
+   * @param maxEntries largest table (states × classes) worth exporting
+   * @return DFA table, an empty array if the DFA is unavailable or larger, or null on error
+   * @since 1.3.0
+   */
+  static native int[] compactDfa(long handle, boolean fullMatch, int maxEntries);
+
+  // ========== Frozen DFA Tables ==========
+  //
+  // A frozen pattern owns its complete DFA as an immutable table, matched without RE2's DFA cache
+  // lock. The frozen handle is separate from the pattern handle and must be freed separately.
+
+  /**
+   * Materializes the pattern's full- and partial-match DFAs into immutable tables.
+   *
+   * @param handle compiled pattern handle
+   * @param maxStates largest DFA (in states) worth freezing
+   * @return frozen handle, or 0 if the DFA is unavailable or larger (check getError() only if it
+   *     is non-empty)
+   * @since 1.3.0
+   */
+  static native long freezeDfa(long handle, int maxStates);
+
+  /**
+   * Builds a bit-parallel NFA from the pattern's compiled program, for patterns with at most 64
+   * byte-consuming positions. The handle is matched with the {@code frozenMatch} methods and freed
+   * with {@link #freeFrozenDfa}.
+   *
+   * @param handle compiled pattern handle
+   * @return frozen handle, or 0 if the pattern has too many positions or assertions other than
+   *     {@code ^}/{@code $} (check getError() only if it is non-empty)
+   * @since 1.3.0
+   */
+  static native long freezeBitParallel(long handle);
+
+  /**
+   * Frees the tables of a frozen pattern. Must not be called while a match on it is running.
+   *
+   * @param frozenHandle handle from {@link #freezeDfa} or {@link #freezeBitParallel}
+   * @since 1.3.0
+   */
+  static native void freeFrozenDfa(long frozenHandle);
+
+  /**
+   * Matches text on a frozen DFA.
+   *
+   * @param handle compiled pattern handle the frozen handle belongs to (for tracing and DFA failure
+   *     attribution)
+   * @param frozenHandle handle from {@link #freezeDfa} or {@link #freezeBitParallel}
+   * @param text input string
+   * @param fullMatch true for full match, false for partial match
+   * @return true if the text matches
+   * @since 1.3.0
+   */
+  static native boolean frozenMatch(
+      long handle, long frozenHandle, String text, boolean fullMatch);
+
+  /**
+   * Matches UTF-8 bytes at a memory address on a frozen DFA (zero-copy).
+   *
+   * @param handle compiled pattern handle the frozen handle belongs to (for tracing and DFA failure
+   *     attribution)
+   * @param frozenHandle handle from {@link #freezeDfa} or {@link #freezeBitParallel}
+   * @param textAddress native memory address of UTF-8 text
+   * @param textLength number of bytes
+   * @param fullMatch true for full match, false for partial match
+   * @return true if the text matches
+   * @since 1.3.0
+   */
+  static native boolean frozenMatchDirect(
+      long handle, long frozenHandle, long textAddress, int textLength, boolean fullMatch);
+
+  /**
+   * Matches many strings on a frozen DFA in one call.
+   *
+   * @param handle compiled pattern handle the frozen handle belongs to (for tracing and DFA failure
+   *     attribution)
+   * @param frozenHandle handle from {@link #freezeDfa} or {@link #freezeBitParallel}
+   * @param texts input strings (null elements do not match)
+   * @param fullMatch true for full match, false for partial match
+   * @return match flags parallel to texts, or null on error
+   * @since 1.3.0
+   */
+  static native boolean[] frozenMatchBulk(
+      long handle, long frozenHandle, String[] texts, boolean fullMatch);
+
+  /**
+   * Matches many memory regions on a frozen DFA in one call (zero-copy bulk).
+   *
+   * @param handle compiled pattern handle the frozen handle belongs to (for tracing and DFA failure
+   *     attribution)
+   * @param frozenHandle handle from {@link #freezeDfa} or {@link #freezeBitParallel}
+   * @param textAddresses native memory addresses of UTF-8 texts
+   * @param textLengths byte lengths (same size as textAddresses)
+   * @param fullMatch true for full match, false for partial match
+   * @return match flags parallel to the regions, or null on error
+   * @since 1.3.0
+   */
+  static native boolean[] frozenMatchDirectBulk(
+      long handle, long frozenHandle, long[] textAddresses, int[] textLengths, boolean fullMatch);
+
   // ========== Zero-Copy Direct Memory Operations ==========
   //
   // These methods accept raw memory addresses instead of Java Strings,
@@ -450,4 +661,330 @@ final class RE2NativeJNI {
    * @since 1.1.0
    */
   static native String[][] findAllMatchesDirect(long handle, long textAddress, int textLength);
+
+  // ========== Group-By Aggregation ==========
+  //
+  // Counts rows by a captured key in a native hash table, optionally with sum/min/max of an
+  // integer value group. Only the distinct keys are converted to Java Strings.
+  //
+  // Result layout: Object[] { String[] keys, long[] stats } where stats[0] is the number of rows
+  // that did not match (or whose key group did not participate), followed by count, valueCount,
+  // sum, min, max for each key in keys order.
+
+  /**
+   * Aggregates a batch of Strings by captured key.
+   *
+   * @param handle compiled pattern handle
+   * @param texts input strings (null elements count as unmatched)
+   * @param keyGroup group whose text is the key (0 = whole match)
+   * @param valueGroup group parsed as a base-10 integer for sum/min/max, or -1 for none
+   * @return Object[] { String[] keys, long[] stats }, or null on error
+   * @since 1.3.0
+   */
+  static native Object[] aggregateBulk(long handle, String[] texts, int keyGroup, int valueGroup);
+
+  /**
+   * Aggregates a batch of off-heap memory regions by captured key (zero-copy).
+   *
+   * <p><strong>Memory Safety:</strong> All memory regions must remain valid for the duration of
+   * this call.
+   *
+   * @param handle compiled pattern handle
+   * @param textAddresses native memory addresses of UTF-8 encoded text
+   * @param textLengths number of bytes for each address
+   * @param keyGroup group whose text is the key (0 = whole match)
+   * @param valueGroup group parsed as a base-10 integer for sum/min/max, or -1 for none
+   * @return Object[] { String[] keys, long[] stats }, or null on error
+   * @since 1.3.0
+   */
+  static native Object[] aggregateDirectBulk(
+      long handle, long[] textAddresses, int[] textLengths, int keyGroup, int valueGroup);
+
+  // ========== Split ==========
+  // Result layout: int[] { fieldCount[0], ..., fieldCount[n-1], start, end, start, end, ... }
+
+  /**
+   * Splits a batch of Strings around matches of the pattern.
+   *
+   * <p>Follows {@link String#split(String, int)}: {@code limit > 0} caps the number of fields,
+   * {@code limit == 0} drops trailing empty fields, {@code limit < 0} keeps them. Offsets are
+   * UTF-16 char indexes into each input; null inputs have no fields.
+   *
+   * @param handle compiled pattern handle
+   * @param texts inputs to split
+   * @param limit field limit, as for {@link String#split(String, int)}
+   * @return field counts per input followed by start/end pairs, or null on error
+   * @since 1.3.0
+   */
+  static native int[] splitBulk(long handle, String[] texts, int limit);
+
+  /**
+   * Splits a batch of off-heap memory regions around matches of the pattern (zero-copy).
+   *
+   * <p>Offsets are byte offsets relative to each region's address; regions with a zero address
+   * have no fields.
+   *
+   * <p><strong>Memory Safety:</strong> All memory regions must remain valid for the duration of
+   * this call.
+   *
+   * @param handle compiled pattern handle
+   * @param textAddresses native memory addresses of UTF-8 encoded text
+   * @param textLengths number of bytes for each address
+   * @param limit field limit, as for {@link String#split(String, int)}
+   * @return field counts per input followed by start/end pairs, or null on error
+   * @since 1.3.0
+   */
+  static native int[] splitDirectBulk(
+      long handle, long[] textAddresses, int[] textLengths, int limit);
+
+  // ========== Bulk Match Offsets ==========
+  // Result layout: int[] { matchCount[0], ..., matchCount[n-1], then per match a start, end byte
+  // offset pair for each group 0..numCapturingGroups (-1, -1 if the group did not participate) }
+
+  /**
+   * Extracts capture group offsets for the first match in each off-heap memory region.
+   *
+   * <p><strong>Memory Safety:</strong> All memory regions must remain valid for the duration of
+   * this call.
+   *
+   * @param handle compiled pattern handle
+   * @param textAddresses native memory addresses of UTF-8 encoded text
+   * @param textLengths number of bytes for each address
+   * @return match counts (0 or 1) per input followed by group offsets, or null on error
+   * @since 1.3.0
+   */
+  static native int[] extractGroupsDirectBulk(long handle, long[] textAddresses, int[] textLengths);
+
+  /**
+   * Finds all non-overlapping matches in each off-heap memory region.
+   *
+   * <p><strong>Memory Safety:</strong> All memory regions must remain valid for the duration of
+   * this call.
+   *
+   * @param handle compiled pattern handle
+   * @param textAddresses native memory addresses of UTF-8 encoded text
+   * @param textLengths number of bytes for each address
+   * @return match counts per input followed by group offsets per match, or null on error
+   * @since 1.3.0
+   */
+  static native int[] findAllMatchesDirectBulk(
+      long handle, long[] textAddresses, int[] textLengths);
+
+  // ========== Sorted Batch Matching ==========
+
+  /**
+   * Matches keys in order, resuming each key from the DFA state reached at the end of the prefix
+   * it shares with the previous key. Sorted keys with long common prefixes skip most of their
+   * bytes; any order gives correct results.
+   *
+   * <p>Needs a materialized DFA of the pattern; patterns whose DFA exceeds the memory budget (or
+   * native builds without RE2 internals) match each key with RE2 instead.
+   *
+   * @param handle compiled pattern handle
+   * @param texts keys to match, ideally sorted (null elements do not match)
+   * @param fullMatch true for full match, false for partial match
+   * @return match results, or null on error
+   * @since 1.3.0
+   */
+  static native boolean[] matchSortedBulk(long handle, String[] texts, boolean fullMatch);
+
+  /**
+   * Matches off-heap keys in order, resuming each from the DFA state at the prefix shared with the
+   * previous key.
+   *
+   * <p><strong>Memory Safety:</strong> All memory regions must remain valid for the duration of
+   * this call.
+   *
+   * @param handle compiled pattern handle
+   * @param textAddresses native memory addresses of UTF-8 encoded keys, ideally sorted
+   * @param textLengths number of bytes for each address
+   * @param fullMatch true for full match, false for partial match
+   * @return match results, or null on error
+   * @since 1.3.0
+   */
+  static native boolean[] matchSortedDirectBulk(
+      long handle, long[] textAddresses, int[] textLengths, boolean fullMatch);
+
+  // ========== Result Arena ==========
+
+  /**
+   * Writes capture group offsets for the first match, or every match, in off-heap text into a
+   * caller-owned off-heap arena. Creates no Java objects. Arena layout as read by {@link
+   * com.axonops.libre2.api.MatchView}.
+   *
+   * <p><strong>Memory Safety:</strong> The text and {@code arenaInts} ints at the arena address
+   * must remain valid for the duration of this call.
+   *
+   * @param handle compiled pattern handle
+   * @param textAddress native memory address of UTF-8 encoded text
+   * @param textLength number of bytes
+   * @param arenaAddress native memory address of the arena (int aligned)
+   * @param arenaInts arena capacity in ints
+   * @param all true for every non-overlapping match, false for the first match only
+   * @return 0 if the results fit, 1 if the arena is too small (its header holds the required
+   *     size), -1 on error
+   * @since 1.3.0
+   */
+  static native int matchToArena(
+      long handle,
+      long textAddress,
+      int textLength,
+      long arenaAddress,
+      int arenaInts,
+      boolean all);
+
+  // ========== Scatter-Gather Matching ==========
+
+  /**
+   * Full or partial match over (address, length) segments that together form one logical input,
+   * e.g. the components of a composite network buffer.
+   *
+   * <p>Where the pattern has a materialized DFA, native code steps it across segment boundaries
+   * without copying; otherwise the segments are gathered into per-thread native scratch.
+   *
+   * <p><strong>Memory Safety:</strong> All segments must remain valid for the duration of this
+   * call.
+   *
+   * @param handle compiled pattern handle
+   * @param segmentAddresses native memory addresses of the segments, in input order (0 allowed
+   *     for empty segments)
+   * @param segmentLengths number of bytes in each segment
+   * @param fullMatch true for full match, false for partial match
+   * @return true if the concatenated input matches; false on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native boolean matchSegments(
+      long handle, long[] segmentAddresses, int[] segmentLengths, boolean fullMatch);
+
+  // ========== Field-Aware Record Matching ==========
+
+  /**
+   * Matches one field of each raw JSON or CSV record (zero-copy).
+   *
+   * <p>Native code locates the field with a SIMD structural scan (quote, escape and delimiter
+   * bitmaps computed 64 bytes at a time) and matches its bytes in place; only fields containing
+   * escapes are decoded first. Records are never materialized as Java objects.
+   *
+   * <p><strong>Memory Safety:</strong> All records must remain valid for the duration of this
+   * call.
+   *
+   * @param handle compiled pattern handle
+   * @param recordAddresses native memory addresses of the records
+   * @param recordLengths byte length of each record
+   * @param format 0 for JSON objects, 1 for CSV rows
+   * @param selector JSON: UTF-8 object keys separated by NUL bytes; CSV: the delimiter byte
+   * @param column 0-based CSV column (ignored for JSON)
+   * @param fullMatch true for full match, false for partial match
+   * @return bitmap words, bit {@code i % 64} of word {@code i / 64} set if record {@code i} has
+   *     the field and it matches, or null on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native long[] matchFieldBulk(
+      long handle,
+      long[] recordAddresses,
+      int[] recordLengths,
+      int format,
+      byte[] selector,
+      int column,
+      boolean fullMatch);
+
+  // ========== Pattern Expressions ==========
+
+  /**
+   * Compiles a boolean expression over patterns, literal tests and length predicates.
+   *
+   * <p>The program is a preorder list of {@code (op, a, b)} triples. The referenced patterns must
+   * stay open until {@link #freeExpression(long)}.
+   *
+   * @param program preorder {@code (op, a, b)} node triples
+   * @param patternHandles compiled pattern handles referenced by pattern nodes
+   * @param literals UTF-8 bytes referenced by literal nodes (offset, length)
+   * @return expression handle, or 0 on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native long compileExpression(int[] program, long[] patternHandles, byte[] literals);
+
+  /**
+   * Frees a compiled expression. Safe to call with 0.
+   *
+   * @param expressionHandle expression handle
+   * @since 1.3.0
+   */
+  static native void freeExpression(long expressionHandle);
+
+  /**
+   * Evaluates an expression against a String, short-circuiting AND/OR nodes.
+   *
+   * @param expressionHandle expression handle
+   * @param text input text
+   * @return true if the expression holds; false on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native boolean evaluateExpression(long expressionHandle, String text);
+
+  /**
+   * Evaluates an expression against off-heap memory (zero-copy).
+   *
+   * @param expressionHandle expression handle
+   * @param textAddress native memory address of UTF-8 text
+   * @param textLength number of bytes
+   * @return true if the expression holds; false on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native boolean evaluateExpressionDirect(
+      long expressionHandle, long textAddress, int textLength);
+
+  /**
+   * Evaluates an expression against each String in one native call.
+   *
+   * @param expressionHandle expression handle
+   * @param texts inputs (null elements are false)
+   * @return results parallel to texts, or null on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native boolean[] evaluateExpressionBulk(long expressionHandle, String[] texts);
+
+  /**
+   * Evaluates an expression against each off-heap input in one native call (zero-copy).
+   *
+   * @param expressionHandle expression handle
+   * @param textAddresses native memory addresses of UTF-8 inputs
+   * @param textLengths byte length of each input
+   * @return results parallel to the inputs, or null on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native boolean[] evaluateExpressionDirectBulk(
+      long expressionHandle, long[] textAddresses, int[] textLengths);
+
+  /**
+   * Sampled evaluation statistics of every expression node in preorder: {@code samples,
+   * trueSamples, costNanos, childOrder} per node, where {@code childOrder} packs the current
+   * evaluation order of an AND/OR node's children 4 bits per position.
+   *
+   * @param expressionHandle expression handle
+   * @return statistics, or null on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native long[] expressionStats(long expressionHandle);
+
+  // ========== Record Mapping ==========
+
+  /**
+   * Matches a String and extracts the groups behind a record's components in one call.
+   *
+   * <p>For each component, {@code fields} receives {@code start, end, status, value}: the group's
+   * UTF-16 offsets (-1 if it did not participate), a status (0 parsed, 1 absent, 2 not parsed
+   * natively - parse the text in Java) and, for numeric kinds, the long value or the double's raw
+   * bits.
+   *
+   * @param handle compiled pattern handle
+   * @param text input text
+   * @param fullMatch true for full match, false for partial match
+   * @param fieldSpec {@code (group index, kind)} per component; kind 0 text, 1 long, 2 double
+   * @param fields receives 4 slots per component
+   * @return 1 if matched, 0 if not, -1 on error (check {@link #getError()})
+   * @since 1.3.0
+   */
+  static native int mapFields(
+      long handle, String text, boolean fullMatch, int[] fieldSpec, long[] fields);
 }
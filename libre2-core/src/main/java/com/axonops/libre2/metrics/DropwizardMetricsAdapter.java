@@ -97,6 +97,11 @@ public final class DropwizardMetricsAdapter implements RE2MetricsRegistry {
     registry.timer(metricName(name)).update(durationNanos, TimeUnit.NANOSECONDS);
   }
 
+  @Override
+  public void recordHistogram(String name, long value) {
+    registry.histogram(metricName(name)).update(value);
+  }
+
   @Override
   public void registerGauge(String name, Supplier<Number> valueSupplier) {
     String fullName = metricName(name);
@@ -104,6 +104,7 @@ package com.axonops.libre2.metrics;
  *   <li><b>Deferred Cleanup (4 metrics)</b> - Patterns awaiting cleanup (in use by matchers)
  *   <li><b>Resource Management (4 metrics)</b> - Active patterns/matchers and cleanup tracking
  *   <li><b>Performance (3 metrics)</b> - Matching operation latencies (RE2 guarantees linear time)
+ *   <li><b>Throughput (15 metrics)</b> - Bytes scanned, input-length histograms and bytes/second
  *   <li><b>Errors (3 metrics)</b> - Compilation failures and resource exhaustion
  * </ul>
  *
@@ -112,6 +113,7 @@ package com.axonops.libre2.metrics;
  * <ul>
  *   <li><b>Counter</b> - Monotonically increasing count (suffix: {@code .total.count})
  *   <li><b>Timer</b> - Latency histogram with percentiles (suffix: {@code .latency})
+ *   <li><b>Histogram</b> - Value distribution with percentiles (suffix: {@code .input_length})
  *   <li><b>Gauge</b> - Current or peak value (suffix: {@code .current.*} or {@code .peak.*})
  * </ul>
  *
@@ -349,6 +351,161 @@ public final class MetricNames {
    */
   public static final String CACHE_DEFERRED_MEMORY_PEAK = "cache.deferred.native_memory.peak.bytes";
 
+  // ========================================
+  // DFA Budget Metrics (6)
+  // ========================================
+
+  /**
+   * DFA memory budget exhaustions observed across cached patterns.
+   *
+   * <p><b>Type:</b> Counter
+   *
+   * <p><b>Incremented:</b> By the idle eviction scan, with the failures each cached pattern saw
+   * since the previous scan
+   *
+   * <p><b>Interpretation:</b> Each failure is a match that fell back to the NFA (much slower).
+   * Sustained growth means hot patterns need a larger max_mem - see DFA recompilation in {@link
+   * com.axonops.libre2.cache.RE2Config}. Stays at zero if the native library cannot detect failures
+   *
+   * @since 1.3.0
+   */
+  public static final String DFA_FAILURES = "matching.dfa.failures.total.count";
+
+  /**
+   * Cached patterns promoted - recompiled with a larger max_mem.
+   *
+   * <p><b>Type:</b> Counter
+   *
+   * <p><b>Incremented:</b> When the idle eviction scan swaps a cached pattern that keeps exhausting
+   * its DFA budget (or, under the global budget, a hot one) for a recompiled copy
+   *
+   * <p><b>Interpretation:</b> Should settle quickly; continued growth means patterns keep hitting
+   * dfaRecompileMaxMemBytes or are being demoted and promoted in turn
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_DFA_RECOMPILATIONS = "cache.dfa.recompilations.total.count";
+
+  /**
+   * Cached patterns demoted back to their starting max_mem under the global DFA memory budget.
+   *
+   * <p><b>Type:</b> Counter
+   *
+   * <p><b>Incremented:</b> When a promoted pattern gone cold gives its allowance back to make room
+   * for a hotter pattern
+   *
+   * <p><b>Interpretation:</b> Occasional demotions are normal; steady churn alongside promotions
+   * means dfaMemoryBudgetBytes is too small for the hot working set
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_DFA_DEMOTIONS = "cache.dfa.demotions.total.count";
+
+  /**
+   * DFA promotions skipped, or admissions refused, because the budget was exhausted.
+   *
+   * <p><b>Type:</b> Counter
+   *
+   * <p><b>Incremented:</b> When a pattern's larger max_mem would exceed dfaRecompileBudgetBytes (or
+   * dfaMemoryBudgetBytes) and no cold pattern could be demoted to make room, or when a new pattern
+   * cannot be cached under dfaMemoryBudgetBytes even after evicting unprotected patterns
+   *
+   * <p><b>Interpretation:</b> Non-zero means more patterns want DFA memory than budgeted; raise the
+   * budget or simplify the patterns
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_DFA_BUDGET_REJECTIONS =
+      "cache.dfa.budget.rejections.total.count";
+
+  /**
+   * Hot cached patterns whose DFA was frozen into immutable lock-free tables.
+   *
+   * <p><b>Type:</b> Counter
+   *
+   * <p><b>Incremented:</b> When the idle eviction scan freezes one of the most used cached patterns
+   * (see dfaFreezeHotPatterns)
+   *
+   * <p><b>Interpretation:</b> Stays at zero if freezing is disabled, the hot patterns' DFAs are too
+   * large or the native library was built without RE2 internals
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_DFA_FROZEN = "cache.dfa.frozen.total.count";
+
+  /**
+   * Frozen cached patterns whose match engine was switched by calibration.
+   *
+   * <p><b>Type:</b> Counter
+   *
+   * <p><b>Incremented:</b> When the idle eviction scan times a frozen pattern's engines on its
+   * sampled inputs and another engine is clearly cheaper than the selected one
+   *
+   * <p><b>Interpretation:</b> A few switches after freezing are expected; steady growth means the
+   * inputs keep changing character
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_ENGINE_SWITCHES = "cache.engine.switches.total.count";
+
+  /**
+   * Cached patterns matching on frozen DFA tables.
+   *
+   * <p><b>Type:</b> Gauge
+   *
+   * <p><b>Updated:</b> Counted over the cache when read
+   *
+   * <p><b>Interpretation:</b> At most dfaFreezeHotPatterns
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_ENGINE_FROZEN_DFA = "cache.engine.frozen_dfa.current.count";
+
+  /**
+   * Cached patterns matching on a bit-parallel NFA.
+   *
+   * <p><b>Type:</b> Gauge
+   *
+   * <p><b>Updated:</b> Counted over the cache when read
+   *
+   * <p><b>Interpretation:</b> Frozen patterns whose DFA is too large to freeze, or whose inputs
+   * run faster on the NFA
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_ENGINE_BIT_PARALLEL = "cache.engine.bit_parallel.current.count";
+
+  /**
+   * max_mem currently charged against the DFA budget.
+   *
+   * <p><b>Type:</b> Gauge (bytes)
+   *
+   * <p><b>Updated:</b> When patterns are cached, promoted or demoted, and when evicted or replaced
+   * compilations are freed
+   *
+   * <p><b>Interpretation:</b> Under the global budget, the total max_mem of all cached patterns and
+   * of deferred ones not yet freed - a hard upper bound on their program and DFA memory. Otherwise
+   * only the extra above RE2's default granted by recompilation. Never exceeds {@link
+   * #CACHE_DFA_MAX_MEM_BUDGET}
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_DFA_MAX_MEM_COMMITTED = "cache.dfa.max_mem.committed.bytes";
+
+  /**
+   * DFA budget limit: dfaMemoryBudgetBytes if the global budget is enabled, otherwise
+   * dfaRecompileBudgetBytes.
+   *
+   * <p><b>Type:</b> Gauge (bytes)
+   *
+   * <p><b>Updated:</b> Constant per configuration
+   *
+   * <p><b>Interpretation:</b> Compare with {@link #CACHE_DFA_MAX_MEM_COMMITTED} for headroom
+   *
+   * @since 1.3.0
+   */
+  public static final String CACHE_DFA_MAX_MEM_BUDGET = "cache.dfa.max_mem.budget.bytes";
+
   // ========================================
   // Resource Management Metrics (4)
   // ========================================
@@ -473,6 +630,22 @@ public final class MetricNames {
    */
   public static final String MATCHING_STRING_LATENCY = "matching.string.latency";
 
+  /**
+   * String matching operations answered by the Java DFA tier without a JNI call.
+   *
+   * <p><b>Type:</b> Counter
+   *
+   * <p><b>Incremented:</b> For each Matcher.matches() or Matcher.find() call on an input no longer
+   * than {@code javaDfaMaxInputLength} whose pattern has a compact DFA
+   *
+   * <p><b>Interpretation:</b> Subset of MATCHING_OPERATIONS; stays at zero if the tier is disabled,
+   * patterns are too large for it or the native library was built without RE2 internals
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_JAVA_DFA_OPERATIONS =
+      "matching.java_dfa.operations.total.count";
+
   // --- Bulk-specific matching metrics ---
 
   /**
@@ -704,6 +877,204 @@ public final class MetricNames {
    */
   public static final String CAPTURE_FINDALL_MATCHES = "capture.findall.matches.total.count";
 
+  // ========================================
+  // Throughput Metrics - Matching and Capture
+  // ========================================
+  // Pattern: Global bytes (ALL) + Specific bytes and input-length histogram per path, plus a
+  // derived bytes-per-second gauge. String paths count UTF-16 chars (equal to bytes for ASCII) -
+  // measuring exact UTF-8 length would cost a second pass over every input.
+
+  /**
+   * Total bytes scanned by matching operations (ALL - String + Bulk + Zero-Copy).
+   *
+   * <p><b>Type:</b> Counter (bytes)
+   *
+   * <p><b>Incremented:</b> By the input length of every matches() or find() call, and by the sum
+   * of input lengths for bulk calls
+   *
+   * <p><b>Interpretation:</b> Divide by MATCHING_OPERATIONS for the mean input size; a latency
+   * regression with a matching rise here is input growth, not a slower engine
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_BYTES = "matching.bytes.total.count";
+
+  /**
+   * Bytes scanned by String matching operations.
+   *
+   * <p><b>Type:</b> Counter (chars)
+   *
+   * <p><b>Incremented:</b> By the input length of each Matcher.matches() or Matcher.find() call
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_STRING_BYTES = "matching.string.bytes.total.count";
+
+  /**
+   * Input length distribution for String matching operations.
+   *
+   * <p><b>Type:</b> Histogram (chars)
+   *
+   * <p><b>Recorded:</b> For each Matcher.matches() or Matcher.find() call
+   *
+   * <p><b>Interpretation:</b> Read alongside MATCHING_STRING_LATENCY - p99 latency tracking p99
+   * length is expected, p99 latency rising on its own is not
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_STRING_INPUT_LENGTH = "matching.string.input_length";
+
+  /**
+   * Bytes scanned by String bulk matching operations.
+   *
+   * <p><b>Type:</b> Counter (chars)
+   *
+   * <p><b>Incremented:</b> By the sum of input lengths in each bulk call
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_BULK_BYTES = "matching.bulk.bytes.total.count";
+
+  /**
+   * Input length distribution for String bulk matching operations.
+   *
+   * <p><b>Type:</b> Histogram (chars)
+   *
+   * <p><b>Recorded:</b> Once per item in each bulk call
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_BULK_INPUT_LENGTH = "matching.bulk.input_length";
+
+  /**
+   * Bytes scanned by zero-copy matching operations (single and bulk).
+   *
+   * <p><b>Type:</b> Counter (bytes)
+   *
+   * <p><b>Incremented:</b> By the length of each zero-copy match, and by the sum of lengths for
+   * zero-copy bulk calls
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_ZERO_COPY_BYTES = "matching.zero_copy.bytes.total.count";
+
+  /**
+   * Input length distribution for zero-copy matching operations (single and bulk).
+   *
+   * <p><b>Type:</b> Histogram (bytes)
+   *
+   * <p><b>Recorded:</b> For each zero-copy match, once per item for zero-copy bulk calls
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_ZERO_COPY_INPUT_LENGTH = "matching.zero_copy.input_length";
+
+  /**
+   * Matching throughput derived from MATCHING_BYTES.
+   *
+   * <p><b>Type:</b> Gauge (bytes per second)
+   *
+   * <p><b>Updated:</b> On read - bytes scanned since the previous read divided by the time between
+   * reads (at least one second)
+   *
+   * <p><b>Interpretation:</b> Capacity planning in MB/s; compare with MATCHING_OPERATIONS rate to
+   * tell more work from bigger work
+   *
+   * @since 1.3.0
+   */
+  public static final String MATCHING_THROUGHPUT = "matching.throughput.bytes_per_second";
+
+  /**
+   * Total bytes scanned by capture group operations (ALL - String + Bulk + Zero-Copy).
+   *
+   * <p><b>Type:</b> Counter (bytes)
+   *
+   * <p><b>Incremented:</b> By the input length of every match(), find(), findAll() with group
+   * extraction, and by the sum of input lengths for bulk calls
+   *
+   * @since 1.3.0
+   */
+  public static final String CAPTURE_BYTES = "capture.bytes.total.count";
+
+  /**
+   * Bytes scanned by String capture operations.
+   *
+   * <p><b>Type:</b> Counter (chars)
+   *
+   * <p><b>Incremented:</b> By the input length of each match(String), find(String),
+   * findAll(String)
+   *
+   * @since 1.3.0
+   */
+  public static final String CAPTURE_STRING_BYTES = "capture.string.bytes.total.count";
+
+  /**
+   * Input length distribution for String capture operations.
+   *
+   * <p><b>Type:</b> Histogram (chars)
+   *
+   * <p><b>Recorded:</b> For each match(String), find(String), findAll(String)
+   *
+   * @since 1.3.0
+   */
+  public static final String CAPTURE_STRING_INPUT_LENGTH = "capture.string.input_length";
+
+  /**
+   * Bytes scanned by bulk capture operations.
+   *
+   * <p><b>Type:</b> Counter (chars)
+   *
+   * <p><b>Incremented:</b> By the sum of input lengths in each bulk call
+   *
+   * @since 1.3.0
+   */
+  public static final String CAPTURE_BULK_BYTES = "capture.bulk.bytes.total.count";
+
+  /**
+   * Input length distribution for bulk capture operations.
+   *
+   * <p><b>Type:</b> Histogram (chars)
+   *
+   * <p><b>Recorded:</b> Once per item in each bulk call
+   *
+   * @since 1.3.0
+   */
+  public static final String CAPTURE_BULK_INPUT_LENGTH = "capture.bulk.input_length";
+
+  /**
+   * Bytes scanned by zero-copy capture operations.
+   *
+   * <p><b>Type:</b> Counter (bytes)
+   *
+   * <p><b>Incremented:</b> By the length of each zero-copy capture operation
+   *
+   * @since 1.3.0
+   */
+  public static final String CAPTURE_ZERO_COPY_BYTES = "capture.zero_copy.bytes.total.count";
+
+  /**
+   * Input length distribution for zero-copy capture operations.
+   *
+   * <p><b>Type:</b> Histogram (bytes)
+   *
+   * <p><b>Recorded:</b> For each zero-copy capture operation
+   *
+   * @since 1.3.0
+   */
+  public static final String CAPTURE_ZERO_COPY_INPUT_LENGTH = "capture.zero_copy.input_length";
+
+  /**
+   * Capture throughput derived from CAPTURE_BYTES.
+   *
+   * <p><b>Type:</b> Gauge (bytes per second)
+   *
+   * <p><b>Updated:</b> On read - bytes scanned since the previous read divided by the time between
+   * reads (at least one second)
+   *
+   * @since 1.3.0
+   */
+  public static final String CAPTURE_THROUGHPUT = "capture.throughput.bytes_per_second";
+
   // ========================================
   // Performance Metrics - Replace
   // ========================================
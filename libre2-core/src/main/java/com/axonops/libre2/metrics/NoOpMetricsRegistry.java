@@ -52,6 +52,11 @@ public final class NoOpMetricsRegistry implements RE2MetricsRegistry {
     // No-op
   }
 
+  @Override
+  public void recordHistogram(String name, long value) {
+    // No-op
+  }
+
   @Override
   public void registerGauge(String name, Supplier<Number> valueSupplier) {
     // No-op
@@ -29,6 +29,7 @@ import java.util.function.Supplier;
  * <ul>
  *   <li><strong>Counter:</strong> Atomic long counter (incrementing values)
  *   <li><strong>Timer:</strong> Measures duration in nanoseconds with histogram
+ *   <li><strong>Histogram:</strong> Distribution of recorded values (e.g., input sizes)
  *   <li><strong>Gauge:</strong> Instantaneous value computed on-demand via supplier
  * </ul>
  *
@@ -70,6 +71,23 @@ public interface RE2MetricsRegistry {
    */
   void recordTimer(String name, long durationNanos);
 
+  /**
+   * Record a value in a histogram (e.g., an input length in bytes).
+   *
+   * <p>Histograms track the distribution of values, allowing calculation of percentiles.
+   *
+   * <p>Thread-safe: Multiple threads can record to the same histogram concurrently.
+   *
+   * <p>Defaults to a no-op so registries written before 1.3.0 keep compiling.
+   *
+   * @param name metric name (e.g., "matching.string.input_length")
+   * @param value value to record
+   * @since 1.3.0
+   */
+  default void recordHistogram(String name, long value) {
+    // No-op unless overridden
+  }
+
   /**
    * Register a gauge that computes its value on-demand.
    *
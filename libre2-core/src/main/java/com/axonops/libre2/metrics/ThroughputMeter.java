@@ -0,0 +1,93 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.metrics;
+
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.LongAdder;
+import java.util.function.LongSupplier;
+
+/**
+ * Bytes scanned and the derived bytes-per-second rate for one family of operations.
+ *
+ * <p>Backs the {@code *.throughput.bytes_per_second} gauges. Marking is a {@link LongAdder}
+ * increment, so it is safe on hot paths. The rate is the bytes scanned between two reads of the
+ * gauge divided by the time between them, so it follows the metrics reporter's polling interval.
+ * Reads less than a second apart return the previous rate, keeping frequent polls from producing
+ * noisy values.
+ *
+ * <p><strong>Thread Safety:</strong> Marking is lock-free; reading the rate is synchronized.
+ *
+ * @since 1.3.0
+ */
+public final class ThroughputMeter {
+
+  /** Shortest interval the rate is computed over. */
+  static final long MIN_WINDOW_NANOS = TimeUnit.SECONDS.toNanos(1);
+
+  private final LongAdder bytes = new LongAdder();
+  private final LongSupplier nanoClock;
+
+  private long windowStartNanos;
+  private long windowStartBytes;
+  private double bytesPerSecond;
+
+  public ThroughputMeter() {
+    this(System::nanoTime);
+  }
+
+  ThroughputMeter(LongSupplier nanoClock) {
+    this.nanoClock = nanoClock;
+    this.windowStartNanos = nanoClock.getAsLong();
+  }
+
+  /**
+   * Records bytes scanned.
+   *
+   * @param count number of bytes (ignored if not positive)
+   */
+  public void mark(long count) {
+    if (count > 0) {
+      bytes.add(count);
+    }
+  }
+
+  /**
+   * Gets the total bytes scanned since this meter was created.
+   *
+   * @return total bytes
+   */
+  public long totalBytes() {
+    return bytes.sum();
+  }
+
+  /**
+   * Gets the bytes-per-second rate since the previous read (at least one second ago).
+   *
+   * @return bytes per second, 0 until a full window has elapsed
+   */
+  public synchronized double bytesPerSecond() {
+    long now = nanoClock.getAsLong();
+    long elapsed = now - windowStartNanos;
+    if (elapsed >= MIN_WINDOW_NANOS) {
+      long total = bytes.sum();
+      bytesPerSecond = (total - windowStartBytes) * (double) TimeUnit.SECONDS.toNanos(1) / elapsed;
+      windowStartNanos = now;
+      windowStartBytes = total;
+    }
+    return bytesPerSecond;
+  }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.netty;
+
+import com.axonops.libre2.api.Pattern;
+import io.netty.buffer.ByteBuf;
+import io.netty.buffer.ByteBufUtil;
+import java.nio.ByteBuffer;
+import java.util.Objects;
+
+/**
+ * Matches Netty {@link ByteBuf}s in place - requires {@code netty-buffer} on the classpath.
+ *
+ * <p>The readable bytes ({@code readerIndex} to {@code writerIndex}) are matched; indexes and
+ * reference counts are not touched, so the caller keeps ownership of the buffer.
+ *
+ * <ul>
+ *   <li>Buffers with a memory address (pooled or unpooled direct) are matched by address.
+ *   <li>Composite and other multi-component buffers are matched as one input over their NIO
+ *       components via {@link Pattern#matchesGathered(ByteBuffer[])}, so a match may span
+ *       component boundaries and direct components are not copied.
+ *   <li>Anything else is copied once.
+ * </ul>
+ *
+ * <pre>{@code
+ * CompositeByteBuf frame = ...;
+ * if (NettyBuffers.find(pattern, frame)) {
+ *     ...
+ * }
+ * }</pre>
+ *
+ * @since 1.3.0
+ */
+public final class NettyBuffers {
+
+  private NettyBuffers() {
+    // Utility class
+  }
+
+  /**
+   * Tests if the readable bytes of a buffer match the pattern entirely.
+   *
+   * @param pattern compiled pattern
+   * @param buffer UTF-8 buffer (readable bytes are matched)
+   * @return true if the readable bytes match the pattern entirely
+   * @throws NullPointerException if pattern or buffer is null
+   * @throws IllegalStateException if pattern is closed
+   */
+  public static boolean matches(Pattern pattern, ByteBuf buffer) {
+    return match(pattern, buffer, true);
+  }
+
+  /**
+   * Tests if the pattern matches anywhere in the readable bytes of a buffer.
+   *
+   * @param pattern compiled pattern
+   * @param buffer UTF-8 buffer (readable bytes are matched)
+   * @return true if the pattern matches anywhere in the readable bytes
+   * @throws NullPointerException if pattern or buffer is null
+   * @throws IllegalStateException if pattern is closed
+   */
+  public static boolean find(Pattern pattern, ByteBuf buffer) {
+    return match(pattern, buffer, false);
+  }
+
+  private static boolean match(Pattern pattern, ByteBuf buffer, boolean fullMatch) {
+    Objects.requireNonNull(pattern, "pattern cannot be null");
+    Objects.requireNonNull(buffer, "buffer cannot be null");
+
+    if (buffer.hasMemoryAddress()) {
+      long address = buffer.memoryAddress() + buffer.readerIndex();
+      int length = buffer.readableBytes();
+      return fullMatch ? pattern.matches(address, length) : pattern.find(address, length);
+    }
+
+    if (buffer.nioBufferCount() > 0) {
+      ByteBuffer[] segments = buffer.nioBuffers();
+      return fullMatch ? pattern.matchesGathered(segments) : pattern.findGathered(segments);
+    }
+
+    // No memory address and no NIO view (e.g. some wrapped or read-only buffers)
+    ByteBuffer copy = ByteBuffer.wrap(ByteBufUtil.getBytes(buffer));
+    return fullMatch ? pattern.matches(copy) : pattern.find(copy);
+  }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.chronicle;
+
+import static org.assertj.core.api.Assertions.*;
+
+import com.axonops.libre2.chronicle.ChronicleBuffers.Route;
+import org.junit.jupiter.api.Test;
+
+/**
+ * Routing of Chronicle stores to the address or copy path. Creating Chronicle {@code Bytes} needs
+ * extra {@code --add-opens} flags on Java 17, which only the failsafe run passes; matching real
+ * stores is covered by {@code ChronicleBuffersIT}.
+ */
+class ChronicleBuffersTest {
+
+  @Test
+  void testDirectStoreMatchedByAddress() {
+    assertThat(ChronicleBuffers.route(16, true, false)).isEqualTo(Route.ADDRESS);
+    assertThat(ChronicleBuffers.route(0, true, false)).isEqualTo(Route.ADDRESS);
+  }
+
+  @Test
+  void testHeapStoreCopied() {
+    assertThat(ChronicleBuffers.route(16, false, false)).isEqualTo(Route.COPY);
+  }
+
+  @Test
+  void testMappedStoreCopied() {
+    // Readable range may span separately mapped chunks
+    assertThat(ChronicleBuffers.route(16, true, true)).isEqualTo(Route.COPY);
+  }
+
+  @Test
+  void testLargestRangeAccepted() {
+    assertThat(ChronicleBuffers.route(Integer.MAX_VALUE, true, false)).isEqualTo(Route.ADDRESS);
+  }
+
+  @Test
+  void testOversizedRangeRejected() {
+    assertThatThrownBy(() -> ChronicleBuffers.route(Integer.MAX_VALUE + 1L, true, false))
+        .isInstanceOf(IllegalArgumentException.class)
+        .hasMessageContaining("too large");
+    assertThatThrownBy(() -> ChronicleBuffers.route(Integer.MAX_VALUE + 1L, false, false))
+        .isInstanceOf(IllegalArgumentException.class);
+  }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2025 AxonOps
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package com.axonops.libre2.metrics;
+
+import static org.assertj.core.api.Assertions.*;
+
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicLong;
+import org.junit.jupiter.api.Test;
+
+class ThroughputMeterTest {
+
+  private final AtomicLong clock = new AtomicLong(0);
+  private final ThroughputMeter meter = new ThroughputMeter(clock::get);
+
+  @Test
+  void testRateOverWindow() {
+    meter.mark(4096);
+    clock.set(TimeUnit.SECONDS.toNanos(2));
+
+    assertThat(meter.bytesPerSecond()).isEqualTo(2048.0);
+    assertThat(meter.totalBytes()).isEqualTo(4096);
+  }
+
+  @Test
+  void testReadsWithinWindowKeepPreviousRate() {
+    meter.mark(1000);
+    clock.set(TimeUnit.SECONDS.toNanos(1));
+    assertThat(meter.bytesPerSecond()).isEqualTo(1000.0);
+
+    meter.mark(5000);
+    clock.addAndGet(TimeUnit.MILLISECONDS.toNanos(100));
+
+    assertThat(meter.bytesPerSecond()).isEqualTo(1000.0);
+  }
+
+  @Test
+  void testRateDropsToZeroWhenIdle() {
+    meter.mark(1000);
+    clock.set(TimeUnit.SECONDS.toNanos(1));
+    meter.bytesPerSecond();
+
+    clock.addAndGet(TimeUnit.SECONDS.toNanos(1));
+
+    assertThat(meter.bytesPerSecond()).isZero();
+  }
+
+  @Test
+  void testNonPositiveMarksIgnored() {
+    meter.mark(0);
+    meter.mark(-5);
+
+    assertThat(meter.totalBytes()).isZero();
+  }
+}
@@ -15,6 +15,14 @@ extern "C" {
 JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compile
   (JNIEnv *, jclass, jstring, jboolean);
 
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    compileWithMaxMem
+ * Signature: (Ljava/lang/String;ZJ)J
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compileWithMaxMem
+  (JNIEnv *, jclass, jstring, jboolean, jlong);
+
 /*
  * Class:     com_axonops_libre2_jni_RE2NativeJNI
  * Method:    freePattern
@@ -79,6 +87,30 @@ JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_patternOk
 JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_patternMemory
   (JNIEnv *, jclass, jlong);
 
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    setDfaFailureTracking
+ * Signature: (Z)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_setDfaFailureTracking
+  (JNIEnv *, jclass, jboolean);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    dfaFailureCount
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_dfaFailureCount
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    scratchAllocations
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_scratchAllocations
+  (JNIEnv *, jclass);
+
 /*
  * Class:     com_axonops_libre2_jni_RE2NativeJNI
  * Method:    fullMatchBulk
@@ -167,6 +199,86 @@ JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_quoteMeta
 JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_programFanout
   (JNIEnv *, jclass, jlong);
 
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    explain
+ * Signature: (J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_explain
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    dfaTable
+ * Signature: (J)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_dfaTable
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    compactDfa
+ * Signature: (JZI)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compactDfa
+  (JNIEnv *, jclass, jlong, jboolean, jint);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    freezeDfa
+ * Signature: (JI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freezeDfa
+  (JNIEnv *, jclass, jlong, jint);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    freezeBitParallel
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freezeBitParallel
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    freeFrozenDfa
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freeFrozenDfa
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    frozenMatch
+ * Signature: (JJLjava/lang/String;Z)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_frozenMatch
+  (JNIEnv *, jclass, jlong, jlong, jstring, jboolean);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    frozenMatchDirect
+ * Signature: (JJJIZ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_frozenMatchDirect
+  (JNIEnv *, jclass, jlong, jlong, jlong, jint, jboolean);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    frozenMatchBulk
+ * Signature: (JJ[Ljava/lang/String;Z)[Z
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_frozenMatchBulk
+  (JNIEnv *, jclass, jlong, jlong, jobjectArray, jboolean);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    frozenMatchDirectBulk
+ * Signature: (JJ[J[IZ)[Z
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_frozenMatchDirectBulk
+  (JNIEnv *, jclass, jlong, jlong, jlongArray, jintArray, jboolean);
+
 /* ========== Zero-Copy Direct Memory Operations ========== */
 
 /*
@@ -217,6 +329,78 @@ JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractG
 JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_findAllMatchesDirect
   (JNIEnv *, jclass, jlong, jlong, jint);
 
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    aggregateBulk
+ * Signature: (J[Ljava/lang/String;II)[Ljava/lang/Object;
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_aggregateBulk
+  (JNIEnv *, jclass, jlong, jobjectArray, jint, jint);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    aggregateDirectBulk
+ * Signature: (J[J[III)[Ljava/lang/Object;
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_aggregateDirectBulk
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray, jint, jint);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    splitBulk
+ * Signature: (J[Ljava/lang/String;I)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_splitBulk
+  (JNIEnv *, jclass, jlong, jobjectArray, jint);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    splitDirectBulk
+ * Signature: (J[J[II)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_splitDirectBulk
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray, jint);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    extractGroupsDirectBulk
+ * Signature: (J[J[I)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractGroupsDirectBulk
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    findAllMatchesDirectBulk
+ * Signature: (J[J[I)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_findAllMatchesDirectBulk
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    matchSortedBulk
+ * Signature: (J[Ljava/lang/String;Z)[Z
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchSortedBulk
+  (JNIEnv *, jclass, jlong, jobjectArray, jboolean);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    matchSortedDirectBulk
+ * Signature: (J[J[IZ)[Z
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchSortedDirectBulk
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray, jboolean);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    matchToArena
+ * Signature: (JJIJIZ)I
+ */
+JNIEXPORT jint JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchToArena
+  (JNIEnv *, jclass, jlong, jlong, jint, jlong, jint, jboolean);
+
 /*
  * Class:     com_axonops_libre2_jni_RE2NativeJNI
  * Method:    replaceFirstDirect
@@ -241,6 +425,102 @@ JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAllDir
 JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAllDirectBulk
   (JNIEnv *, jclass, jlong, jlongArray, jintArray, jstring);
 
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    maskDirect
+ * Signature: (JJI[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_maskDirect
+  (JNIEnv *, jclass, jlong, jlong, jint, jbyteArray);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    maskDirectBulk
+ * Signature: (J[J[I[B)J
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_maskDirectBulk
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray, jbyteArray);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    matchSegments
+ * Signature: (J[J[IZ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchSegments
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray, jboolean);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    matchFieldBulk
+ * Signature: (J[J[II[BIZ)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchFieldBulk
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray, jint, jbyteArray, jint, jboolean);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    compileExpression
+ * Signature: ([I[J[B)J
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compileExpression
+  (JNIEnv *, jclass, jintArray, jlongArray, jbyteArray);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    freeExpression
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freeExpression
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    evaluateExpression
+ * Signature: (JLjava/lang/String;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_evaluateExpression
+  (JNIEnv *, jclass, jlong, jstring);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    evaluateExpressionDirect
+ * Signature: (JJI)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_evaluateExpressionDirect
+  (JNIEnv *, jclass, jlong, jlong, jint);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    evaluateExpressionBulk
+ * Signature: (J[Ljava/lang/String;)[Z
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_evaluateExpressionBulk
+  (JNIEnv *, jclass, jlong, jobjectArray);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    evaluateExpressionDirectBulk
+ * Signature: (J[J[I)[Z
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_evaluateExpressionDirectBulk
+  (JNIEnv *, jclass, jlong, jlongArray, jintArray);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    expressionStats
+ * Signature: (J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_expressionStats
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     com_axonops_libre2_jni_RE2NativeJNI
+ * Method:    mapFields
+ * Signature: (JLjava/lang/String;Z[I[J)I
+ */
+JNIEXPORT jint JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_mapFields
+  (JNIEnv *, jclass, jlong, jstring, jboolean, jintArray, jlongArray);
+
 #ifdef __cplusplus
 }
 #endif
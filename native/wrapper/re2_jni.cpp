@@ -23,11 +23,404 @@
 
 #include <jni.h>
 #include <re2/re2.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 #include "com_axonops_libre2_jni_RE2NativeJNI.h"
 
-// Thread-local error storage
-static thread_local std::string last_error;
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Engine classification (explain) needs RE2 internals: re2/prog.h and
+// re2/regexp.h. They are on the include path when building against the RE2
+// source tree (scripts/build.sh adds -Ire2). System installs only ship re2.h,
+// in which case explain() reports the fields that need them as unknown (-1).
+#if defined(__has_include)
+#  if __has_include(<re2/prog.h>) && __has_include(<re2/regexp.h>)
+#    include <re2/prog.h>
+#    include <re2/regexp.h>
+#    define RE2_JNI_HAVE_RE2_INTERNALS 1
+#  endif
+#endif
+
+#ifdef RE2_JNI_HAVE_RE2_INTERNALS
+/**
+ * Compiles a private copy of re's program, bounded by maxMem bytes.
+ *
+ * Never compiles re.Regexp() itself: compiling simplifies the Regexp, which
+ * adjusts reference counts on nodes RE2 shares with the reverse program it
+ * compiles lazily during matching, without synchronisation. A freshly parsed
+ * Regexp shares nothing with re.
+ *
+ * @return the program, or null if it does not fit maxMem
+ */
+static std::unique_ptr<re2::Prog> compile_private_prog(const RE2& re, int64_t maxMem) {
+    re2::RegexpStatus status;
+    re2::Regexp* regexp = re2::Regexp::Parse(
+        re.pattern(), static_cast<re2::Regexp::ParseFlags>(re.options().ParseFlags()), &status);
+    if (regexp == nullptr) {
+        return nullptr;
+    }
+    std::unique_ptr<re2::Prog> prog(regexp->CompileToProg(maxMem));
+    regexp->Decref();
+    return prog;
+}
+#endif
+
+// ========== Static Tracepoints (USDT) ==========
+//
+// Matching, capture, replace and compile entry points fire a "re2jni:op_entry"
+// probe on entry and a "re2jni:op_exit" probe on every return path. When
+// <sys/sdt.h> is available at build time each probe is a single NOP plus an
+// ELF note - nothing executes until a tracer (bpftrace, perf, systemtap)
+// attaches. Without <sys/sdt.h> the probes compile away entirely.
+//
+// Probe arguments:
+//   op_entry: arg0 = op (TraceOp), arg1 = pattern handle, arg2 = input length
+//   op_exit:  arg0 = op, arg1 = pattern handle, arg2 = input length, arg3 = result
+//
+// Input length is in bytes. For jstring inputs the UTF-8 length is only known
+// after conversion, so op_entry reports -1 and op_exit reports the real length.
+// For bulk operations input length is the element count and result is the
+// number of elements that matched (or matches replaced). A result of -1 means
+// the call failed (null arguments, exception).
+
+#if defined(__has_include)
+#  if __has_include(<sys/sdt.h>)
+#    include <sys/sdt.h>
+#    define RE2_JNI_HAVE_SDT 1
+#  endif
+#endif
+
+#ifdef RE2_JNI_HAVE_SDT
+#  define RE2_JNI_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(re2jni, name, a1, a2, a3)
+#  define RE2_JNI_PROBE4(name, a1, a2, a3, a4) DTRACE_PROBE4(re2jni, name, a1, a2, a3, a4)
+#else
+#  define RE2_JNI_PROBE3(name, a1, a2, a3) do { } while (0)
+#  define RE2_JNI_PROBE4(name, a1, a2, a3, a4) do { } while (0)
+#endif
+
+/**
+ * Operation identifiers reported as arg0 of the re2jni probes.
+ * Values are part of the tracing contract - append only, never renumber.
+ */
+enum TraceOp : int {
+    TRACE_COMPILE = 1,
+    TRACE_FULL_MATCH = 2,
+    TRACE_PARTIAL_MATCH = 3,
+    TRACE_FULL_MATCH_BULK = 4,
+    TRACE_PARTIAL_MATCH_BULK = 5,
+    TRACE_EXTRACT_GROUPS = 6,
+    TRACE_EXTRACT_GROUPS_BULK = 7,
+    TRACE_FIND_ALL = 8,
+    TRACE_REPLACE_FIRST = 9,
+    TRACE_REPLACE_ALL = 10,
+    TRACE_REPLACE_ALL_BULK = 11,
+    TRACE_FULL_MATCH_DIRECT = 12,
+    TRACE_PARTIAL_MATCH_DIRECT = 13,
+    TRACE_FULL_MATCH_DIRECT_BULK = 14,
+    TRACE_PARTIAL_MATCH_DIRECT_BULK = 15,
+    TRACE_EXTRACT_GROUPS_DIRECT = 16,
+    TRACE_FIND_ALL_DIRECT = 17,
+    TRACE_REPLACE_FIRST_DIRECT = 18,
+    TRACE_REPLACE_ALL_DIRECT = 19,
+    TRACE_REPLACE_ALL_DIRECT_BULK = 20,
+    TRACE_AGGREGATE_BULK = 21,
+    TRACE_AGGREGATE_DIRECT_BULK = 22,
+    TRACE_SPLIT_BULK = 23,
+    TRACE_SPLIT_DIRECT_BULK = 24,
+    TRACE_EXTRACT_GROUPS_DIRECT_BULK = 25,
+    TRACE_FIND_ALL_DIRECT_BULK = 26,
+    TRACE_MATCH_SORTED_BULK = 27,
+    TRACE_MATCH_SORTED_DIRECT_BULK = 28,
+    TRACE_EXTRACT_GROUPS_ARENA = 29,
+    TRACE_FIND_ALL_ARENA = 30,
+    TRACE_MATCH_SEGMENTS = 31,
+    TRACE_MATCH_FIELD_BULK = 32,
+    TRACE_EVALUATE_EXPRESSION = 33,
+    TRACE_EVALUATE_EXPRESSION_DIRECT = 34,
+    TRACE_EVALUATE_EXPRESSION_BULK = 35,
+    TRACE_EVALUATE_EXPRESSION_DIRECT_BULK = 36,
+    TRACE_MAP_FIELDS = 37,
+    TRACE_FROZEN_MATCH = 38,
+    TRACE_FROZEN_MATCH_DIRECT = 39,
+    TRACE_FROZEN_MATCH_BULK = 40,
+    TRACE_FROZEN_MATCH_DIRECT_BULK = 41,
+    TRACE_MASK_DIRECT = 42,
+    TRACE_MASK_DIRECT_BULK = 43
+};
+
+// ========== DFA Budget Exhaustion Tracking ==========
+//
+// When a DFA fills its share of max_mem too often, RE2 silently falls back to
+// the NFA. The only signal is a "DFA out of memory" ERROR log emitted when
+// log_errors is enabled. If Abseil logging is available (RE2 2023+), a LogSink
+// captures that line and charges it to the pattern executing on the current
+// thread (set by TraceScope below).
+//
+// Tracking is off by default, so patterns compile with log_errors off as RE2's
+// defaults have it. Once enabled, patterns compiled afterwards log their errors
+// through Abseil; the sink only consumes the DFA failure lines, and whether
+// they also reach stderr is left to the process's own Abseil configuration.
+
+#if defined(__has_include)
+#  if __has_include(<absl/log/log_sink.h>) && __has_include(<absl/log/log_sink_registry.h>)
+#    include <absl/log/log_entry.h>
+#    include <absl/log/log_sink.h>
+#    include <absl/log/log_sink_registry.h>
+#    define RE2_JNI_HAVE_ABSL_LOG 1
+#  endif
+#endif
+
+// Pattern currently executing on this thread (for attributing DFA failures)
+static thread_local const RE2* current_pattern = nullptr;
+
+// DFA failure counts keyed by pattern. Only touched on failure, compile and free.
+static std::mutex dfa_failures_mutex;
+static std::unordered_map<const RE2*, jlong> dfa_failures;
+
+// Whether patterns compiled from now on log (and so count) DFA failures
+static std::atomic<bool> dfa_failure_tracking{false};
+
+static void forget_dfa_failures(const RE2* re) {
+    std::lock_guard<std::mutex> lock(dfa_failures_mutex);
+    dfa_failures.erase(re);
+}
+
+#ifdef RE2_JNI_HAVE_ABSL_LOG
+static void record_dfa_failure(const RE2* re) {
+    if (re == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(dfa_failures_mutex);
+    dfa_failures[re]++;
+}
+
+class DfaFailureSink : public absl::LogSink {
+public:
+    void Send(const absl::LogEntry& entry) override {
+        if (entry.text_message().find("DFA out of memory") != absl::string_view::npos) {
+            record_dfa_failure(current_pattern);
+        }
+    }
+};
+
+/**
+ * Installs the DFA failure sink once per process.
+ * @return true if DFA failures can be detected
+ */
+static bool install_dfa_failure_sink() {
+    static const bool installed = [] {
+        absl::AddLogSink(new DfaFailureSink());  // Intentionally leaked (process lifetime)
+        return true;
+    }();
+    return installed;
+}
+#else
+static bool install_dfa_failure_sink() {
+    return false;
+}
+#endif
+
+/**
+ * @return true if DFA failure tracking has been enabled and this build can detect failures
+ */
+static bool dfa_failure_tracking_enabled() {
+    return dfa_failure_tracking.load(std::memory_order_relaxed);
+}
+
+/**
+ * RAII scope that marks a pattern as executing on this thread, so DFA
+ * failures during the scope are attributed to it.
+ */
+class PatternScope {
+public:
+    explicit PatternScope(const RE2* pattern) : previous_(current_pattern) {
+        current_pattern = pattern;
+    }
+
+    ~PatternScope() { current_pattern = previous_; }
+
+private:
+    const RE2* previous_;
+
+    // Non-copyable
+    PatternScope(const PatternScope&) = delete;
+    PatternScope& operator=(const PatternScope&) = delete;
+};
+
+/**
+ * RAII scope that fires op_entry on construction and op_exit on destruction,
+ * so every return path (including exceptions) is covered. Also marks the
+ * pattern as executing on this thread so DFA failures can be attributed.
+ */
+class TraceScope {
+public:
+    TraceScope(TraceOp op, jlong handle, jlong length)
+        : TraceScope(op, handle, reinterpret_cast<const RE2*>(handle), length) {}
+
+    /**
+     * For ops whose handle is not an RE2: pattern is the one DFA failures are
+     * attributed to, or null if the op sets it per operand.
+     */
+    TraceScope(TraceOp op, jlong handle, const RE2* pattern, jlong length)
+        : op_(op), handle_(handle), length_(length), result_(-1), pattern_(pattern) {
+        RE2_JNI_PROBE3(op_entry, op_, handle_, length_);
+    }
+
+    ~TraceScope() {
+        RE2_JNI_PROBE4(op_exit, op_, handle_, length_, result_);
+    }
+
+    void setHandle(jlong handle) { handle_ = handle; }
+    void setLength(jlong length) { length_ = length; }
+    void setResult(jlong result) { result_ = result; }
+
+private:
+    int op_;
+    jlong handle_;
+    jlong length_;
+    jlong result_;
+    PatternScope pattern_;
+
+    // Non-copyable
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+// Thread-local error storage, reserved up front so error paths reuse its capacity
+static constexpr size_t kErrorCapacity = 256;
+static thread_local std::string last_error = [] {
+    std::string error;
+    error.reserve(kErrorCapacity);
+    return error;
+}();
+
+/**
+ * Records an error message built from a prefix and a detail (usually
+ * exception::what()) without a temporary string.
+ */
+static void set_error(const char* prefix, const char* detail) {
+    last_error.assign(prefix).append(detail);
+}
+
+// ========== Thread-Local Scratch ==========
+//
+// Per-call temporaries (capture group pieces, result staging, NUL-terminated
+// group copies for NewStringUTF) live in per-thread buffers that keep their
+// capacity between calls, so steady-state calls do not touch the allocator.
+// A buffer grown past kMaxRetainedScratch elements by one large call is
+// released by the next call that fits the retained size.
+
+static constexpr size_t kMaxRetainedScratch = 1 << 18;
+
+// Scratch (re)allocations made on this thread; read by scratchAllocations()
+static thread_local jlong scratch_allocations = 0;
+
+/**
+ * Resets a scratch vector to size value-initialized elements, reusing its
+ * capacity when it is large enough.
+ */
+template <typename T>
+static std::vector<T>& scratch(std::vector<T>& buffer, size_t size) {
+    if (buffer.capacity() > kMaxRetainedScratch && size <= kMaxRetainedScratch) {
+        std::vector<T>().swap(buffer);
+    }
+    if (size > buffer.capacity()) {
+        scratch_allocations++;
+    }
+    buffer.assign(size, T());
+    return buffer;
+}
+
+/** Capture group pieces for one match. */
+static std::vector<re2::StringPiece>& scratch_groups(size_t size) {
+    static thread_local std::vector<re2::StringPiece> groups;
+    return scratch(groups, size);
+}
+
+/** Group pieces of every match found so far (findAllMatches). */
+static std::vector<re2::StringPiece>& scratch_matches() {
+    static thread_local std::vector<re2::StringPiece> matches;
+    return scratch(matches, 0);
+}
+
+/** Boolean results staged before SetBooleanArrayRegion. */
+static std::vector<jboolean>& scratch_booleans(size_t size) {
+    static thread_local std::vector<jboolean> booleans;
+    return scratch(booleans, size);
+}
+
+/** Contiguous copy of fragmented input (scatter-gather fallback). */
+static std::vector<char>& scratch_bytes(size_t size) {
+    static thread_local std::vector<char> bytes;
+    return scratch(bytes, size);
+}
+
+/** Decoded copy of an escaped record field or key (field-aware matching). */
+static std::vector<char>& scratch_field(size_t size) {
+    static thread_local std::vector<char> field;
+    return scratch(field, size);
+}
+
+/** Result bitmap words staged before SetLongArrayRegion. */
+static std::vector<jlong>& scratch_longs(size_t size) {
+    static thread_local std::vector<jlong> longs;
+    return scratch(longs, size);
+}
+
+/** (byte offset, slot) keys sorted for UTF-16 offset conversion (record mapping). */
+static std::vector<uint64_t>& scratch_keys(size_t size) {
+    static thread_local std::vector<uint64_t> keys;
+    return scratch(keys, size);
+}
+
+/** Packed int results staged before SetIntArrayRegion. */
+static std::vector<jint>& scratch_ints(size_t size) {
+    static thread_local std::vector<jint> ints;
+    return scratch(ints, size);
+}
+
+/**
+ * Appends to a scratch vector, counting the reallocation when it has to grow.
+ */
+template <typename T>
+static void scratch_push(std::vector<T>& buffer, const T& value) {
+    if (buffer.size() == buffer.capacity()) {
+        scratch_allocations++;
+    }
+    buffer.push_back(value);
+}
+
+/**
+ * Creates a Java String from a (not NUL-terminated) piece via a per-thread
+ * terminated copy, instead of a temporary std::string per group.
+ */
+static jstring new_string_utf(JNIEnv* env, re2::StringPiece piece) {
+    static thread_local std::string terminated;
+    if (terminated.capacity() > kMaxRetainedScratch && piece.size() <= kMaxRetainedScratch) {
+        std::string().swap(terminated);
+    }
+    if (piece.size() > terminated.capacity()) {
+        scratch_allocations++;
+    }
+    terminated.assign(piece.data(), piece.size());
+    return env->NewStringUTF(terminated.c_str());
+}
 
 /**
  * Helper to get UTF-8 string from Java string with RAII cleanup.
@@ -59,10 +452,11 @@ private:
     JStringGuard& operator=(const JStringGuard&) = delete;
 };
 
-extern "C" {
-
-JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compile(
-    JNIEnv *env, jclass cls, jstring pattern, jboolean caseSensitive) {
+/**
+ * Shared compile path for compile() and compileWithMaxMem().
+ */
+static jlong compile_pattern(JNIEnv* env, jstring pattern, jboolean caseSensitive, int64_t maxMem) {
+    TraceScope trace(TRACE_COMPILE, 0, -1);
 
     if (pattern == nullptr) {
         last_error = "Pattern is null";
@@ -78,264 +472,3770 @@ JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compile(
     try {
         RE2::Options options;
         options.set_case_sensitive(caseSensitive == JNI_TRUE);
-        options.set_log_errors(false);
+        options.set_log_errors(dfa_failure_tracking_enabled());
+        options.set_max_mem(maxMem);
 
-        RE2* re = new RE2(guard.get(), options);
+        re2::StringPiece patternText(guard.get());
+        trace.setLength(static_cast<jlong>(patternText.size()));
+
+        RE2* re = new RE2(patternText, options);
 
         if (!re->ok()) {
             last_error = re->error();
             delete re;
+            trace.setResult(0);
             return 0;
         }
 
-        return reinterpret_cast<jlong>(re);
+        jlong handle = reinterpret_cast<jlong>(re);
+        trace.setHandle(handle);
+        trace.setResult(1);
+        return handle;
     } catch (const std::exception& e) {
-        last_error = std::string("Exception: ") + e.what();
+        set_error("Exception: ", e.what());
         return 0;
     }
 }
 
-JNIEXPORT void JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freePattern(
-    JNIEnv *env, jclass cls, jlong handle) {
+// ========== Group-By Aggregation ==========
 
-    if (handle != 0) {
-        delete reinterpret_cast<RE2*>(handle);
+/**
+ * Open-addressing hash table keyed by captured byte slices.
+ *
+ * A key is copied into the arena only the first time it is seen, so rows
+ * that hit an existing key allocate nothing. Linear probing over a
+ * power-of-two slot array, grown at 50% load. Entries keep first-seen order.
+ */
+class GroupTable {
+public:
+    // Value statistics only cover rows whose value group parsed as an integer
+    struct Entry {
+        size_t hash;
+        size_t keyOffset;
+        size_t keyLength;
+        jlong count;
+        jlong valueCount;
+        jlong sum;
+        jlong min;
+        jlong max;
+    };
+
+    GroupTable() : slots_(kInitialSlots, kEmpty) {}
+
+    Entry& findOrInsert(std::string_view key) {
+        size_t hash = std::hash<std::string_view>{}(key);
+        size_t mask = slots_.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask) {
+            int32_t slot = slots_[i];
+            if (slot == kEmpty) {
+                return insert(i, hash, key);
+            }
+            Entry& entry = entries_[slot];
+            if (entry.hash == hash && entry.keyLength == key.size() &&
+                (key.empty() || std::memcmp(arena_.data() + entry.keyOffset, key.data(), key.size()) == 0)) {
+                return entry;
+            }
+        }
     }
-}
 
-JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_fullMatch(
-    JNIEnv *env, jclass cls, jlong handle, jstring text) {
+    const std::vector<Entry>& entries() const { return entries_; }
 
-    if (handle == 0 || text == nullptr) {
-        last_error = "Null pointer";
-        return JNI_FALSE;
+    std::string_view key(const Entry& entry) const {
+        return std::string_view(arena_).substr(entry.keyOffset, entry.keyLength);
     }
 
-    JStringGuard guard(env, text);
-    if (!guard.valid()) {
-        last_error = "Failed to get text string";
-        return JNI_FALSE;
+private:
+    static constexpr size_t kInitialSlots = 64;
+    static constexpr int32_t kEmpty = -1;
+
+    Entry& insert(size_t slot, size_t hash, std::string_view key) {
+        size_t offset = arena_.size();
+        arena_.append(key.data(), key.size());
+        entries_.push_back(Entry{hash, offset, key.size(), 0, 0, 0,
+                                 std::numeric_limits<jlong>::max(),
+                                 std::numeric_limits<jlong>::min()});
+        slots_[slot] = static_cast<int32_t>(entries_.size() - 1);
+        if (entries_.size() * 2 > slots_.size()) {
+            grow();
+        }
+        return entries_.back();
     }
 
-    try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        return RE2::FullMatch(guard.get(), *re) ? JNI_TRUE : JNI_FALSE;
-    } catch (const std::exception& e) {
-        last_error = std::string("Exception: ") + e.what();
-        return JNI_FALSE;
+    void grow() {
+        std::vector<int32_t> slots(slots_.size() * 2, kEmpty);
+        size_t mask = slots.size() - 1;
+        for (size_t n = 0; n < entries_.size(); n++) {
+            size_t i = entries_[n].hash & mask;
+            while (slots[i] != kEmpty) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = static_cast<int32_t>(n);
+        }
+        slots_.swap(slots);
     }
-}
 
-JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partialMatch(
-    JNIEnv *env, jclass cls, jlong handle, jstring text) {
+    std::vector<int32_t> slots_;
+    std::vector<Entry> entries_;
+    std::string arena_;
+};
 
-    if (handle == 0 || text == nullptr) {
-        last_error = "Null pointer";
-        return JNI_FALSE;
+/**
+ * Parses a captured slice as a base-10 signed integer (no sign prefix '+',
+ * no whitespace). @return false if the slice is not entirely an integer
+ */
+static bool parse_long(std::string_view text, jlong* out) {
+    int64_t value = 0;
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (ec != std::errc() || end != text.data() + text.size()) {
+        return false;
     }
+    *out = static_cast<jlong>(value);
+    return true;
+}
 
-    JStringGuard guard(env, text);
-    if (!guard.valid()) {
-        last_error = "Failed to get text string";
-        return JNI_FALSE;
+/**
+ * Matches one row and folds its key group (and optional value group) into the
+ * table. groups must hold max(keyGroup, valueGroup) + 1 slots.
+ * @return true if the row matched and the key group participated
+ */
+static bool aggregate_row(const RE2* re, re2::StringPiece text, int keyGroup, int valueGroup,
+                          std::vector<re2::StringPiece>& groups, GroupTable& table) {
+    if (!re->Match(text, 0, text.size(), RE2::UNANCHORED, groups.data(),
+                   static_cast<int>(groups.size()))) {
+        return false;
+    }
+    const re2::StringPiece& key = groups[keyGroup];
+    if (key.data() == nullptr) {
+        return false;
     }
 
-    try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        return RE2::PartialMatch(guard.get(), *re) ? JNI_TRUE : JNI_FALSE;
-    } catch (const std::exception& e) {
-        last_error = std::string("Exception: ") + e.what();
-        return JNI_FALSE;
+    GroupTable::Entry& entry = table.findOrInsert(std::string_view(key.data(), key.size()));
+    entry.count++;
+
+    jlong value;
+    if (valueGroup >= 0 && groups[valueGroup].data() != nullptr &&
+        parse_long(std::string_view(groups[valueGroup].data(), groups[valueGroup].size()), &value)) {
+        entry.valueCount++;
+        // Two's-complement wraparound on overflow, like Java long arithmetic
+        entry.sum = static_cast<jlong>(static_cast<uint64_t>(entry.sum) + static_cast<uint64_t>(value));
+        entry.min = std::min(entry.min, value);
+        entry.max = std::max(entry.max, value);
     }
+    return true;
 }
 
-JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_getError(
-    JNIEnv *env, jclass cls) {
-
-    if (last_error.empty()) {
-        return nullptr;
+/**
+ * Validates aggregation group indexes against the pattern.
+ * @return true if valid, otherwise sets last_error
+ */
+static bool valid_aggregation_groups(const RE2* re, jint keyGroup, jint valueGroup) {
+    int numGroups = re->NumberOfCapturingGroups();
+    char detail[64];
+    if (keyGroup < 0 || keyGroup > numGroups) {
+        std::snprintf(detail, sizeof(detail), "%d out of range (pattern has %d groups)",
+                      static_cast<int>(keyGroup), numGroups);
+        set_error("Key group ", detail);
+        return false;
     }
-    return env->NewStringUTF(last_error.c_str());
+    if (valueGroup < -1 || valueGroup > numGroups) {
+        std::snprintf(detail, sizeof(detail), "%d out of range (pattern has %d groups)",
+                      static_cast<int>(valueGroup), numGroups);
+        set_error("Value group ", detail);
+        return false;
+    }
+    return true;
 }
 
-JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_getPattern(
-    JNIEnv *env, jclass cls, jlong handle) {
-
-    if (handle == 0) {
+/**
+ * Converts the table to Object[] { String[] keys, long[] stats }.
+ *
+ * stats[0] is the number of rows that did not match (or whose key group did
+ * not participate), followed by count, valueCount, sum, min, max per key in
+ * keys order.
+ */
+static jobjectArray aggregation_result(JNIEnv* env, const GroupTable& table, jlong unmatched) {
+    const std::vector<GroupTable::Entry>& entries = table.entries();
+    jsize size = static_cast<jsize>(entries.size());
+
+    jclass stringClass = env->FindClass("java/lang/String");
+    jobjectArray keys = env->NewObjectArray(size, stringClass, nullptr);
+    jlongArray stats = env->NewLongArray(1 + size * 5);
+    jclass objectClass = env->FindClass("java/lang/Object");
+    jobjectArray result = env->NewObjectArray(2, objectClass, nullptr);
+    if (keys == nullptr || stats == nullptr || result == nullptr) {
+        last_error = "Failed to allocate aggregation result";
         return nullptr;
     }
 
-    try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        return env->NewStringUTF(re->pattern().c_str());
-    } catch (...) {
-        return nullptr;
+    std::vector<jlong>& values = scratch_longs(1 + entries.size() * 5);
+    values[0] = unmatched;
+    for (jsize i = 0; i < size; i++) {
+        const GroupTable::Entry& entry = entries[i];
+        std::string_view keyText = table.key(entry);
+        jstring key = new_string_utf(env, re2::StringPiece(keyText.data(), keyText.size()));
+        env->SetObjectArrayElement(keys, i, key);
+        env->DeleteLocalRef(key);
+
+        jlong* stat = values.data() + 1 + static_cast<size_t>(i) * 5;
+        stat[0] = entry.count;
+        stat[1] = entry.valueCount;
+        stat[2] = entry.sum;
+        stat[3] = entry.valueCount > 0 ? entry.min : 0;
+        stat[4] = entry.valueCount > 0 ? entry.max : 0;
     }
+    env->SetLongArrayRegion(stats, 0, static_cast<jsize>(values.size()), values.data());
+
+    env->SetObjectArrayElement(result, 0, keys);
+    env->SetObjectArrayElement(result, 1, stats);
+    return result;
 }
 
-JNIEXPORT jint JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_numCapturingGroups(
-    JNIEnv *env, jclass cls, jlong handle) {
+// ========== Split ==========
+//
+// Split results cross JNI as one int[]: the field count of each input, then a
+// start/end pair per field. Tokenising a batch is one native call and creates
+// no Strings; the Java side projects only the fields it reads.
 
-    if (handle == 0) {
-        last_error = "Pattern is null";
-        return -1;
+/**
+ * Length of the UTF-8 sequence starting with lead byte c (1 for stray bytes).
+ */
+static size_t utf8_sequence_length(unsigned char c) {
+    if (c >= 0xF0) return 4;
+    if (c >= 0xE0) return 3;
+    if (c >= 0xC0) return 2;
+    return 1;
+}
+
+/**
+ * Appends start/end byte offsets of the fields of text split around matches
+ * of re, following java.lang.String#split: limit > 0 caps the field count
+ * (the last field holds the remainder), limit == 0 drops trailing empty
+ * fields, limit < 0 keeps them. A zero-width match at the start of the text
+ * never produces a leading empty field.
+ *
+ * @return number of fields appended
+ */
+static jint split_fields(const RE2* re, re2::StringPiece text, jint limit,
+                         std::vector<jint>& bounds) {
+    size_t length = text.size();
+    size_t index = 0;       // start of the current field
+    size_t searchFrom = 0;
+    bool matched = false;
+    jint fields = 0;
+    re2::StringPiece match;
+
+    while ((limit <= 0 || fields < limit - 1) && searchFrom <= length &&
+           re->Match(text, searchFrom, length, RE2::UNANCHORED, &match, 1)) {
+        size_t start = static_cast<size_t>(match.data() - text.data());
+        size_t end = start + match.size();
+        if (start == end) {
+            // Step over empty matches by one character, as Matcher.find() does
+            searchFrom = end < length
+                ? end + utf8_sequence_length(static_cast<unsigned char>(text[end]))
+                : length + 1;
+            if (start == 0) {
+                continue;
+            }
+        } else {
+            searchFrom = end;
+        }
+        scratch_push(bounds, static_cast<jint>(index));
+        scratch_push(bounds, static_cast<jint>(start));
+        fields++;
+        index = end;
+        matched = true;
     }
 
-    try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        return static_cast<jint>(re->NumberOfCapturingGroups());
-    } catch (const std::exception& e) {
-        last_error = std::string("Exception: ") + e.what();
-        return -1;
+    if (!matched) {
+        scratch_push(bounds, jint(0));
+        scratch_push(bounds, static_cast<jint>(length));
+        return 1;
     }
-}
 
-JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_patternOk(
-    JNIEnv *env, jclass cls, jlong handle) {
+    scratch_push(bounds, static_cast<jint>(index));
+    scratch_push(bounds, static_cast<jint>(length));
+    fields++;
 
-    if (handle == 0) {
-        return JNI_FALSE;
+    if (limit == 0) {
+        while (fields > 0 && bounds[bounds.size() - 1] == bounds[bounds.size() - 2]) {
+            bounds.resize(bounds.size() - 2);
+            fields--;
+        }
     }
+    return fields;
+}
 
-    try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        return re->ok() ? JNI_TRUE : JNI_FALSE;
-    } catch (...) {
-        return JNI_FALSE;
+/**
+ * Rewrites ascending byte offsets into (modified) UTF-8 text as UTF-16 char
+ * offsets, so Java can project fields with String.substring.
+ */
+static void utf8_offsets_to_utf16(re2::StringPiece text, jint* offsets, size_t count) {
+    size_t byte = 0;
+    jint unit = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t target = static_cast<size_t>(offsets[i]);
+        for (; byte < target; byte++) {
+            unsigned char c = static_cast<unsigned char>(text[byte]);
+            if ((c & 0xC0) != 0x80) {
+                unit += c >= 0xF0 ? 2 : 1;  // 4-byte sequences are surrogate pairs
+            }
+        }
+        offsets[i] = unit;
     }
 }
 
-JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_patternMemory(
-    JNIEnv *env, jclass cls, jlong handle) {
-
-    if (handle == 0) {
-        return 0;
+/**
+ * Copies a packed offsets layout into a new Java int[].
+ */
+static jintArray packed_int_array(JNIEnv* env, const std::vector<jint>& packed) {
+    if (packed.size() > static_cast<size_t>(std::numeric_limits<jsize>::max())) {
+        last_error = "Result too large for a Java array";
+        return nullptr;
     }
-
-    try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        return static_cast<jlong>(re->ProgramSize());
-    } catch (...) {
-        return 0;
+    jsize size = static_cast<jsize>(packed.size());
+    jintArray result = env->NewIntArray(size);
+    if (result == nullptr) {
+        last_error = "Failed to allocate result array";
+        return nullptr;
     }
+    env->SetIntArrayRegion(result, 0, size, packed.data());
+    return result;
 }
 
-// ========== Bulk Matching Operations ==========
+// ========== Bulk Match Offsets ==========
+//
+// Bulk findAll/extract results cross JNI as one int[]: the match count of each
+// input, then for every match a start/end byte offset pair per group (group 0
+// is the whole match; -1/-1 for groups that did not participate). No Strings
+// are created natively.
 
-JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_fullMatchBulk(
-    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts) {
+/**
+ * Appends group offsets for the first match (all == false) or every
+ * non-overlapping match (all == true) of re in text. Empty matches advance the
+ * scan by one character, as Matcher.find() does.
+ *
+ * @return number of matches appended
+ */
+static jint append_match_offsets(const RE2* re, re2::StringPiece text, bool all,
+                                 std::vector<re2::StringPiece>& groups, std::vector<jint>& out) {
+    size_t length = text.size();
+    size_t pos = 0;
+    jint matches = 0;
+    int numGroups = static_cast<int>(groups.size());
+
+    while (pos <= length &&
+           re->Match(text, pos, length, RE2::UNANCHORED, groups.data(), numGroups)) {
+        for (const re2::StringPiece& group : groups) {
+            if (group.data() == nullptr) {
+                scratch_push(out, jint(-1));
+                scratch_push(out, jint(-1));
+            } else {
+                jint start = static_cast<jint>(group.data() - text.data());
+                scratch_push(out, start);
+                scratch_push(out, start + static_cast<jint>(group.size()));
+            }
+        }
+        matches++;
+        if (!all) {
+            break;
+        }
 
-    if (handle == 0 || texts == nullptr) {
+        size_t end = static_cast<size_t>(groups[0].data() - text.data()) + groups[0].size();
+        if (groups[0].empty()) {
+            end = end < length
+                ? end + utf8_sequence_length(static_cast<unsigned char>(text[end]))
+                : length + 1;
+        }
+        pos = end;
+    }
+    return matches;
+}
+
+/**
+ * Shared body of extractGroupsDirectBulk() and findAllMatchesDirectBulk().
+ *
+ * @return int[] { matchCount per input, then group offsets per match }, or null on error
+ */
+static jintArray match_offsets_direct_bulk(JNIEnv* env, TraceOp op, jlong handle,
+                                           jlongArray textAddresses, jintArray textLengths,
+                                           bool all) {
+    TraceScope trace(op, handle, -1);
+
+    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
         last_error = "Null pointer";
         return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        jsize length = env->GetArrayLength(texts);
 
-        // Allocate result array
-        jbooleanArray results = env->NewBooleanArray(length);
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
+
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same size";
+            return nullptr;
+        }
+
+        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
+
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
+            return nullptr;
+        }
+
+        std::vector<re2::StringPiece>& groups = scratch_groups(re->NumberOfCapturingGroups() + 1);
+        std::vector<jint>& packed = scratch_ints(static_cast<size_t>(addressCount));
+        jlong totalMatches = 0;
+
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
+                continue;
+            }
+
+            const char* text = reinterpret_cast<const char*>(addresses[i]);
+            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
+            jint matches = append_match_offsets(re, input, all, groups, packed);
+            packed[i] = matches;
+            totalMatches += matches;
+        }
+
+        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+
+        trace.setResult(totalMatches);
+        return packed_int_array(env, packed);
+
+    } catch (const std::exception& e) {
+        set_error("Match offsets direct bulk exception: ", e.what());
+        return nullptr;
+    }
+}
+
+// ========== Materialized DFA ==========
+//
+// RE2 can flood-fill its lazy DFA into a complete transition table
+// (Prog::BuildEntireDFA). The wrapper materializes that table once per
+// pattern for operations that need the automaton state itself, which RE2's
+// public API never exposes - e.g. resuming sorted keys from the state reached
+// at their shared prefix. This needs RE2 internals; without them, or when the
+// DFA does not fit the pattern's memory budget, callers fall back to RE2.
+
+/**
+ * Complete DFA transition table. States are numbered in the order RE2
+ * discovers them, so state 0 is the start state; -1 is the dead state.
+ *
+ * Like RE2's DFA, match flags are delayed by one byte: a state is matching
+ * when a match ended just before the byte that led to it. Whether the text
+ * matches at its end is read from the end-of-text transition.
+ */
+struct MaterializedDfa {
+    int classes = 0;                  // byte classes + 1 end-of-text slot
+    uint8_t bytemap[256] = {};
+    std::vector<int32_t> next;        // states x classes
+    std::vector<uint8_t> match;       // delayed match flag per state
+    bool anchorEnd = false;           // matches only count at end of text
+
+    int32_t step(int32_t state, uint8_t byte) const {
+        return next[static_cast<size_t>(state) * classes + bytemap[byte]];
+    }
+
+    bool isMatch(int32_t state) const {
+        return state >= 0 && match[static_cast<size_t>(state)] != 0;
+    }
+
+    bool matchesAtEnd(int32_t state) const {
+        return state >= 0 && isMatch(next[static_cast<size_t>(state) * classes + classes - 1]);
+    }
+};
+
+#ifdef RE2_JNI_HAVE_RE2_INTERNALS
+/**
+ * Builds the longest-match DFA of re, with program and DFA states bounded by
+ * budget bytes. Safe to run concurrently with matching and with builds of
+ * other kinds for the same pattern: the program is compiled privately.
+ *
+ * @return the table, or null if the DFA exceeds the budget or can never match
+ */
+static std::unique_ptr<MaterializedDfa> materialize_dfa(const RE2& re, int64_t budget) {
+    std::unique_ptr<re2::Prog> prog(compile_private_prog(re, budget));
+    if (prog == nullptr) {
+        return nullptr;
+    }
+
+    auto dfa = std::make_unique<MaterializedDfa>();
+    dfa->classes = prog->bytemap_range() + 1;
+    std::memcpy(dfa->bytemap, prog->bytemap(), sizeof(dfa->bytemap));
+    dfa->anchorEnd = prog->anchor_end();
+
+    bool out_of_memory = false;
+    prog->BuildEntireDFA(re2::Prog::kLongestMatch, [&](const int* next, bool match) {
+        if (next == nullptr) {
+            out_of_memory = true;
+            return;
+        }
+        dfa->next.insert(dfa->next.end(), next, next + dfa->classes);
+        dfa->match.push_back(match ? 1 : 0);
+    });
+
+    if (out_of_memory || dfa->match.empty()) {
+        return nullptr;
+    }
+    return dfa;
+}
+
+/**
+ * Builds the DFA for full or partial matching with re. BuildEntireDFA always
+ * starts unanchored, so full match uses a start-anchored copy of the pattern;
+ * the end is checked per input.
+ */
+static std::unique_ptr<MaterializedDfa> materialize_dfa(
+        const RE2& re, bool fullMatch, int64_t budget) {
+    if (!fullMatch) {
+        return materialize_dfa(re, budget);
+    }
+    RE2::Options options(re.options());
+    std::string body = options.literal() ? RE2::QuoteMeta(re.pattern()) : re.pattern();
+    options.set_literal(false);
+    RE2 anchored("^(?:" + body + ")", options);
+    return anchored.ok() ? materialize_dfa(anchored, budget) : nullptr;
+}
+#endif
+
+// Tables per pattern: built on first use, dropped in freePattern.
+struct PatternDfas {
+    std::once_flag searchOnce;
+    std::once_flag fullOnce;
+    std::unique_ptr<MaterializedDfa> search;  // unanchored, for partial match
+    std::unique_ptr<MaterializedDfa> full;    // anchored at start, for full match
+};
+
+static std::mutex dfa_tables_mutex;
+static std::unordered_map<const RE2*, std::shared_ptr<PatternDfas>> dfa_tables;
+
+/**
+ * Gets the materialized DFA for full or partial matching with re.
+ *
+ * @return the table, or null if unavailable (caller falls back to RE2)
+ */
+static const MaterializedDfa* materialized_dfa(const RE2* re, bool fullMatch) {
+#ifdef RE2_JNI_HAVE_RE2_INTERNALS
+    std::shared_ptr<PatternDfas> entry;
+    {
+        std::lock_guard<std::mutex> lock(dfa_tables_mutex);
+        std::shared_ptr<PatternDfas>& slot = dfa_tables[re];
+        if (slot == nullptr) {
+            slot = std::make_shared<PatternDfas>();
+        }
+        entry = slot;
+    }
+
+    // Bounded by the same budget RE2 gives its own DFAs (2/3 of max_mem, as in explain())
+    int64_t budget = re->options().max_mem() * 2 / 3;
+    if (!fullMatch) {
+        std::call_once(entry->searchOnce,
+                       [&] { entry->search = materialize_dfa(*re, false, budget); });
+        return entry->search.get();
+    }
+    std::call_once(entry->fullOnce, [&] { entry->full = materialize_dfa(*re, true, budget); });
+    return entry->full.get();
+#else
+    (void)re;
+    (void)fullMatch;
+    return nullptr;
+#endif
+}
+
+static void forget_dfa_tables(const RE2* re) {
+    std::lock_guard<std::mutex> lock(dfa_tables_mutex);
+    dfa_tables.erase(re);
+}
+
+// ========== Sorted Batch Matching ==========
+
+/**
+ * Matches keys in order, resuming each key from the DFA state reached at the
+ * end of the prefix it shares with the previous key. For sorted keys with
+ * long common prefixes most bytes are never rescanned. Unsorted input is
+ * still correct, it just shares less.
+ *
+ * Falls back to RE2::FullMatch / PartialMatch per key when the pattern has no
+ * materialized DFA.
+ */
+class SortedBatchMatcher {
+public:
+    SortedBatchMatcher(const RE2* re, bool fullMatch)
+        : re_(re), fullMatch_(fullMatch), dfa_(materialized_dfa(re, fullMatch)) {
+        // A partial match seen mid-key is final unless the pattern ends with $
+        latchMatches_ = dfa_ != nullptr && !fullMatch && !dfa_->anchorEnd;
+    }
+
+    bool match(const char* key, size_t length) {
+        if (dfa_ == nullptr) {
+            re2::StringPiece text(key, length);
+            return fullMatch_ ? RE2::FullMatch(text, *re_) : RE2::PartialMatch(text, *re_);
+        }
+
+        // states_[i] / latched_[i] hold the state and "matched already" flag
+        // after the first i bytes of previous_, for i < valid_
+        size_t depth = std::min({length, previous_.size(), valid_ - 1});
+        size_t shared = 0;
+        while (shared < depth && previous_[shared] == key[shared]) {
+            shared++;
+        }
+        resumedBytes_ += shared;
+
+        if (states_.size() < length + 1) {
+            states_.resize(length + 1);
+            latched_.resize(length + 1);
+        }
+
+        size_t pos = shared;
+        while (pos < length && states_[pos] >= 0 && !latched_[pos]) {
+            int32_t state = dfa_->step(states_[pos], static_cast<uint8_t>(key[pos]));
+            states_[pos + 1] = state;
+            latched_[pos + 1] = latchMatches_ && dfa_->isMatch(state);
+            pos++;
+        }
+        valid_ = pos + 1;
+        previous_.resize(shared);
+        previous_.append(key + shared, length - shared);
+
+        if (latched_[pos]) {
+            return true;
+        }
+        return pos == length && dfa_->matchesAtEnd(states_[pos]);
+    }
+
+    /** Bytes skipped by resuming from a shared prefix. */
+    jlong resumedBytes() const {
+        return resumedBytes_;
+    }
+
+private:
+    const RE2* re_;
+    bool fullMatch_;
+    const MaterializedDfa* dfa_;
+    bool latchMatches_ = false;
+
+    std::string previous_;
+    std::vector<int32_t> states_{0};
+    std::vector<uint8_t> latched_{0};
+    size_t valid_ = 1;
+    jlong resumedBytes_ = 0;
+};
+
+// ========== Frozen DFA Tables ==========
+//
+// RE2 builds its DFA lazily: states live in a per-pattern cache guarded by a
+// reader-writer lock, so every match on a hot pattern still touches shared
+// lock state, and a full cache is reset under the writer lock. A frozen
+// pattern instead owns its complete DFA, materialized once into an immutable
+// table that any number of threads step without synchronization.
+
+/**
+ * Immutable DFA for full or partial matching. States are stored as row
+ * offsets (state x width) so a step is one bytemap load, one add and one
+ * table load. Two sink rows that loop on every byte replace the dead state
+ * and - for partial matches that cannot be undone - the matched state, so the
+ * inner loop has no branches and only checks for a sink every block.
+ */
+class FrozenDfa {
+public:
+    void build(const MaterializedDfa& dfa, bool fullMatch) {
+        size_t states = dfa.match.size();
+        width_ = static_cast<size_t>(dfa.classes);
+        std::memcpy(bytemap_, dfa.bytemap, sizeof(bytemap_));
+
+        // Sinks follow the real states
+        dead_ = static_cast<int32_t>(states * width_);
+        matched_ = static_cast<int32_t>((states + 1) * width_);
+        next_.assign((states + 2) * width_, 0);
+        accept_.assign(states + 2, 0);
+        bool latch = !fullMatch && !dfa.anchorEnd;
+
+        for (size_t s = 0; s < states; s++) {
+            accept_[s] = dfa.matchesAtEnd(static_cast<int32_t>(s)) ? 1 : 0;
+            for (size_t c = 0; c < width_; c++) {
+                int32_t target = dfa.next[s * width_ + c];
+                next_[s * width_ + c] = row_for(dfa, target, latch);
+            }
+        }
+        for (size_t c = 0; c < width_; c++) {
+            next_[dead_ + c] = dead_;
+            next_[matched_ + c] = matched_;
+        }
+        accept_[states + 1] = 1;
+        start_ = latch && dfa.isMatch(0) ? matched_ : 0;
+    }
+
+    bool matches(const uint8_t* text, size_t length) const {
+        const int32_t* next = next_.data();
+        int32_t row = start_;
+        size_t i = 0;
+
+        // Branch-free blocks; sinks absorb the rest of a block, so checking
+        // once per block only costs the bytes stepped after a decision
+        constexpr size_t kBlock = 16;
+        while (i + kBlock <= length) {
+#if defined(__GNUC__)
+            __builtin_prefetch(text + i + 4 * kBlock);
+#endif
+            for (size_t j = 0; j < kBlock; j++) {
+                row = next[row + bytemap_[text[i + j]]];
+            }
+            i += kBlock;
+            if (row >= dead_) {
+                return row == matched_;
+            }
+        }
+        for (; i < length; i++) {
+            row = next[row + bytemap_[text[i]]];
+        }
+        return accept_[static_cast<size_t>(row) / width_] != 0;
+    }
+
+    /** Native bytes held by the table. */
+    size_t memory() const {
+        return sizeof(*this) + next_.capacity() * sizeof(int32_t) + accept_.capacity();
+    }
+
+private:
+    int32_t row_for(const MaterializedDfa& dfa, int32_t target, bool latch) const {
+        if (target < 0) {
+            return dead_;
+        }
+        if (latch && dfa.isMatch(target)) {
+            return matched_;
+        }
+        return static_cast<int32_t>(static_cast<size_t>(target) * width_);
+    }
+
+    uint8_t bytemap_[256] = {};
+    size_t width_ = 0;
+    int32_t start_ = 0;
+    int32_t dead_ = 0;
+    int32_t matched_ = 0;
+    std::vector<int32_t> next_;
+    std::vector<uint8_t> accept_;     // per state: matches at end of text
+};
+
+// ========== Bit-Parallel NFA ==========
+//
+// Small patterns need no DFA at all: with at most 64 byte-consuming
+// instructions ("positions"), the set of live NFA threads fits in one machine
+// word, and a step is a few table lookups - the bit-parallel Glushkov
+// simulation of Navarro and Raffinot, of which Shift-And is the linear case.
+// The automaton is built from RE2's own compiled program, so it consumes
+// exactly the bytes RE2 would (UTF-8 sequences, case folding). Programs with
+// empty-width assertions other than a leading ^ or a trailing $ - which RE2
+// turns into program anchors - are not eligible.
+
+/** One instruction of an RE2 program, as the bit-parallel builder needs it. */
+struct NfaInst {
+    enum Op : uint8_t { kAlt, kByteRange, kEmptyWidth, kMatch, kNop, kFail };
+
+    Op op = kFail;
+    bool last = true;                 // ends an instruction list (flattened programs)
+    bool foldcase = false;            // kByteRange: also match A-Z as a-z
+    uint8_t lo = 0;                   // kByteRange: byte range
+    uint8_t hi = 0;
+    int out = 0;                      // next instruction list
+    int out1 = 0;                     // kAlt: second branch
+};
+
+/**
+ * Bit-parallel NFA over at most 64 positions. Bit p of a state set is the
+ * thread that has just consumed a byte at position p; the set of positions a
+ * state set can move to next is looked up 8 positions at a time. Immutable
+ * once built, so any number of threads match concurrently without locking.
+ */
+class BitParallelNfa {
+public:
+    static constexpr int kMaxPositions = 64;
+
+    /**
+     * Builds the automaton for the program entered at start.
+     *
+     * @return false if the program has more than kMaxPositions positions or
+     *         an empty-width assertion
+     */
+    bool build(const std::vector<NfaInst>& prog, int start, bool anchorStart, bool anchorEnd) {
+        std::vector<int> positions;
+        std::vector<int> positionOf(prog.size(), -1);
+        for (size_t id = 0; id < prog.size(); id++) {
+            if (prog[id].op == NfaInst::kByteRange) {
+                if (positions.size() == kMaxPositions) {
+                    return false;
+                }
+                positionOf[id] = static_cast<int>(positions.size());
+                positions.push_back(static_cast<int>(id));
+            }
+        }
+
+        Closure closure(prog, positionOf);
+        if (!closure.from(start, first_, nullable_)) {
+            return false;
+        }
+
+        std::vector<uint64_t> follow(positions.size());
+        final_ = 0;
+        for (size_t p = 0; p < positions.size(); p++) {
+            const NfaInst& inst = prog[static_cast<size_t>(positions[p])];
+            bool match = false;
+            if (!closure.from(inst.out, follow[p], match)) {
+                return false;
+            }
+            final_ |= match ? uint64_t{1} << p : 0;
+            for (int c = 0; c < 256; c++) {
+                int folded = inst.foldcase && c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+                if (folded >= inst.lo && folded <= inst.hi) {
+                    byteMask_[c] |= uint64_t{1} << p;
+                }
+            }
+        }
+
+        // follow_[k][v]: positions reachable from the set v of positions 8k..8k+7
+        follow_.assign((positions.size() + 7) / 8, {});
+        for (size_t k = 0; k < follow_.size(); k++) {
+            for (size_t v = 1; v < 256; v++) {
+                uint64_t next = 0;
+                for (size_t bit = 0; bit < 8 && 8 * k + bit < positions.size(); bit++) {
+                    if ((v >> bit) & 1) {
+                        next |= follow[8 * k + bit];
+                    }
+                }
+                follow_[k][v] = next;
+            }
+        }
+        anchorStart_ = anchorStart;
+        anchorEnd_ = anchorEnd;
+        return true;
+    }
+
+    bool matches(const uint8_t* text, size_t length, bool fullMatch) const {
+        // Threads start at every offset unless anchored; matches only count
+        // at the end of the text for full matches and end-anchored patterns
+        uint64_t restart = !fullMatch && !anchorStart_ ? first_ : 0;
+        bool atEndOnly = fullMatch || anchorEnd_;
+        if (nullable_ && !atEndOnly) {
+            return true;
+        }
+
+        uint64_t reach = first_;
+        uint64_t consumed = 0;
+        for (size_t i = 0; i < length; i++) {
+            consumed = reach & byteMask_[text[i]];
+            if (!atEndOnly && (consumed & final_) != 0) {
+                return true;
+            }
+            reach = step(consumed) | restart;
+            if (reach == 0) {
+                return i + 1 == length && (consumed & final_) != 0;
+            }
+        }
+        return (consumed & final_) != 0 || (nullable_ && (length == 0 || restart != 0));
+    }
+
+    /** Native bytes held by the automaton. */
+    size_t memory() const {
+        return sizeof(*this) + follow_.capacity() * sizeof(follow_[0]);
+    }
+
+private:
+    /** Epsilon closures over instruction lists, stopping at positions. */
+    class Closure {
+    public:
+        Closure(const std::vector<NfaInst>& prog, const std::vector<int>& positionOf)
+            : prog_(prog), positionOf_(positionOf), seen_(prog.size(), 0) {}
+
+        /** Positions and whether a match is reachable from id; false on assertions. */
+        bool from(int id, uint64_t& positions, bool& match) {
+            std::fill(seen_.begin(), seen_.end(), 0);
+            positions = 0;
+            match = false;
+            stack_.assign(1, id);
+            while (!stack_.empty()) {
+                int list = stack_.back();
+                stack_.pop_back();
+                for (size_t i = static_cast<size_t>(list); i < prog_.size(); i++) {
+                    if (seen_[i]) {
+                        break;
+                    }
+                    seen_[i] = 1;
+                    const NfaInst& inst = prog_[i];
+                    switch (inst.op) {
+                        case NfaInst::kByteRange:
+                            positions |= uint64_t{1} << positionOf_[i];
+                            break;
+                        case NfaInst::kMatch:
+                            match = true;
+                            break;
+                        case NfaInst::kAlt:
+                            stack_.push_back(inst.out);
+                            stack_.push_back(inst.out1);
+                            break;
+                        case NfaInst::kNop:
+                            stack_.push_back(inst.out);
+                            break;
+                        case NfaInst::kEmptyWidth:
+                            return false;
+                        case NfaInst::kFail:
+                            break;
+                    }
+                    if (inst.last) {
+                        break;
+                    }
+                }
+            }
+            return true;
+        }
+
+    private:
+        const std::vector<NfaInst>& prog_;
+        const std::vector<int>& positionOf_;
+        std::vector<uint8_t> seen_;
+        std::vector<int> stack_;
+    };
+
+    uint64_t step(uint64_t consumed) const {
+        uint64_t next = 0;
+        for (size_t k = 0; k < follow_.size() && consumed != 0; k++, consumed >>= 8) {
+            next |= follow_[k][consumed & 0xFF];
+        }
+        return next;
+    }
+
+    uint64_t byteMask_[256] = {};     // per byte: positions that accept it
+    std::vector<std::array<uint64_t, 256>> follow_;
+    uint64_t first_ = 0;              // positions that can consume the first byte
+    uint64_t final_ = 0;              // positions after which the pattern can match
+    bool nullable_ = false;           // matches the empty string
+    bool anchorStart_ = false;
+    bool anchorEnd_ = false;
+};
+
+#ifdef RE2_JNI_HAVE_RE2_INTERNALS
+/** Copies a compiled RE2 program into the form BitParallelNfa builds from. */
+static std::vector<NfaInst> nfa_program(re2::Prog* prog) {
+    std::vector<NfaInst> insts(static_cast<size_t>(prog->size()));
+    for (int id = 0; id < prog->size(); id++) {
+        re2::Prog::Inst* ip = prog->inst(id);
+        NfaInst& inst = insts[static_cast<size_t>(id)];
+        inst.last = ip->last() != 0;
+        inst.out = ip->out();
+        switch (ip->opcode()) {
+            case re2::kInstAlt:
+            case re2::kInstAltMatch:
+                inst.op = NfaInst::kAlt;
+                inst.out1 = ip->out1();
+                break;
+            case re2::kInstByteRange:
+                inst.op = NfaInst::kByteRange;
+                inst.lo = static_cast<uint8_t>(ip->lo());
+                inst.hi = static_cast<uint8_t>(ip->hi());
+                inst.foldcase = ip->foldcase() != 0;
+                break;
+            case re2::kInstCapture:
+            case re2::kInstNop:
+                inst.op = NfaInst::kNop;
+                break;
+            case re2::kInstEmptyWidth:
+                inst.op = NfaInst::kEmptyWidth;
+                break;
+            case re2::kInstMatch:
+                inst.op = NfaInst::kMatch;
+                break;
+            default:
+                inst.op = NfaInst::kFail;
+                break;
+        }
+    }
+    return insts;
+}
+#endif
+
+// ========== Frozen Patterns ==========
+
+/**
+ * Immutable, lock-free matcher owned by a Java Pattern (freeFrozenDfa): the
+ * frozen DFA tables or the bit-parallel NFA.
+ */
+struct FrozenPattern {
+    virtual ~FrozenPattern() = default;
+    virtual bool matches(const uint8_t* text, size_t length, bool fullMatch) const = 0;
+};
+
+/** Both frozen DFA tables of a pattern. */
+struct FrozenDfaPattern : FrozenPattern {
+    FrozenDfa full;
+    FrozenDfa search;
+
+    bool matches(const uint8_t* text, size_t length, bool fullMatch) const override {
+        return fullMatch ? full.matches(text, length) : search.matches(text, length);
+    }
+};
+
+struct FrozenBitParallel : FrozenPattern {
+    BitParallelNfa nfa;
+
+    bool matches(const uint8_t* text, size_t length, bool fullMatch) const override {
+        return nfa.matches(text, length, fullMatch);
+    }
+};
+
+/**
+ * Materializes and freezes the full- and partial-match DFAs of re.
+ *
+ * @return the frozen pattern, or null if either DFA is unavailable or has
+ *         more than maxStates states
+ */
+static std::unique_ptr<FrozenPattern> freeze_pattern(const RE2& re, jint maxStates) {
+#ifdef RE2_JNI_HAVE_RE2_INTERNALS
+    int64_t budget = re.options().max_mem() * 2 / 3;
+    std::unique_ptr<MaterializedDfa> full = materialize_dfa(re, true, budget);
+    std::unique_ptr<MaterializedDfa> search = materialize_dfa(re, false, budget);
+    if (full == nullptr || search == nullptr
+            || full->match.size() > static_cast<size_t>(maxStates)
+            || search->match.size() > static_cast<size_t>(maxStates)) {
+        return nullptr;
+    }
+    // Row offsets of both sinks must fit in int32
+    for (const MaterializedDfa* dfa : {full.get(), search.get()}) {
+        if ((dfa->match.size() + 2) * static_cast<size_t>(dfa->classes)
+                > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+            return nullptr;
+        }
+    }
+
+    auto frozen = std::make_unique<FrozenDfaPattern>();
+    frozen->full.build(*full, true);
+    frozen->search.build(*search, false);
+    return frozen;
+#else
+    (void)re;
+    (void)maxStates;
+    return nullptr;
+#endif
+}
+
+/**
+ * Builds the bit-parallel NFA of re.
+ *
+ * @return the frozen pattern, or null if the program has more than 64
+ *         positions or unsupported assertions
+ */
+static std::unique_ptr<FrozenPattern> freeze_bit_parallel(const RE2& re) {
+#ifdef RE2_JNI_HAVE_RE2_INTERNALS
+    std::unique_ptr<re2::Prog> prog(compile_private_prog(re, re.options().max_mem() * 2 / 3));
+    if (prog == nullptr) {
+        return nullptr;
+    }
+    auto frozen = std::make_unique<FrozenBitParallel>();
+    if (!frozen->nfa.build(nfa_program(prog.get()), prog->start(), prog->anchor_start(),
+                           prog->anchor_end())) {
+        return nullptr;
+    }
+    return frozen;
+#else
+    (void)re;
+    return nullptr;
+#endif
+}
+
+// ========== Structured Record Scanning ==========
+//
+// Locates one field inside a raw JSON object or CSV row without parsing the
+// rest of the record. As in simdjson's first stage, input is classified 64
+// bytes at a time into bitmaps - quotes, escaped bytes, in-string ranges and
+// structural characters - and the lookup walks only the structural positions,
+// so string contents and skipped values are never visited byte by byte.
+
+// Record formats - keep in sync with RecordField
+enum RecordFormat {
+    kRecordJson = 0,
+    kRecordCsv = 1
+};
+
+/** Bitmap of the bytes in a 64-byte block equal to c. */
+static inline uint64_t byte_mask(const uint8_t* block, uint8_t c) {
+#if defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(c));
+    uint64_t mask = 0;
+    for (int i = 0; i < 4; i++) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+        uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        mask |= static_cast<uint64_t>(bits) << (16 * i);
+    }
+    return mask;
+#else
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i++) {
+        mask |= static_cast<uint64_t>(block[i] == c) << i;
+    }
+    return mask;
+#endif
+}
+
+/** Bit i = XOR of bits 0..i: marks each opening quote up to its closing quote. */
+static inline uint64_t prefix_xor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+/**
+ * Forward iterator over the structural positions of a record: unescaped
+ * quotes, plus the given operator bytes when they are outside quotes.
+ */
+class StructuralScanner {
+public:
+    StructuralScanner(const char* data, size_t length, const char* ops, bool backslashEscapes)
+        : data_(reinterpret_cast<const uint8_t*>(data)), length_(length), ops_(ops),
+          backslashEscapes_(backslashEscapes) {}
+
+    /** Position of the next structural byte, or the record length at the end. */
+    size_t next() {
+        while (bits_ == 0) {
+            if (next_ >= length_) {
+                return length_;
+            }
+            classify();
+        }
+        size_t pos = base_ + static_cast<size_t>(__builtin_ctzll(bits_));
+        bits_ &= bits_ - 1;
+        return pos;
+    }
+
+private:
+    void classify() {
+        const uint8_t* block = data_ + next_;
+        size_t available = length_ - next_;
+        if (available < 64) {
+            std::memset(tail_, 0, sizeof(tail_));
+            std::memcpy(tail_, block, available);
+            block = tail_;
+        }
+
+        uint64_t quotes = byte_mask(block, '"');
+        if (backslashEscapes_) {
+            quotes &= ~escaped_bytes(byte_mask(block, '\\'));
+        }
+        uint64_t inString = prefix_xor(quotes) ^ inString_;
+        inString_ = static_cast<uint64_t>(static_cast<int64_t>(inString) >> 63);
+
+        uint64_t ops = 0;
+        for (const char* op = ops_; *op != '\0'; op++) {
+            ops |= byte_mask(block, static_cast<uint8_t>(*op));
+        }
+
+        bits_ = (ops & ~inString) | quotes;
+        if (available < 64) {
+            bits_ &= (uint64_t{1} << available) - 1;
+        }
+        base_ = next_;
+        next_ += 64;
+    }
+
+    /** Bytes escaped by a preceding backslash (backslashes are rare, so walk them). */
+    uint64_t escaped_bytes(uint64_t backslashes) {
+        uint64_t escaped = escapeCarry_;
+        escapeCarry_ = 0;
+        while (backslashes != 0) {
+            int pos = __builtin_ctzll(backslashes);
+            backslashes &= backslashes - 1;
+            uint64_t bit = uint64_t{1} << pos;
+            if ((escaped & bit) != 0) {
+                continue;
+            }
+            if (pos == 63) {
+                escapeCarry_ = 1;
+            } else {
+                escaped |= bit << 1;
+            }
+        }
+        return escaped;
+    }
+
+    const uint8_t* data_;
+    size_t length_;
+    const char* ops_;
+    bool backslashEscapes_;
+
+    size_t next_ = 0;       // first byte of the next block to classify
+    size_t base_ = 0;       // first byte of the current block
+    uint64_t bits_ = 0;     // structural positions left in the current block
+    uint64_t inString_ = 0; // all ones if the previous block ended inside quotes
+    uint64_t escapeCarry_ = 0;
+    uint8_t tail_[64];
+};
+
+/** Parses the 4 hex digits of a \u escape. */
+static bool parse_hex4(const char* p, uint32_t* value) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        v <<= 4;
+        if (c >= '0' && c <= '9') {
+            v |= static_cast<uint32_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            v |= static_cast<uint32_t>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            v |= static_cast<uint32_t>(c - 'A' + 10);
+        } else {
+            return false;
+        }
+    }
+    *value = v;
+    return true;
+}
+
+/**
+ * Decodes the escapes of a JSON string body into per-thread scratch.
+ *
+ * @return false for invalid escapes
+ */
+static bool json_unescape(re2::StringPiece raw, re2::StringPiece* decoded) {
+    // Every escape decodes to no more bytes than it occupies
+    std::vector<char>& out = scratch_field(raw.size());
+    size_t n = 0;
+    const char* p = raw.data();
+    const char* end = p + raw.size();
+    while (p < end) {
+        if (*p != '\\') {
+            out[n++] = *p++;
+            continue;
+        }
+        if (end - p < 2) {
+            return false;
+        }
+        char c = p[1];
+        p += 2;
+        switch (c) {
+            case '"': out[n++] = '"'; break;
+            case '\\': out[n++] = '\\'; break;
+            case '/': out[n++] = '/'; break;
+            case 'b': out[n++] = '\b'; break;
+            case 'f': out[n++] = '\f'; break;
+            case 'n': out[n++] = '\n'; break;
+            case 'r': out[n++] = '\r'; break;
+            case 't': out[n++] = '\t'; break;
+            case 'u': {
+                uint32_t cp;
+                if (end - p < 4 || !parse_hex4(p, &cp)) {
+                    return false;
+                }
+                p += 4;
+                if (cp >= 0xD800 && cp <= 0xDBFF) {
+                    uint32_t low;
+                    if (end - p < 6 || p[0] != '\\' || p[1] != 'u' || !parse_hex4(p + 2, &low) ||
+                        low < 0xDC00 || low > 0xDFFF) {
+                        return false;
+                    }
+                    p += 6;
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                    return false;
+                }
+                if (cp < 0x80) {
+                    out[n++] = static_cast<char>(cp);
+                } else if (cp < 0x800) {
+                    out[n++] = static_cast<char>(0xC0 | (cp >> 6));
+                    out[n++] = static_cast<char>(0x80 | (cp & 0x3F));
+                } else if (cp < 0x10000) {
+                    out[n++] = static_cast<char>(0xE0 | (cp >> 12));
+                    out[n++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                    out[n++] = static_cast<char>(0x80 | (cp & 0x3F));
+                } else {
+                    out[n++] = static_cast<char>(0xF0 | (cp >> 18));
+                    out[n++] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                    out[n++] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                    out[n++] = static_cast<char>(0x80 | (cp & 0x3F));
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    *decoded = re2::StringPiece(out.data(), n);
+    return true;
+}
+
+/** Compares a raw (possibly escaped) JSON key with a decoded path key. */
+static bool json_key_equals(re2::StringPiece raw, re2::StringPiece key) {
+    if (std::memchr(raw.data(), '\\', raw.size()) == nullptr) {
+        return raw == key;
+    }
+    re2::StringPiece decoded;
+    return json_unescape(raw, &decoded) && decoded == key;
+}
+
+/** Advances past a nested object/array; returns the position of its closing bracket. */
+static size_t skip_json_compound(StructuralScanner& scanner, const char* data, size_t length) {
+    int depth = 1;
+    for (;;) {
+        size_t pos = scanner.next();
+        if (pos >= length) {
+            return length;
+        }
+        char c = data[pos];
+        if (c == '{' || c == '[') {
+            depth++;
+        } else if ((c == '}' || c == ']') && --depth == 0) {
+            return pos;
+        }
+    }
+}
+
+/**
+ * Reads the value that starts after the ':' at valueStart. Strings are
+ * returned without their quotes (still escaped), other scalars as their
+ * literal text and objects/arrays as their raw JSON text. after receives the
+ * structural position following the value.
+ */
+static bool read_json_value(StructuralScanner& scanner, const char* data, size_t length,
+                            size_t valueStart, re2::StringPiece* value, bool* isString,
+                            size_t* after) {
+    size_t pos = scanner.next();
+    if (pos >= length) {
+        return false;
+    }
+
+    char c = data[pos];
+    if (c == '"') {
+        size_t close = scanner.next();
+        if (close >= length) {
+            return false;
+        }
+        *value = re2::StringPiece(data + pos + 1, close - pos - 1);
+        *isString = true;
+        *after = scanner.next();
+        return true;
+    }
+    if (c == '{' || c == '[') {
+        size_t close = skip_json_compound(scanner, data, length);
+        if (close >= length) {
+            return false;
+        }
+        *value = re2::StringPiece(data + pos, close + 1 - pos);
+        *isString = false;
+        *after = scanner.next();
+        return true;
+    }
+
+    // Number, true, false or null: the text up to the next ',' or '}'
+    size_t start = valueStart;
+    size_t end = pos;
+    while (start < end && std::isspace(static_cast<unsigned char>(data[start]))) {
+        start++;
+    }
+    while (end > start && std::isspace(static_cast<unsigned char>(data[end - 1]))) {
+        end--;
+    }
+    *value = re2::StringPiece(data + start, end - start);
+    *isString = false;
+    *after = pos;
+    return start < end;
+}
+
+/**
+ * Finds the value at an object key path in one JSON object record. Only the
+ * first occurrence of a duplicated key is considered; missing keys, non-object
+ * intermediate values and malformed records are not found.
+ */
+static bool find_json_field(const char* data, size_t length,
+                            const std::vector<re2::StringPiece>& path,
+                            re2::StringPiece* field, bool* isString) {
+    StructuralScanner scanner(data, length, "{}[]:,", true);
+    size_t pos = scanner.next();
+    if (pos >= length || data[pos] != '{') {
+        return false;
+    }
+
+    for (size_t k = 0; k < path.size(); k++) {
+        for (;;) {
+            size_t open = scanner.next();
+            if (open >= length || data[open] != '"') {
+                return false;
+            }
+            size_t close = scanner.next();
+            size_t colon = scanner.next();
+            if (close >= length || colon >= length || data[colon] != ':') {
+                return false;
+            }
+
+            re2::StringPiece key(data + open + 1, close - open - 1);
+            size_t after;
+            if (json_key_equals(key, path[k])) {
+                if (k + 1 == path.size()) {
+                    return read_json_value(scanner, data, length, colon + 1, field, isString,
+                                           &after);
+                }
+                size_t brace = scanner.next();
+                if (brace >= length || data[brace] != '{') {
+                    return false;
+                }
+                break;
+            }
+
+            re2::StringPiece skipped;
+            bool skippedString;
+            if (!read_json_value(scanner, data, length, colon + 1, &skipped, &skippedString,
+                                 &after) ||
+                after >= length || data[after] != ',') {
+                return false;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Finds a 0-based column of one CSV row (RFC 4180 quoting, "" inside quoted
+ * fields). A trailing line break is not part of the last field. Quoted fields
+ * are returned without their quotes (still escaped).
+ */
+static bool find_csv_field(const char* data, size_t length, char delimiter, jint column,
+                           re2::StringPiece* field, bool* quoted) {
+    while (length > 0 && (data[length - 1] == '\n' || data[length - 1] == '\r')) {
+        length--;
+    }
+
+    const char ops[] = {delimiter, '\0'};
+    StructuralScanner scanner(data, length, ops, false);
+    size_t start = 0;
+    for (jint index = 0;; index++) {
+        size_t pos = scanner.next();
+        while (pos < length && data[pos] == '"') {
+            pos = scanner.next();
+        }
+        if (index == column) {
+            size_t end = std::min(pos, length);
+            *quoted = end - start >= 2 && data[start] == '"' && data[end - 1] == '"';
+            if (*quoted) {
+                start++;
+                end--;
+            }
+            *field = re2::StringPiece(data + start, end - start);
+            return true;
+        }
+        if (pos >= length) {
+            return false;
+        }
+        start = pos + 1;
+    }
+}
+
+/** Collapses the doubled quotes of a quoted CSV field into per-thread scratch. */
+static re2::StringPiece csv_unescape(re2::StringPiece raw) {
+    std::vector<char>& out = scratch_field(raw.size());
+    size_t n = 0;
+    for (size_t i = 0; i < raw.size(); i++) {
+        out[n++] = raw[i];
+        if (raw[i] == '"' && i + 1 < raw.size() && raw[i + 1] == '"') {
+            i++;
+        }
+    }
+    return re2::StringPiece(out.data(), n);
+}
+
+/**
+ * Matches a pattern against one field of raw records. The field is matched
+ * in place unless it contains escapes, which are decoded first.
+ */
+class RecordFieldMatcher {
+public:
+    RecordFieldMatcher(const RE2* re, bool fullMatch, jint format,
+                       const std::vector<re2::StringPiece>& path, char delimiter, jint column)
+        : re_(re), fullMatch_(fullMatch), format_(format), path_(path), delimiter_(delimiter),
+          column_(column) {}
+
+    /** True if the record has the field and it matches; absent fields never match. */
+    bool match(const char* data, size_t length) const {
+        re2::StringPiece field;
+        if (format_ == kRecordJson) {
+            bool isString = false;
+            if (!find_json_field(data, length, path_, &field, &isString)) {
+                return false;
+            }
+            if (isString && std::memchr(field.data(), '\\', field.size()) != nullptr &&
+                !json_unescape(field, &field)) {
+                return false;
+            }
+        } else {
+            bool quoted = false;
+            if (!find_csv_field(data, length, delimiter_, column_, &field, &quoted)) {
+                return false;
+            }
+            if (quoted && std::memchr(field.data(), '"', field.size()) != nullptr) {
+                field = csv_unescape(field);
+            }
+        }
+        return fullMatch_ ? RE2::FullMatch(field, *re_) : RE2::PartialMatch(field, *re_);
+    }
+
+private:
+    const RE2* re_;
+    bool fullMatch_;
+    jint format_;
+    const std::vector<re2::StringPiece>& path_;
+    char delimiter_;
+    jint column_;
+};
+
+// ========== Pattern Expressions ==========
+//
+// A boolean tree of patterns, literal tests and length predicates evaluated in
+// one native call per input (or per batch) with short-circuiting. Each AND/OR
+// node keeps sampled statistics per child - how often it decides the node
+// (false for AND, true for OR) and what it costs - and periodically reorders
+// its children by cost / P(decisive), so cheap selective checks run first.
+
+// Node ops - keep in sync with PatternExpression
+enum ExprOp {
+    kExprMatches = 0,
+    kExprFind,
+    kExprContains,
+    kExprStartsWith,
+    kExprEndsWith,
+    kExprLength,
+    kExprAnd,
+    kExprOr,
+    kExprNot
+};
+
+// Child order is packed 4 bits per position into one atomic word
+static constexpr size_t kExprMaxChildren = 16;
+// Statistics are recorded for 1 in 8 evaluations per thread
+static constexpr uint32_t kExprSampleMask = 7;
+// Sampled evaluations of an AND/OR node between reorders
+static constexpr uint64_t kExprReorderInterval = 64;
+// Samples needed before measured cost replaces the static estimate
+static constexpr uint64_t kExprMinCostSamples = 16;
+// Nesting limit, bounding the recursion of parse and evaluate
+static constexpr size_t kExprMaxDepth = 64;
+
+struct ExprNode {
+    int32_t op = 0;
+    int32_t min = 0;
+    int32_t max = -1;
+    const RE2* re = nullptr;
+    std::string literal;
+    std::vector<int32_t> children;
+    double estimatedCost = 1;
+
+    // Relaxed counters: shared by all evaluating threads, only ever approximate
+    std::atomic<uint64_t> order{0};
+    std::atomic<uint64_t> samples{0};
+    std::atomic<uint64_t> trueSamples{0};
+    std::atomic<uint64_t> costNanos{0};
+};
+
+class ExpressionProgram {
+public:
+    /**
+     * Builds a program from preorder (op, a, b) triples: pattern ops a =
+     * pattern index; literal ops a/b = offset/length in literals; length a/b =
+     * min/max bytes (max -1 = unbounded); AND/OR/NOT a = child count.
+     *
+     * @return the program, or null with error set if the encoding is invalid
+     */
+    static std::unique_ptr<ExpressionProgram> build(const jint* program, size_t programInts,
+                                                    const jlong* handles, size_t handleCount,
+                                                    const char* literals, size_t literalBytes,
+                                                    std::string* error) {
+        size_t count = programInts / 3;
+        if (count == 0 || programInts % 3 != 0) {
+            *error = "Expression program is empty or truncated";
+            return nullptr;
+        }
+
+        std::unique_ptr<ExpressionProgram> result(new ExpressionProgram(count));
+        size_t next = 0;
+        if (!result->parse(program, count, handles, handleCount, literals, literalBytes, 0, &next,
+                           error)) {
+            return nullptr;
+        }
+        if (next != count) {
+            *error = "Expression program has trailing nodes";
+            return nullptr;
+        }
+        for (size_t i = 0; i < count; i++) {
+            result->reorder(result->nodes_[i]);
+        }
+        return result;
+    }
+
+    /** Evaluates the expression, recording statistics for a sample of calls. */
+    bool evaluate(re2::StringPiece text) {
+        static thread_local uint32_t tick = 0;
+        bool sampled = (++tick & kExprSampleMask) == 0;
+        return eval(0, text, sampled);
+    }
+
+    size_t size() const {
+        return count_;
+    }
+
+    const ExprNode& node(size_t index) const {
+        return nodes_[index];
+    }
+
+private:
+    explicit ExpressionProgram(size_t count) : nodes_(new ExprNode[count]), count_(count) {}
+
+    bool parse(const jint* program, size_t count, const jlong* handles, size_t handleCount,
+               const char* literals, size_t literalBytes, size_t depth, size_t* next,
+               std::string* error) {
+        if (*next >= count) {
+            *error = "Expression program is truncated";
+            return false;
+        }
+        if (depth >= kExprMaxDepth) {
+            *error = "Expression nested too deeply";
+            return false;
+        }
+        size_t index = (*next)++;
+        ExprNode& node = nodes_[index];
+        node.op = program[3 * index];
+        jint a = program[3 * index + 1];
+        jint b = program[3 * index + 2];
+
+        switch (node.op) {
+            case kExprMatches:
+            case kExprFind:
+                if (a < 0 || static_cast<size_t>(a) >= handleCount || handles[a] == 0) {
+                    *error = "Invalid expression pattern operand";
+                    return false;
+                }
+                node.re = reinterpret_cast<const RE2*>(handles[a]);
+                node.estimatedCost = 20.0 + node.re->ProgramSize();
+                return true;
+            case kExprContains:
+            case kExprStartsWith:
+            case kExprEndsWith:
+                if (a < 0 || b < 0 ||
+                    static_cast<size_t>(a) + static_cast<size_t>(b) > literalBytes) {
+                    *error = "Invalid expression literal operand";
+                    return false;
+                }
+                node.literal.assign(literals + a, static_cast<size_t>(b));
+                node.estimatedCost = node.op == kExprContains ? 4.0 : 2.0;
+                return true;
+            case kExprLength:
+                if (a < 0 || (b >= 0 && b < a) || b < -1) {
+                    *error = "Invalid expression length bounds";
+                    return false;
+                }
+                node.min = a;
+                node.max = b;
+                node.estimatedCost = 1.0;
+                return true;
+            case kExprAnd:
+            case kExprOr:
+            case kExprNot: {
+                bool unary = node.op == kExprNot;
+                if (a < 1 || static_cast<size_t>(a) > kExprMaxChildren || (unary && a != 1)) {
+                    *error = "Invalid expression child count";
+                    return false;
+                }
+                node.estimatedCost = 0;
+                for (jint i = 0; i < a; i++) {
+                    int32_t child = static_cast<int32_t>(*next);
+                    if (!parse(program, count, handles, handleCount, literals, literalBytes,
+                               depth + 1, next, error)) {
+                        return false;
+                    }
+                    node.children.push_back(child);
+                    node.estimatedCost += nodes_[child].estimatedCost;
+                }
+                return true;
+            }
+            default:
+                *error = "Invalid expression op";
+                return false;
+        }
+    }
+
+    bool eval(int32_t index, re2::StringPiece text, bool sampled) {
+        ExprNode& node = nodes_[index];
+        if (!sampled) {
+            return eval_node(node, text, false);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        bool result = eval_node(node, text, true);
+        auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+        node.costNanos.fetch_add(static_cast<uint64_t>(nanos), std::memory_order_relaxed);
+        if (result) {
+            node.trueSamples.fetch_add(1, std::memory_order_relaxed);
+        }
+        uint64_t samples = node.samples.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (samples % kExprReorderInterval == 0) {
+            reorder(node);
+        }
+        return result;
+    }
+
+    bool eval_node(ExprNode& node, re2::StringPiece text, bool sampled) {
+        std::string_view input(text.data(), text.size());
+        switch (node.op) {
+            case kExprMatches: {
+                PatternScope scope(node.re);
+                return RE2::FullMatch(text, *node.re);
+            }
+            case kExprFind: {
+                PatternScope scope(node.re);
+                return RE2::PartialMatch(text, *node.re);
+            }
+            case kExprContains:
+                return input.find(node.literal) != std::string_view::npos;
+            case kExprStartsWith:
+                return input.substr(0, node.literal.size()) == node.literal;
+            case kExprEndsWith:
+                return input.size() >= node.literal.size() &&
+                       input.substr(input.size() - node.literal.size()) == node.literal;
+            case kExprLength:
+                return input.size() >= static_cast<size_t>(node.min) &&
+                       (node.max < 0 || input.size() <= static_cast<size_t>(node.max));
+            case kExprNot:
+                return !eval(node.children[0], text, sampled);
+            default: {
+                // AND stops at the first false child, OR at the first true one
+                bool decisive = node.op == kExprOr;
+                uint64_t order = node.order.load(std::memory_order_relaxed);
+                for (size_t i = 0; i < node.children.size(); i++) {
+                    size_t child = (order >> (4 * i)) & 0xF;
+                    if (eval(node.children[child], text, sampled) == decisive) {
+                        return decisive;
+                    }
+                }
+                return !decisive;
+            }
+        }
+    }
+
+    /** Average sampled cost, or the static estimate until enough samples exist. */
+    double cost(const ExprNode& node) const {
+        uint64_t samples = node.samples.load(std::memory_order_relaxed);
+        if (samples < kExprMinCostSamples) {
+            return node.estimatedCost;
+        }
+        return static_cast<double>(node.costNanos.load(std::memory_order_relaxed)) / samples;
+    }
+
+    /** Orders AND/OR children by expected cost per decisive result, cheapest first. */
+    void reorder(ExprNode& node) {
+        if (node.op != kExprAnd && node.op != kExprOr) {
+            return;
+        }
+
+        size_t n = node.children.size();
+        double rank[kExprMaxChildren];
+        size_t positions[kExprMaxChildren];
+        for (size_t i = 0; i < n; i++) {
+            const ExprNode& child = nodes_[node.children[i]];
+            // Laplace-smoothed probability that this child decides the node
+            double samples = static_cast<double>(child.samples.load(std::memory_order_relaxed));
+            double trues = static_cast<double>(child.trueSamples.load(std::memory_order_relaxed));
+            double decisive = node.op == kExprAnd ? samples - trues : trues;
+            rank[i] = cost(child) * (samples + 2) / (decisive + 1);
+            positions[i] = i;
+        }
+        std::stable_sort(positions, positions + n,
+                         [&rank](size_t x, size_t y) { return rank[x] < rank[y]; });
+
+        uint64_t order = 0;
+        for (size_t i = 0; i < n; i++) {
+            order |= static_cast<uint64_t>(positions[i]) << (4 * i);
+        }
+        node.order.store(order, std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<ExprNode[]> nodes_;
+    size_t count_;
+};
+
+// ========== Record Mapping ==========
+//
+// mapFields() extracts the groups behind a record's components in one call:
+// text components come back as UTF-16 offsets for String.substring, numeric
+// ones are parsed here so no intermediate String is built. Anything the fast
+// parsers do not accept (non-ASCII digits, overflow, exotic double syntax) is
+// reported as unparsed and left to Long.parseLong / Double.parseDouble, which
+// also produce the error for malformed input.
+
+// Component kinds - keep in sync with RecordMapper.java
+enum FieldKind : jint {
+    kFieldText = 0,
+    kFieldLong = 1,
+    kFieldDouble = 2
+};
+
+// Slots written per component: start, end (UTF-16), status, value
+static constexpr size_t kFieldSlots = 4;
+static constexpr size_t kMaxMappedFields = 4096;
+
+enum FieldStatus : jlong {
+    kFieldOk = 0,
+    kFieldAbsent = 1,
+    kFieldUnparsed = 2
+};
+
+/**
+ * Parses an optionally signed run of ASCII digits with Long.parseLong's
+ * overflow rules. Returns false for anything else.
+ */
+static bool parse_long_field(re2::StringPiece text, jlong* value) {
+    size_t i = 0;
+    bool negative = false;
+    if (!text.empty() && (text[0] == '-' || text[0] == '+')) {
+        negative = text[0] == '-';
+        i = 1;
+    }
+    if (i == text.size()) {
+        return false;
+    }
+
+    // Accumulate negatively, as Long.parseLong does, so MIN_VALUE parses
+    const jlong limit = negative ? std::numeric_limits<jlong>::min()
+                                 : -std::numeric_limits<jlong>::max();
+    const jlong multmin = limit / 10;
+    jlong result = 0;
+    for (; i < text.size(); i++) {
+        unsigned digit = static_cast<unsigned char>(text[i]) - '0';
+        if (digit > 9 || result < multmin) {
+            return false;
+        }
+        result *= 10;
+        if (result < limit + static_cast<jlong>(digit)) {
+            return false;
+        }
+        result -= digit;
+    }
+    *value = negative ? result : -result;
+    return true;
+}
+
+/**
+ * Parses plain decimal notation ([+-]digits[.digits][(e|E)[+-]digits]) when
+ * the result is exact: at most 2^53 as an integer mantissa scaled by a power
+ * of ten within 10^22, so one IEEE multiply or divide rounds correctly.
+ * Returns false for anything else.
+ */
+static bool parse_double_field(re2::StringPiece text, double* value) {
+    static constexpr double kPowersOfTen[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    size_t i = 0;
+    bool negative = false;
+    if (i < text.size() && (text[i] == '-' || text[i] == '+')) {
+        negative = text[i] == '-';
+        i++;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool any = false;
+    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++) {
+        any = true;
+        if (mantissa != 0 || text[i] != '0') {
+            if (++digits > 16) {
+                return false;
+            }
+            mantissa = mantissa * 10 + static_cast<uint64_t>(text[i] - '0');
+        }
+    }
+    if (i < text.size() && text[i] == '.') {
+        for (i++; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++) {
+            any = true;
+            if (mantissa != 0 || text[i] != '0') {
+                if (++digits > 16) {
+                    return false;
+                }
+                mantissa = mantissa * 10 + static_cast<uint64_t>(text[i] - '0');
+            }
+            exponent--;
+        }
+    }
+    if (!any) {
+        return false;
+    }
+    if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+        i++;
+        bool negativeExponent = false;
+        if (i < text.size() && (text[i] == '-' || text[i] == '+')) {
+            negativeExponent = text[i] == '-';
+            i++;
+        }
+        int explicitExponent = 0;
+        bool anyExponent = false;
+        for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++) {
+            anyExponent = true;
+            if (explicitExponent > 1000) {
+                return false;
+            }
+            explicitExponent = explicitExponent * 10 + (text[i] - '0');
+        }
+        if (!anyExponent) {
+            return false;
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+    if (i != text.size() || mantissa > (uint64_t{1} << 53)) {
+        return false;
+    }
+
+    double result = static_cast<double>(mantissa);
+    if (mantissa != 0) {
+        if (exponent < -22 || exponent > 22) {
+            return false;
+        }
+        result = exponent < 0 ? result / kPowersOfTen[-exponent] : result * kPowersOfTen[exponent];
+    }
+    *value = negative ? -result : result;
+    return true;
+}
+
+/**
+ * Fills kFieldSlots slots per component from the groups of one match. Group
+ * byte offsets are converted to UTF-16 in a single pass over the input by
+ * visiting them in ascending order (groups may nest, so slot order is not
+ * offset order).
+ */
+static void map_fields(re2::StringPiece input, const std::vector<re2::StringPiece>& groups,
+                       const jint* spec, size_t count, jlong* out) {
+    std::vector<uint64_t>& keys = scratch_keys(0);
+    for (size_t i = 0; i < count; i++) {
+        const re2::StringPiece& group = groups[static_cast<size_t>(spec[2 * i])];
+        jlong* field = out + i * kFieldSlots;
+        if (group.data() == nullptr) {
+            field[0] = -1;
+            field[1] = -1;
+            field[2] = kFieldAbsent;
+            field[3] = 0;
+            continue;
+        }
+
+        uint64_t start = static_cast<uint64_t>(group.data() - input.data());
+        scratch_push(keys, start << 20 | (i * kFieldSlots));
+        scratch_push(keys, (start + group.size()) << 20 | (i * kFieldSlots + 1));
+
+        field[2] = kFieldOk;
+        field[3] = 0;
+        if (spec[2 * i + 1] == kFieldLong) {
+            if (!parse_long_field(group, &field[3])) {
+                field[2] = kFieldUnparsed;
+            }
+        } else if (spec[2 * i + 1] == kFieldDouble) {
+            double parsed;
+            if (parse_double_field(group, &parsed)) {
+                std::memcpy(&field[3], &parsed, sizeof(parsed));
+            } else {
+                field[2] = kFieldUnparsed;
+            }
+        }
+    }
+
+    std::sort(keys.begin(), keys.end());
+    size_t byte = 0;
+    jlong unit = 0;
+    for (uint64_t key : keys) {
+        size_t target = static_cast<size_t>(key >> 20);
+        for (; byte < target; byte++) {
+            unsigned char c = static_cast<unsigned char>(input[byte]);
+            if ((c & 0xC0) != 0x80) {
+                unit += c >= 0xF0 ? 2 : 1;  // 4-byte sequences are surrogate pairs
+            }
+        }
+        out[key & 0xFFFFF] = unit;
+    }
+}
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compile(
+    JNIEnv *env, jclass cls, jstring pattern, jboolean caseSensitive) {
+
+    return compile_pattern(env, pattern, caseSensitive, RE2::Options::kDefaultMaxMem);
+}
+
+/**
+ * Compile with an explicit RE2 max_mem budget (program + DFA caches).
+ * Used to give hot patterns that keep exhausting their DFA budget more room.
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compileWithMaxMem(
+    JNIEnv *env, jclass cls, jstring pattern, jboolean caseSensitive, jlong maxMem) {
+
+    if (maxMem <= 0) {
+        last_error = "max_mem must be positive";
+        return 0;
+    }
+
+    return compile_pattern(env, pattern, caseSensitive, static_cast<int64_t>(maxMem));
+}
+
+JNIEXPORT void JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freePattern(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle != 0) {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        forget_dfa_failures(re);
+        forget_dfa_tables(re);
+        delete re;
+    }
+}
+
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_fullMatch(
+    JNIEnv *env, jclass cls, jlong handle, jstring text) {
+
+    TraceScope trace(TRACE_FULL_MATCH, handle, -1);
+
+    if (handle == 0 || text == nullptr) {
+        last_error = "Null pointer";
+        return JNI_FALSE;
+    }
+
+    JStringGuard guard(env, text);
+    if (!guard.valid()) {
+        last_error = "Failed to get text string";
+        return JNI_FALSE;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        re2::StringPiece input(guard.get());
+        trace.setLength(static_cast<jlong>(input.size()));
+
+        bool matched = RE2::FullMatch(input, *re);
+        trace.setResult(matched ? 1 : 0);
+        return matched ? JNI_TRUE : JNI_FALSE;
+    } catch (const std::exception& e) {
+        set_error("Exception: ", e.what());
+        return JNI_FALSE;
+    }
+}
+
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partialMatch(
+    JNIEnv *env, jclass cls, jlong handle, jstring text) {
+
+    TraceScope trace(TRACE_PARTIAL_MATCH, handle, -1);
+
+    if (handle == 0 || text == nullptr) {
+        last_error = "Null pointer";
+        return JNI_FALSE;
+    }
+
+    JStringGuard guard(env, text);
+    if (!guard.valid()) {
+        last_error = "Failed to get text string";
+        return JNI_FALSE;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        re2::StringPiece input(guard.get());
+        trace.setLength(static_cast<jlong>(input.size()));
+
+        bool matched = RE2::PartialMatch(input, *re);
+        trace.setResult(matched ? 1 : 0);
+        return matched ? JNI_TRUE : JNI_FALSE;
+    } catch (const std::exception& e) {
+        set_error("Exception: ", e.what());
+        return JNI_FALSE;
+    }
+}
+
+JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_getError(
+    JNIEnv *env, jclass cls) {
+
+    if (last_error.empty()) {
+        return nullptr;
+    }
+    return env->NewStringUTF(last_error.c_str());
+}
+
+JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_getPattern(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        return env->NewStringUTF(re->pattern().c_str());
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+JNIEXPORT jint JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_numCapturingGroups(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        last_error = "Pattern is null";
+        return -1;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        return static_cast<jint>(re->NumberOfCapturingGroups());
+    } catch (const std::exception& e) {
+        set_error("Exception: ", e.what());
+        return -1;
+    }
+}
+
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_patternOk(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        return JNI_FALSE;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        return re->ok() ? JNI_TRUE : JNI_FALSE;
+    } catch (...) {
+        return JNI_FALSE;
+    }
+}
+
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_patternMemory(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        return 0;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        return static_cast<jlong>(re->ProgramSize());
+    } catch (...) {
+        return 0;
+    }
+}
+
+/**
+ * Turns DFA failure tracking on or off for patterns compiled afterwards.
+ * Returns whether tracking is now on (never, if this build cannot detect
+ * failures).
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_setDfaFailureTracking(
+    JNIEnv *env, jclass cls, jboolean enabled) {
+
+    bool tracking = enabled == JNI_TRUE && install_dfa_failure_sink();
+    dfa_failure_tracking.store(tracking, std::memory_order_relaxed);
+    return tracking ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Number of times this pattern's DFA ran out of memory and RE2 fell back to
+ * the NFA. Returns -1 if detection is unavailable in this build or tracking
+ * is off.
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_dfaFailureCount(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (!dfa_failure_tracking_enabled()) {
+        return -1;
+    }
+
+    if (handle == 0) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(dfa_failures_mutex);
+    auto it = dfa_failures.find(reinterpret_cast<const RE2*>(handle));
+    return it != dfa_failures.end() ? it->second : 0;
+}
+
+/**
+ * Number of times the calling thread's scratch buffers had to allocate (or
+ * grow). Stays constant across steady-state calls; used by tests to check
+ * that hot paths reuse their scratch.
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_scratchAllocations(
+    JNIEnv *env, jclass cls) {
+
+    return scratch_allocations;
+}
+
+// ========== Bulk Matching Operations ==========
+
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_fullMatchBulk(
+    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts) {
+
+    TraceScope trace(TRACE_FULL_MATCH_BULK, handle, -1);
+
+    if (handle == 0 || texts == nullptr) {
+        last_error = "Null pointer";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        jsize length = env->GetArrayLength(texts);
+        trace.setLength(length);
+
+        // Allocate result array
+        jbooleanArray results = env->NewBooleanArray(length);
+        if (results == nullptr) {
+            last_error = "Failed to allocate result array";
+            return nullptr;
+        }
+
+        // Process all strings in native code (single JNI crossing)
+        std::vector<jboolean>& matches = scratch_booleans(length);
+        jlong matchCount = 0;
+        for (jsize i = 0; i < length; i++) {
+            jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
+            if (jstr == nullptr) {
+                matches[i] = JNI_FALSE;
+                continue;
+            }
+
+            JStringGuard guard(env, jstr);
+            if (guard.valid()) {
+                matches[i] = RE2::FullMatch(guard.get(), *re) ? JNI_TRUE : JNI_FALSE;
+                matchCount += matches[i];
+            } else {
+                matches[i] = JNI_FALSE;
+            }
+
+            env->DeleteLocalRef(jstr);
+        }
+
+        // Write results back to Java
+        env->SetBooleanArrayRegion(results, 0, length, matches.data());
+        trace.setResult(matchCount);
+        return results;
+
+    } catch (const std::exception& e) {
+        set_error("Bulk match exception: ", e.what());
+        return nullptr;
+    }
+}
+
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partialMatchBulk(
+    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts) {
+
+    TraceScope trace(TRACE_PARTIAL_MATCH_BULK, handle, -1);
+
+    if (handle == 0 || texts == nullptr) {
+        last_error = "Null pointer";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        jsize length = env->GetArrayLength(texts);
+        trace.setLength(length);
+
+        jbooleanArray results = env->NewBooleanArray(length);
+        if (results == nullptr) {
+            last_error = "Failed to allocate result array";
+            return nullptr;
+        }
+
+        std::vector<jboolean>& matches = scratch_booleans(length);
+        jlong matchCount = 0;
+        for (jsize i = 0; i < length; i++) {
+            jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
+            if (jstr == nullptr) {
+                matches[i] = JNI_FALSE;
+                continue;
+            }
+
+            JStringGuard guard(env, jstr);
+            if (guard.valid()) {
+                matches[i] = RE2::PartialMatch(guard.get(), *re) ? JNI_TRUE : JNI_FALSE;
+                matchCount += matches[i];
+            } else {
+                matches[i] = JNI_FALSE;
+            }
+
+            env->DeleteLocalRef(jstr);
+        }
+
+        env->SetBooleanArrayRegion(results, 0, length, matches.data());
+        trace.setResult(matchCount);
+        return results;
+
+    } catch (const std::exception& e) {
+        set_error("Bulk partial match exception: ", e.what());
+        return nullptr;
+    }
+}
+
+/**
+ * Shared body of findAllMatches() and findAllMatchesDirect(): collects the
+ * group pieces of every non-overlapping match into per-thread scratch, then
+ * builds String[][] (non-participating groups become ""). Stops after a
+ * zero-length match.
+ */
+static jobjectArray find_all_matches(JNIEnv* env, const RE2* re, re2::StringPiece input,
+                                     TraceScope& trace) {
+    int numGroups = re->NumberOfCapturingGroups();
+    std::vector<re2::StringPiece>& groups = scratch_groups(numGroups + 1);
+    std::vector<re2::StringPiece>& pieces = scratch_matches();
+
+    while (re->Match(input, 0, input.size(), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
+        for (const re2::StringPiece& group : groups) {
+            scratch_push(pieces, group);
+        }
+
+        // Advance past this match
+        if (groups[0].size() == 0) {
+            break;  // Avoid infinite loop on zero-length match
+        }
+        input.remove_prefix(groups[0].data() - input.data() + groups[0].size());
+    }
+
+    jsize matchCount = static_cast<jsize>(pieces.size() / groups.size());
+    trace.setResult(matchCount);
+    if (matchCount == 0) {
+        return nullptr;
+    }
+
+    // Create Java array of arrays
+    jclass stringArrayClass = env->FindClass("[Ljava/lang/String;");
+    jclass stringClass = env->FindClass("java/lang/String");
+    jobjectArray result = env->NewObjectArray(matchCount, stringArrayClass, nullptr);
+    if (result == nullptr) {
+        return nullptr;
+    }
+
+    for (jsize i = 0; i < matchCount; i++) {
+        jobjectArray groupArray = env->NewObjectArray(numGroups + 1, stringClass, nullptr);
+
+        for (int j = 0; j <= numGroups; j++) {
+            const re2::StringPiece& group = pieces[static_cast<size_t>(i) * (numGroups + 1) + j];
+            jstring jstr = new_string_utf(env, group.data() != nullptr ? group : re2::StringPiece(""));
+            env->SetObjectArrayElement(groupArray, j, jstr);
+            env->DeleteLocalRef(jstr);
+        }
+
+        env->SetObjectArrayElement(result, i, groupArray);
+        env->DeleteLocalRef(groupArray);
+    }
+
+    return result;
+}
+
+// ========== Capture Group Operations ==========
+
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractGroups(
+    JNIEnv *env, jclass cls, jlong handle, jstring text) {
+
+    TraceScope trace(TRACE_EXTRACT_GROUPS, handle, -1);
+
+    if (handle == 0 || text == nullptr) {
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        JStringGuard guard(env, text);
+        if (!guard.valid()) {
+            return nullptr;
+        }
+
+        re2::StringPiece input(guard.get());
+        trace.setLength(static_cast<jlong>(input.size()));
+
+        int numGroups = re->NumberOfCapturingGroups();
+        std::vector<re2::StringPiece>& groups = scratch_groups(numGroups + 1);  // +1 for full match
+
+        // Match and extract groups
+        if (!re->Match(input, 0, input.size(), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
+            trace.setResult(0);
+            return nullptr;  // No match
+        }
+
+        // Create Java string array
+        jclass stringClass = env->FindClass("java/lang/String");
+        jobjectArray result = env->NewObjectArray(numGroups + 1, stringClass, nullptr);
+        if (result == nullptr) {
+            return nullptr;
+        }
+
+        // Fill array with groups
+        for (int i = 0; i <= numGroups; i++) {
+            if (groups[i].data() != nullptr) {
+                jstring jstr = new_string_utf(env, groups[i]);
+                env->SetObjectArrayElement(result, i, jstr);
+                env->DeleteLocalRef(jstr);
+            }
+        }
+
+        trace.setResult(1);
+        return result;
+
+    } catch (const std::exception& e) {
+        set_error("Extract groups exception: ", e.what());
+        return nullptr;
+    }
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractGroupsBulk(
+    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts) {
+
+    TraceScope trace(TRACE_EXTRACT_GROUPS_BULK, handle, -1);
+
+    if (handle == 0 || texts == nullptr) {
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        jsize length = env->GetArrayLength(texts);
+        trace.setLength(length);
+        int numGroups = re->NumberOfCapturingGroups();
+        jlong matchCount = 0;
+
+        // Create outer array (one element per input text)
+        jclass stringArrayClass = env->FindClass("[Ljava/lang/String;");
+        jobjectArray result = env->NewObjectArray(length, stringArrayClass, nullptr);
+        if (result == nullptr) {
+            return nullptr;
+        }
+
+        // Process each text
+        for (jsize i = 0; i < length; i++) {
+            jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
+            if (jstr == nullptr) {
+                continue;
+            }
+
+            JStringGuard guard(env, jstr);
+            if (!guard.valid()) {
+                env->DeleteLocalRef(jstr);
+                continue;
+            }
+
+            std::vector<re2::StringPiece>& groups = scratch_groups(numGroups + 1);
+            if (re->Match(guard.get(), 0, strlen(guard.get()), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
+                // Create string array for this match's groups
+                jclass stringClass = env->FindClass("java/lang/String");
+                jobjectArray groupArray = env->NewObjectArray(numGroups + 1, stringClass, nullptr);
+
+                for (int j = 0; j <= numGroups; j++) {
+                    if (groups[j].data() != nullptr) {
+                        jstring groupStr = new_string_utf(env, groups[j]);
+                        env->SetObjectArrayElement(groupArray, j, groupStr);
+                        env->DeleteLocalRef(groupStr);
+                    }
+                }
+
+                env->SetObjectArrayElement(result, i, groupArray);
+                env->DeleteLocalRef(groupArray);
+                matchCount++;
+            }
+
+            env->DeleteLocalRef(jstr);
+        }
+
+        trace.setResult(matchCount);
+        return result;
+
+    } catch (const std::exception& e) {
+        set_error("Extract groups bulk exception: ", e.what());
+        return nullptr;
+    }
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_findAllMatches(
+    JNIEnv *env, jclass cls, jlong handle, jstring text) {
+
+    TraceScope trace(TRACE_FIND_ALL, handle, -1);
+
+    if (handle == 0 || text == nullptr) {
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        JStringGuard guard(env, text);
+        if (!guard.valid()) {
+            return nullptr;
+        }
+
+        re2::StringPiece input(guard.get());
+        trace.setLength(static_cast<jlong>(input.size()));
+        return find_all_matches(env, re, input, trace);
+
+    } catch (const std::exception& e) {
+        set_error("Find all matches exception: ", e.what());
+        return nullptr;
+    }
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_getNamedGroups(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        const std::map<std::string, int>& namedGroups = re->NamedCapturingGroups();
+
+        if (namedGroups.empty()) {
+            return nullptr;
+        }
+
+        // Flatten to array: [name1, index1_as_string, name2, index2_as_string, ...]
+        jclass stringClass = env->FindClass("java/lang/String");
+        jobjectArray result = env->NewObjectArray(namedGroups.size() * 2, stringClass, nullptr);
+
+        int idx = 0;
+        for (const auto& entry : namedGroups) {
+            jstring name = env->NewStringUTF(entry.first.c_str());
+            jstring index = env->NewStringUTF(std::to_string(entry.second).c_str());
+
+            env->SetObjectArrayElement(result, idx++, name);
+            env->SetObjectArrayElement(result, idx++, index);
+
+            env->DeleteLocalRef(name);
+            env->DeleteLocalRef(index);
+        }
+
+        return result;
+
+    } catch (const std::exception& e) {
+        set_error("Get named groups exception: ", e.what());
+        return nullptr;
+    }
+}
+
+// ========== Replace Operations ==========
+
+JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceFirst(
+    JNIEnv *env, jclass cls, jlong handle, jstring text, jstring replacement) {
+
+    TraceScope trace(TRACE_REPLACE_FIRST, handle, -1);
+
+    if (handle == 0 || text == nullptr || replacement == nullptr) {
+        return text;  // Return original if invalid
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        JStringGuard textGuard(env, text);
+        JStringGuard replGuard(env, replacement);
+
+        if (!textGuard.valid() || !replGuard.valid()) {
+            return text;
+        }
+
+        std::string result(textGuard.get());
+        trace.setLength(static_cast<jlong>(result.size()));
+        trace.setResult(RE2::Replace(&result, *re, replGuard.get()) ? 1 : 0);
+
+        return env->NewStringUTF(result.c_str());
+
+    } catch (const std::exception& e) {
+        set_error("Replace first exception: ", e.what());
+        return text;
+    }
+}
+
+JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAll(
+    JNIEnv *env, jclass cls, jlong handle, jstring text, jstring replacement) {
+
+    TraceScope trace(TRACE_REPLACE_ALL, handle, -1);
+
+    if (handle == 0 || text == nullptr || replacement == nullptr) {
+        return text;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        JStringGuard textGuard(env, text);
+        JStringGuard replGuard(env, replacement);
+
+        if (!textGuard.valid() || !replGuard.valid()) {
+            return text;
+        }
+
+        std::string result(textGuard.get());
+        trace.setLength(static_cast<jlong>(result.size()));
+        trace.setResult(RE2::GlobalReplace(&result, *re, replGuard.get()));
+
+        return env->NewStringUTF(result.c_str());
+
+    } catch (const std::exception& e) {
+        set_error("Replace all exception: ", e.what());
+        return text;
+    }
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAllBulk(
+    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts, jstring replacement) {
+
+    TraceScope trace(TRACE_REPLACE_ALL_BULK, handle, -1);
+
+    if (handle == 0 || texts == nullptr || replacement == nullptr) {
+        return texts;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        JStringGuard replGuard(env, replacement);
+        if (!replGuard.valid()) {
+            return texts;
+        }
+
+        jsize length = env->GetArrayLength(texts);
+        trace.setLength(length);
+        jlong replaceCount = 0;
+        jclass stringClass = env->FindClass("java/lang/String");
+        jobjectArray result = env->NewObjectArray(length, stringClass, nullptr);
+
+        for (jsize i = 0; i < length; i++) {
+            jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
+            if (jstr == nullptr) {
+                continue;
+            }
+
+            JStringGuard textGuard(env, jstr);
+            if (textGuard.valid()) {
+                std::string replaced(textGuard.get());
+                replaceCount += RE2::GlobalReplace(&replaced, *re, replGuard.get());
+
+                jstring resultStr = env->NewStringUTF(replaced.c_str());
+                env->SetObjectArrayElement(result, i, resultStr);
+                env->DeleteLocalRef(resultStr);
+            } else {
+                env->SetObjectArrayElement(result, i, jstr);
+            }
+
+            env->DeleteLocalRef(jstr);
+        }
+
+        trace.setResult(replaceCount);
+        return result;
+
+    } catch (const std::exception& e) {
+        set_error("Replace all bulk exception: ", e.what());
+        return texts;
+    }
+}
+
+/**
+ * Replace first match using direct memory address (zero-copy).
+ * Uses StringPiece to wrap the raw pointer without copying for input.
+ * Note: Output must be copied to std::string since Replace modifies in place.
+ */
+JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceFirstDirect(
+    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength, jstring replacement) {
+
+    TraceScope trace(TRACE_REPLACE_FIRST_DIRECT, handle, textLength);
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return nullptr;
+    }
+
+    if (textAddress == 0) {
+        last_error = "Text address is null";
+        return nullptr;
+    }
+
+    if (textLength < 0) {
+        last_error = "Text length is negative";
+        return nullptr;
+    }
+
+    if (replacement == nullptr) {
+        last_error = "Replacement string is null";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        JStringGuard replGuard(env, replacement);
+
+        if (!replGuard.valid()) {
+            return nullptr;
+        }
+
+        // Zero-copy input: wrap the raw pointer in StringPiece
+        const char* text = reinterpret_cast<const char*>(textAddress);
+        re2::StringPiece input(text, static_cast<size_t>(textLength));
+
+        // Copy to std::string since Replace modifies in place
+        std::string result(input.data(), input.size());
+        trace.setResult(RE2::Replace(&result, *re, replGuard.get()) ? 1 : 0);
+
+        return env->NewStringUTF(result.c_str());
+
+    } catch (const std::exception& e) {
+        set_error("Direct replace first exception: ", e.what());
+        return nullptr;
+    }
+}
+
+/**
+ * Replace all matches using direct memory address (zero-copy).
+ * Uses StringPiece to wrap the raw pointer without copying for input.
+ * Note: Output must be copied to std::string since GlobalReplace modifies in place.
+ */
+JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAllDirect(
+    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength, jstring replacement) {
+
+    TraceScope trace(TRACE_REPLACE_ALL_DIRECT, handle, textLength);
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return nullptr;
+    }
+
+    if (textAddress == 0) {
+        last_error = "Text address is null";
+        return nullptr;
+    }
+
+    if (textLength < 0) {
+        last_error = "Text length is negative";
+        return nullptr;
+    }
+
+    if (replacement == nullptr) {
+        last_error = "Replacement string is null";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        JStringGuard replGuard(env, replacement);
+
+        if (!replGuard.valid()) {
+            return nullptr;
+        }
+
+        // Zero-copy input: wrap the raw pointer in StringPiece
+        const char* text = reinterpret_cast<const char*>(textAddress);
+        re2::StringPiece input(text, static_cast<size_t>(textLength));
+
+        // Copy to std::string since GlobalReplace modifies in place
+        std::string result(input.data(), input.size());
+        trace.setResult(RE2::GlobalReplace(&result, *re, replGuard.get()));
+
+        return env->NewStringUTF(result.c_str());
+
+    } catch (const std::exception& e) {
+        set_error("Direct replace all exception: ", e.what());
+        return nullptr;
+    }
+}
+
+/**
+ * Bulk replace all using direct memory addresses (zero-copy bulk).
+ * Processes multiple memory regions in a single JNI call.
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAllDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths, jstring replacement) {
+
+    TraceScope trace(TRACE_REPLACE_ALL_DIRECT_BULK, handle, -1);
+
+    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr || replacement == nullptr) {
+        last_error = "Invalid arguments for bulk direct replace";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
+
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same length";
+            return nullptr;
+        }
+
+        JStringGuard replGuard(env, replacement);
+        if (!replGuard.valid()) {
+            return nullptr;
+        }
+
+        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
+
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
+            return nullptr;
+        }
+
+        jclass stringClass = env->FindClass("java/lang/String");
+        jobjectArray results = env->NewObjectArray(addressCount, stringClass, nullptr);
+        jlong replaceCount = 0;
+
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
+                // Skip invalid entries
+                env->SetObjectArrayElement(results, i, nullptr);
+                continue;
+            }
+
+            // Zero-copy input: wrap raw pointer in StringPiece
+            const char* text = reinterpret_cast<const char*>(addresses[i]);
+            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
+
+            // Copy to std::string for modification
+            std::string result(input.data(), input.size());
+            replaceCount += RE2::GlobalReplace(&result, *re, replGuard.get());
+
+            jstring resultStr = env->NewStringUTF(result.c_str());
+            env->SetObjectArrayElement(results, i, resultStr);
+            env->DeleteLocalRef(resultStr);
+        }
+
+        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+
+        trace.setResult(replaceCount);
+        return results;
+
+    } catch (const std::exception& e) {
+        set_error("Direct bulk replace all exception: ", e.what());
+        return nullptr;
+    }
+}
+
+// ========== In-Place Masking ==========
+
+/** Longest mask byte pattern; copied to the stack so masking allocates nothing. */
+static constexpr jsize kMaxMaskBytes = 256;
+
+/**
+ * Overwrites every non-empty match in text with the mask bytes, repeated from the start of each
+ * match, and returns the number of matches masked. Matches are found as RE2::GlobalReplace finds
+ * them. Masking lags one match behind the search, so the byte before each search start (RE2's
+ * context for \b and (?m)^) is still the original text.
+ */
+static jint mask_matches(const RE2& re, char* text, size_t length, const char* mask,
+                         size_t maskLength) {
+    re2::StringPiece input(text, length);
+    re2::StringPiece match;
+    bool utf8 = re.options().encoding() == RE2::Options::EncodingUTF8;
+    size_t pos = 0;
+    size_t pendingStart = 0;
+    size_t pendingEnd = 0;
+    jint count = 0;
+
+    while (pos <= length && re.Match(input, pos, length, RE2::UNANCHORED, &match, 1)) {
+        size_t start = static_cast<size_t>(match.data() - text);
+        size_t end = start + match.size();
+        if (start == end) {
+            // Nothing to mask; step past the empty match one character at a time
+            pos = start + 1;
+            while (utf8 && pos < length && (static_cast<uint8_t>(text[pos]) & 0xC0) == 0x80) {
+                pos++;
+            }
+            continue;
+        }
+        for (size_t i = pendingStart; i < pendingEnd; i++) {
+            text[i] = mask[(i - pendingStart) % maskLength];
+        }
+        pendingStart = start;
+        pendingEnd = end;
+        pos = end;
+        count++;
+    }
+    for (size_t i = pendingStart; i < pendingEnd; i++) {
+        text[i] = mask[(i - pendingStart) % maskLength];
+    }
+    return count;
+}
+
+/** Copies the mask bytes to buffer; returns their count, or 0 with last_error set. */
+static jsize read_mask(JNIEnv* env, jbyteArray mask, jbyte* buffer) {
+    if (mask == nullptr) {
+        last_error = "Mask is null";
+        return 0;
+    }
+    jsize maskLength = env->GetArrayLength(mask);
+    if (maskLength <= 0 || maskLength > kMaxMaskBytes) {
+        last_error = "Mask length must be 1 to 256 bytes";
+        return 0;
+    }
+    env->GetByteArrayRegion(mask, 0, maskLength, buffer);
+    return maskLength;
+}
+
+/**
+ * Masks every match in direct memory in place (length-preserving redaction).
+ * Allocates nothing: the mask is copied to the stack and the text is written where it lies.
+ */
+JNIEXPORT jint JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_maskDirect(
+    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength, jbyteArray mask) {
+
+    TraceScope trace(TRACE_MASK_DIRECT, handle, textLength);
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return -1;
+    }
+
+    if (textAddress == 0 && textLength != 0) {
+        last_error = "Text address is null";
+        return -1;
+    }
+
+    if (textLength < 0) {
+        last_error = "Text length is negative";
+        return -1;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        jbyte maskBytes[kMaxMaskBytes];
+        jsize maskLength = read_mask(env, mask, maskBytes);
+        if (maskLength == 0) {
+            return -1;
+        }
+
+        char* text = reinterpret_cast<char*>(textAddress);
+        jint count = mask_matches(*re, text, static_cast<size_t>(textLength),
+                                  reinterpret_cast<const char*>(maskBytes),
+                                  static_cast<size_t>(maskLength));
+        trace.setResult(count);
+        return count;
+
+    } catch (const std::exception& e) {
+        set_error("Direct mask exception: ", e.what());
+        return -1;
+    }
+}
+
+/**
+ * Masks every match in many direct memory regions in place, e.g. the records packed into one
+ * network buffer. Addresses and lengths are staged in per-thread scratch, so steady-state calls
+ * allocate nothing.
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_maskDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths,
+    jbyteArray mask) {
+
+    TraceScope trace(TRACE_MASK_DIRECT_BULK, handle, -1);
+
+    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
+        last_error = "Invalid arguments for bulk direct mask";
+        return -1;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
+
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same length";
+            return -1;
+        }
+
+        jbyte maskBytes[kMaxMaskBytes];
+        jsize maskLength = read_mask(env, mask, maskBytes);
+        if (maskLength == 0) {
+            return -1;
+        }
+
+        std::vector<jlong>& addresses = scratch_longs(static_cast<size_t>(addressCount));
+        std::vector<jint>& lengths = scratch_ints(static_cast<size_t>(addressCount));
+        env->GetLongArrayRegion(textAddresses, 0, addressCount, addresses.data());
+        env->GetIntArrayRegion(textLengths, 0, addressCount, lengths.data());
+
+        jlong count = 0;
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
+                continue;
+            }
+            char* text = reinterpret_cast<char*>(addresses[i]);
+            count += mask_matches(*re, text, static_cast<size_t>(lengths[i]),
+                                  reinterpret_cast<const char*>(maskBytes),
+                                  static_cast<size_t>(maskLength));
+        }
+
+        trace.setResult(count);
+        return count;
+
+    } catch (const std::exception& e) {
+        set_error("Direct bulk mask exception: ", e.what());
+        return -1;
+    }
+}
+
+// ========== Utility Operations ==========
+
+JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_quoteMeta(
+    JNIEnv *env, jclass cls, jstring text) {
+
+    if (text == nullptr) {
+        return nullptr;
+    }
+
+    try {
+        JStringGuard guard(env, text);
+        if (!guard.valid()) {
+            return nullptr;
+        }
+
+        std::string escaped = RE2::QuoteMeta(guard.get());
+        return env->NewStringUTF(escaped.c_str());
+
+    } catch (const std::exception& e) {
+        set_error("Quote meta exception: ", e.what());
+        return nullptr;
+    }
+}
+
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_programFanout(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        std::vector<int> histogram;
+
+        // Get fanout histogram (RE2 fills the vector)
+        int numFanout = re->ProgramFanout(&histogram);
+        if (numFanout == 0 || histogram.empty()) {
+            return nullptr;
+        }
+
+        // Convert vector<int> to Java int array
+        jintArray result = env->NewIntArray(histogram.size());
+        if (result == nullptr) {
+            return nullptr;
+        }
+
+        // Copy data (cast to jint if needed)
+        std::vector<jint> jintData(histogram.begin(), histogram.end());
+        env->SetIntArrayRegion(result, 0, jintData.size(), jintData.data());
+        return result;
+
+    } catch (const std::exception& e) {
+        set_error("Program fanout exception: ", e.what());
+        return nullptr;
+    }
+}
+
+// ========== Pattern Analysis ==========
+
+// Layout of the array returned by explain() - keep in sync with PatternExplanation
+enum ExplainField {
+    kExplainProgramSize = 0,
+    kExplainReverseProgramSize,
+    kExplainCaptureGroups,
+    kExplainOnePass,            // 1/0, -1 unknown
+    kExplainBitStateMaxText,    // bytes, 0 if BitState unusable, -1 unknown
+    kExplainDfaStates,          // full DFA size, -2 exceeds budget, -1 unknown
+    kExplainAnchorStart,        // 1/0, -1 unknown
+    kExplainAnchorEnd,          // 1/0, -1 unknown
+    kExplainBytemapRange,       // -1 unknown
+    kExplainMaxMem,
+    kExplainFieldCount
+};
+
+/**
+ * Reports which RE2 execution engines a pattern can use.
+ *
+ * RE2 keeps its compiled Prog private, so the engine fields come from a
+ * private copy parsed and compiled the same way RE2::Init does (2/3 of
+ * max_mem). Building the entire DFA is bounded by that budget - diagnostic
+ * use only, not for hot paths.
+ */
+JNIEXPORT jlongArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_explain(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+
+        jlong info[kExplainFieldCount];
+        for (int i = 0; i < kExplainFieldCount; i++) {
+            info[i] = -1;
+        }
+        info[kExplainProgramSize] = re->ProgramSize();
+        info[kExplainReverseProgramSize] = re->ReverseProgramSize();
+        info[kExplainCaptureGroups] = re->NumberOfCapturingGroups();
+        info[kExplainMaxMem] = re->options().max_mem();
+
+#ifdef RE2_JNI_HAVE_RE2_INTERNALS
+        std::unique_ptr<re2::Prog> prog(compile_private_prog(*re, re->options().max_mem() * 2 / 3));
+        if (prog != nullptr) {
+            // Same order as RE2: one-pass analysis draws on the DFA budget first
+            info[kExplainOnePass] = prog->IsOnePass() ? 1 : 0;
+            info[kExplainBitStateMaxText] = prog->CanBitState()
+                ? static_cast<jlong>(prog->bit_state_text_max_size()) : 0;
+            info[kExplainAnchorStart] = prog->anchor_start() ? 1 : 0;
+            info[kExplainAnchorEnd] = prog->anchor_end() ? 1 : 0;
+            info[kExplainBytemapRange] = prog->bytemap_range();
+
+            bool out_of_memory = false;
+            int states = prog->BuildEntireDFA(
+                re2::Prog::kLongestMatch,
+                [&out_of_memory](const int* next, bool match) {
+                    if (next == nullptr) {
+                        out_of_memory = true;
+                    }
+                });
+            info[kExplainDfaStates] = out_of_memory ? -2 : states;
+        }
+#endif
+
+        jlongArray result = env->NewLongArray(kExplainFieldCount);
+        if (result == nullptr) {
+            return nullptr;
+        }
+        env->SetLongArrayRegion(result, 0, kExplainFieldCount, info);
+        return result;
+
+    } catch (const std::exception& e) {
+        set_error("Explain exception: ", e.what());
+        return nullptr;
+    }
+}
+
+/**
+ * Exports the materialized full-match DFA of a pattern for byte-at-a-time
+ * stepping on the Java side (trie / term dictionary intersection).
+ *
+ * @return int[] { stateCount, classes, bytemap[256], match flag per state,
+ *         next state per state and class (-1 dead) }, an empty array if the
+ *         pattern has no materialized DFA, or null on error
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_dfaTable(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        const MaterializedDfa* dfa = materialized_dfa(re, true);
+
+        std::vector<jint> packed;
+        if (dfa != nullptr) {
+            size_t states = dfa->match.size();
+            packed.reserve(2 + 256 + states + dfa->next.size());
+            packed.push_back(static_cast<jint>(states));
+            packed.push_back(dfa->classes);
+            packed.insert(packed.end(), std::begin(dfa->bytemap), std::end(dfa->bytemap));
+            packed.insert(packed.end(), dfa->match.begin(), dfa->match.end());
+            packed.insert(packed.end(), dfa->next.begin(), dfa->next.end());
+        }
+        return packed_int_array(env, packed);
+
+    } catch (const std::exception& e) {
+        set_error("DFA table exception: ", e.what());
+        return nullptr;
+    }
+}
+
+/**
+ * Exports a small DFA for full or partial matching, for the Java tier that
+ * matches short Strings without a JNI call. Unlike dfaTable the DFA is built
+ * with a budget sized for maxEntries transitions, so large patterns give up
+ * early instead of materializing megabytes; nothing is kept natively.
+ *
+ * @return int[] { stateCount, classes, anchorEnd, bytemap[256], match flag per
+ *         state, next state per state and class (-1 dead) }, an empty array if
+ *         the DFA is unavailable or has more than maxEntries transitions, or
+ *         null on error
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compactDfa(
+    JNIEnv *env, jclass cls, jlong handle, jboolean fullMatch, jint maxEntries) {
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return nullptr;
+    }
+    if (maxEntries <= 0) {
+        last_error = "Max entries must be positive";
+        return nullptr;
+    }
+
+    try {
+        std::vector<jint> packed;
+#ifdef RE2_JNI_HAVE_RE2_INTERNALS
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        // Room for the program plus RE2's own per-state overhead on top of
+        // the transitions themselves
+        int64_t budget = std::min<int64_t>(re->options().max_mem() * 2 / 3,
+                                           (int64_t{64} << 10) + int64_t{maxEntries} * 32);
+        std::unique_ptr<MaterializedDfa> dfa = materialize_dfa(*re, fullMatch, budget);
+
+        if (dfa != nullptr && dfa->next.size() <= static_cast<size_t>(maxEntries)) {
+            size_t states = dfa->match.size();
+            packed.reserve(3 + 256 + states + dfa->next.size());
+            packed.push_back(static_cast<jint>(states));
+            packed.push_back(dfa->classes);
+            packed.push_back(dfa->anchorEnd ? 1 : 0);
+            packed.insert(packed.end(), std::begin(dfa->bytemap), std::end(dfa->bytemap));
+            packed.insert(packed.end(), dfa->match.begin(), dfa->match.end());
+            packed.insert(packed.end(), dfa->next.begin(), dfa->next.end());
+        }
+#else
+        (void)fullMatch;
+#endif
+        return packed_int_array(env, packed);
+
+    } catch (const std::exception& e) {
+        set_error("Compact DFA exception: ", e.what());
+        return nullptr;
+    }
+}
+
+// ========== Frozen DFA Tables ==========
+
+/**
+ * Freezes a pattern's full- and partial-match DFAs into immutable tables
+ * (see FrozenDfa). Expensive: run off the matching path, once per pattern.
+ *
+ * @return frozen handle for the frozenMatch* calls and freeFrozenDfa, or 0 if
+ *         the DFA is unavailable or has more than maxStates states (the error
+ *         message is only set on failure)
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freezeDfa(
+    JNIEnv *env, jclass cls, jlong handle, jint maxStates) {
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return 0;
+    }
+    if (maxStates <= 0) {
+        last_error = "Max states must be positive";
+        return 0;
+    }
+
+    try {
+        last_error.clear();
+        std::unique_ptr<FrozenPattern> frozen =
+            freeze_pattern(*reinterpret_cast<RE2*>(handle), maxStates);
+        return reinterpret_cast<jlong>(frozen.release());
+    } catch (const std::exception& e) {
+        set_error("Freeze DFA exception: ", e.what());
+        return 0;
+    }
+}
+
+/**
+ * Freezes a pattern into a bit-parallel NFA (see BitParallelNfa): no DFA is
+ * built, so it suits patterns with few positions but large DFAs.
+ *
+ * @return frozen handle for the frozenMatch* calls and freeFrozenDfa, or 0 if
+ *         the pattern is not eligible (the error message is only set on failure)
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freezeBitParallel(
+    JNIEnv *env, jclass cls, jlong handle) {
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return 0;
+    }
+
+    try {
+        last_error.clear();
+        std::unique_ptr<FrozenPattern> frozen =
+            freeze_bit_parallel(*reinterpret_cast<RE2*>(handle));
+        return reinterpret_cast<jlong>(frozen.release());
+    } catch (const std::exception& e) {
+        set_error("Freeze bit-parallel exception: ", e.what());
+        return 0;
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freeFrozenDfa(
+    JNIEnv *env, jclass cls, jlong frozenHandle) {
+
+    delete reinterpret_cast<FrozenPattern*>(frozenHandle);
+}
+
+/**
+ * Match on a frozen pattern. handle is the owning RE2: the frozenMatch* ops
+ * report it to the tracepoints and as the executing pattern, like every other
+ * match op, while frozenHandle selects the tables.
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_frozenMatch(
+    JNIEnv *env, jclass cls, jlong handle, jlong frozenHandle, jstring text, jboolean fullMatch) {
+
+    TraceScope trace(TRACE_FROZEN_MATCH, handle, -1);
+
+    if (frozenHandle == 0 || text == nullptr) {
+        last_error = "Null pointer";
+        return JNI_FALSE;
+    }
+
+    JStringGuard guard(env, text);
+    if (!guard.valid()) {
+        last_error = "Failed to get text string";
+        return JNI_FALSE;
+    }
+
+    const FrozenPattern* frozen = reinterpret_cast<const FrozenPattern*>(frozenHandle);
+    size_t length = std::strlen(guard.get());
+    trace.setLength(static_cast<jlong>(length));
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(guard.get());
+    bool matched = frozen->matches(bytes, length, fullMatch);
+    trace.setResult(matched ? 1 : 0);
+    return matched ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_frozenMatchDirect(
+    JNIEnv *env, jclass cls, jlong handle, jlong frozenHandle, jlong textAddress, jint textLength,
+    jboolean fullMatch) {
+
+    TraceScope trace(TRACE_FROZEN_MATCH_DIRECT, handle, textLength);
+
+    if (frozenHandle == 0) {
+        last_error = "Frozen DFA handle is null";
+        return JNI_FALSE;
+    }
+    if (textAddress == 0) {
+        last_error = "Text address is null";
+        return JNI_FALSE;
+    }
+    if (textLength < 0) {
+        last_error = "Text length is negative";
+        return JNI_FALSE;
+    }
+
+    const FrozenPattern* frozen = reinterpret_cast<const FrozenPattern*>(frozenHandle);
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(textAddress);
+    size_t length = static_cast<size_t>(textLength);
+    bool matched = frozen->matches(bytes, length, fullMatch);
+    trace.setResult(matched ? 1 : 0);
+    return matched ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_frozenMatchBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlong frozenHandle, jobjectArray texts,
+    jboolean fullMatch) {
+
+    TraceScope trace(TRACE_FROZEN_MATCH_BULK, handle, -1);
+
+    if (frozenHandle == 0 || texts == nullptr) {
+        last_error = "Null pointer";
+        return nullptr;
+    }
+
+    try {
+        const FrozenPattern* frozen = reinterpret_cast<const FrozenPattern*>(frozenHandle);
+        jsize length = env->GetArrayLength(texts);
+        trace.setLength(length);
+
+        jbooleanArray results = env->NewBooleanArray(length);
         if (results == nullptr) {
             last_error = "Failed to allocate result array";
             return nullptr;
         }
 
-        // Process all strings in native code (single JNI crossing)
-        std::vector<jboolean> matches(length);
+        std::vector<jboolean>& matches = scratch_booleans(length);
+        jlong matchCount = 0;
         for (jsize i = 0; i < length; i++) {
             jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
+            matches[i] = JNI_FALSE;
             if (jstr == nullptr) {
-                matches[i] = JNI_FALSE;
                 continue;
             }
 
             JStringGuard guard(env, jstr);
             if (guard.valid()) {
-                matches[i] = RE2::FullMatch(guard.get(), *re) ? JNI_TRUE : JNI_FALSE;
-            } else {
-                matches[i] = JNI_FALSE;
+                const char* chars = guard.get();
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(chars);
+                bool matched = frozen->matches(bytes, std::strlen(chars), fullMatch);
+                matches[i] = matched ? JNI_TRUE : JNI_FALSE;
+                matchCount += matches[i];
             }
 
             env->DeleteLocalRef(jstr);
         }
 
-        // Write results back to Java
         env->SetBooleanArrayRegion(results, 0, length, matches.data());
+        trace.setResult(matchCount);
         return results;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Bulk match exception: ") + e.what();
+        set_error("Frozen bulk match exception: ", e.what());
         return nullptr;
     }
 }
 
-JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partialMatchBulk(
-    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts) {
+/**
+ * Bulk match of memory regions on a frozen DFA (zero-copy bulk).
+ *
+ * Unlike fullMatchDirectBulk/partialMatchDirectBulk there is no per-input
+ * RE2 search setup or DFA cache lock, so a region costs one table step per
+ * byte; consecutive short keys have independent state chains that the CPU
+ * overlaps on its own.
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_frozenMatchDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlong frozenHandle, jlongArray textAddresses,
+    jintArray textLengths, jboolean fullMatch) {
 
-    if (handle == 0 || texts == nullptr) {
+    TraceScope trace(TRACE_FROZEN_MATCH_DIRECT_BULK, handle, -1);
+
+    if (frozenHandle == 0 || textAddresses == nullptr || textLengths == nullptr) {
         last_error = "Null pointer";
         return nullptr;
     }
 
+    try {
+        const FrozenPattern* frozen = reinterpret_cast<const FrozenPattern*>(frozenHandle);
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
+
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same size";
+            return nullptr;
+        }
+
+        jbooleanArray results = env->NewBooleanArray(addressCount);
+        if (results == nullptr) {
+            last_error = "Failed to allocate result array";
+            return nullptr;
+        }
+
+        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
+
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
+            return nullptr;
+        }
+
+        std::vector<jboolean>& matches = scratch_booleans(addressCount);
+        jlong matchCount = 0;
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
+                matches[i] = JNI_FALSE;
+                continue;
+            }
+
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(addresses[i]);
+            bool matched = frozen->matches(bytes, static_cast<size_t>(lengths[i]), fullMatch);
+            matches[i] = matched ? JNI_TRUE : JNI_FALSE;
+            matchCount += matches[i];
+        }
+
+        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+        env->SetBooleanArrayRegion(results, 0, addressCount, matches.data());
+
+        trace.setResult(matchCount);
+        return results;
+
+    } catch (const std::exception& e) {
+        set_error("Frozen direct bulk match exception: ", e.what());
+        return nullptr;
+    }
+}
+
+// ========== Zero-Copy Direct Memory Operations ==========
+//
+// These methods accept raw memory addresses instead of Java Strings,
+// enabling true zero-copy regex matching with Chronicle Bytes or
+// other off-heap memory systems.
+//
+// The memory at the provided address is wrapped in RE2::StringPiece
+// which is a zero-copy string view - no data is copied.
+//
+// CRITICAL: The caller MUST ensure the memory remains valid for
+// the duration of the call.
+
+/**
+ * Full match using direct memory address (zero-copy).
+ * Uses StringPiece to wrap the raw pointer without copying.
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_fullMatchDirect(
+    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength) {
+
+    TraceScope trace(TRACE_FULL_MATCH_DIRECT, handle, textLength);
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return JNI_FALSE;
+    }
+
+    if (textAddress == 0) {
+        last_error = "Text address is null";
+        return JNI_FALSE;
+    }
+
+    if (textLength < 0) {
+        last_error = "Text length is negative";
+        return JNI_FALSE;
+    }
+
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        jsize length = env->GetArrayLength(texts);
 
-        jbooleanArray results = env->NewBooleanArray(length);
+        // Zero-copy: wrap the raw pointer in StringPiece
+        // StringPiece does NOT copy data - it's just a pointer + length
+        const char* text = reinterpret_cast<const char*>(textAddress);
+        re2::StringPiece input(text, static_cast<size_t>(textLength));
+
+        // Use RE2::FullMatch with StringPiece - no copies involved
+        bool matched = RE2::FullMatch(input, *re);
+        trace.setResult(matched ? 1 : 0);
+        return matched ? JNI_TRUE : JNI_FALSE;
+
+    } catch (const std::exception& e) {
+        set_error("Direct full match exception: ", e.what());
+        return JNI_FALSE;
+    }
+}
+
+/**
+ * Partial match using direct memory address (zero-copy).
+ * Uses StringPiece to wrap the raw pointer without copying.
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partialMatchDirect(
+    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength) {
+
+    TraceScope trace(TRACE_PARTIAL_MATCH_DIRECT, handle, textLength);
+
+    if (handle == 0) {
+        last_error = "Pattern handle is null";
+        return JNI_FALSE;
+    }
+
+    if (textAddress == 0) {
+        last_error = "Text address is null";
+        return JNI_FALSE;
+    }
+
+    if (textLength < 0) {
+        last_error = "Text length is negative";
+        return JNI_FALSE;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+
+        // Zero-copy: wrap the raw pointer in StringPiece
+        const char* text = reinterpret_cast<const char*>(textAddress);
+        re2::StringPiece input(text, static_cast<size_t>(textLength));
+
+        // Use RE2::PartialMatch with StringPiece - no copies involved
+        bool matched = RE2::PartialMatch(input, *re);
+        trace.setResult(matched ? 1 : 0);
+        return matched ? JNI_TRUE : JNI_FALSE;
+
+    } catch (const std::exception& e) {
+        set_error("Direct partial match exception: ", e.what());
+        return JNI_FALSE;
+    }
+}
+
+/**
+ * Bulk full match using direct memory addresses (zero-copy bulk).
+ * Processes multiple memory regions in a single JNI call.
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_fullMatchDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths) {
+
+    TraceScope trace(TRACE_FULL_MATCH_DIRECT_BULK, handle, -1);
+
+    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
+        last_error = "Null pointer";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
+
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same size";
+            return nullptr;
+        }
+
+        // Allocate result array
+        jbooleanArray results = env->NewBooleanArray(addressCount);
+        if (results == nullptr) {
+            last_error = "Failed to allocate result array";
+            return nullptr;
+        }
+
+        // Get array elements (this does copy the arrays, but not the text data)
+        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
+
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
+            return nullptr;
+        }
+
+        // Process all inputs with zero-copy text access
+        std::vector<jboolean>& matches = scratch_booleans(addressCount);
+        jlong matchCount = 0;
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
+                matches[i] = JNI_FALSE;
+                continue;
+            }
+
+            // Zero-copy: wrap each address in StringPiece
+            const char* text = reinterpret_cast<const char*>(addresses[i]);
+            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
+            matches[i] = RE2::FullMatch(input, *re) ? JNI_TRUE : JNI_FALSE;
+            matchCount += matches[i];
+        }
+
+        // Release arrays and write results
+        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+        env->SetBooleanArrayRegion(results, 0, addressCount, matches.data());
+
+        trace.setResult(matchCount);
+        return results;
+
+    } catch (const std::exception& e) {
+        set_error("Direct bulk full match exception: ", e.what());
+        return nullptr;
+    }
+}
+
+/**
+ * Bulk partial match using direct memory addresses (zero-copy bulk).
+ * Processes multiple memory regions in a single JNI call.
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partialMatchDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths) {
+
+    TraceScope trace(TRACE_PARTIAL_MATCH_DIRECT_BULK, handle, -1);
+
+    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
+        last_error = "Null pointer";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
+
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same size";
+            return nullptr;
+        }
+
+        // Allocate result array
+        jbooleanArray results = env->NewBooleanArray(addressCount);
         if (results == nullptr) {
             last_error = "Failed to allocate result array";
             return nullptr;
         }
 
-        std::vector<jboolean> matches(length);
-        for (jsize i = 0; i < length; i++) {
-            jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
-            if (jstr == nullptr) {
-                matches[i] = JNI_FALSE;
-                continue;
-            }
+        // Get array elements
+        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
 
-            JStringGuard guard(env, jstr);
-            if (guard.valid()) {
-                matches[i] = RE2::PartialMatch(guard.get(), *re) ? JNI_TRUE : JNI_FALSE;
-            } else {
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
+            return nullptr;
+        }
+
+        // Process all inputs with zero-copy text access
+        std::vector<jboolean>& matches = scratch_booleans(addressCount);
+        jlong matchCount = 0;
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
                 matches[i] = JNI_FALSE;
+                continue;
             }
 
-            env->DeleteLocalRef(jstr);
+            // Zero-copy: wrap each address in StringPiece
+            const char* text = reinterpret_cast<const char*>(addresses[i]);
+            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
+            matches[i] = RE2::PartialMatch(input, *re) ? JNI_TRUE : JNI_FALSE;
+            matchCount += matches[i];
         }
 
-        env->SetBooleanArrayRegion(results, 0, length, matches.data());
+        // Release arrays and write results
+        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+        env->SetBooleanArrayRegion(results, 0, addressCount, matches.data());
+
+        trace.setResult(matchCount);
         return results;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Bulk partial match exception: ") + e.what();
+        set_error("Direct bulk partial match exception: ", e.what());
         return nullptr;
     }
 }
 
-// ========== Capture Group Operations ==========
+/**
+ * Extract capture groups using direct memory address (zero-copy input).
+ * Output strings are necessarily new Java strings.
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractGroupsDirect(
+    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength) {
 
-JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractGroups(
-    JNIEnv *env, jclass cls, jlong handle, jstring text) {
+    TraceScope trace(TRACE_EXTRACT_GROUPS_DIRECT, handle, textLength);
 
-    if (handle == 0 || text == nullptr) {
+    if (handle == 0 || textAddress == 0) {
         return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        JStringGuard guard(env, text);
-        if (!guard.valid()) {
-            return nullptr;
-        }
+
+        // Zero-copy: wrap the raw pointer in StringPiece
+        const char* text = reinterpret_cast<const char*>(textAddress);
+        re2::StringPiece input(text, static_cast<size_t>(textLength));
 
         int numGroups = re->NumberOfCapturingGroups();
-        std::vector<re2::StringPiece> groups(numGroups + 1);  // +1 for full match
+        std::vector<re2::StringPiece>& groups = scratch_groups(numGroups + 1);  // +1 for full match
 
         // Match and extract groups
-        if (!re->Match(guard.get(), 0, strlen(guard.get()), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
+        if (!re->Match(input, 0, input.size(), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
+            trace.setResult(0);
             return nullptr;  // No match
         }
 
@@ -346,715 +4246,953 @@ JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractG
             return nullptr;
         }
 
-        // Fill array with groups
+        // Fill array with groups (output must be Java strings)
         for (int i = 0; i <= numGroups; i++) {
             if (groups[i].data() != nullptr) {
-                jstring jstr = env->NewStringUTF(std::string(groups[i].data(), groups[i].size()).c_str());
+                jstring jstr = new_string_utf(env, groups[i]);
                 env->SetObjectArrayElement(result, i, jstr);
                 env->DeleteLocalRef(jstr);
             }
         }
 
+        trace.setResult(1);
         return result;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Extract groups exception: ") + e.what();
+        set_error("Direct extract groups exception: ", e.what());
         return nullptr;
     }
 }
 
-JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractGroupsBulk(
-    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts) {
+/**
+ * Find all matches using direct memory address (zero-copy input).
+ * Output strings are necessarily new Java strings.
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_findAllMatchesDirect(
+    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength) {
 
-    if (handle == 0 || texts == nullptr) {
+    TraceScope trace(TRACE_FIND_ALL_DIRECT, handle, textLength);
+
+    if (handle == 0 || textAddress == 0) {
         return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        jsize length = env->GetArrayLength(texts);
-        int numGroups = re->NumberOfCapturingGroups();
 
-        // Create outer array (one element per input text)
-        jclass stringArrayClass = env->FindClass("[Ljava/lang/String;");
-        jobjectArray result = env->NewObjectArray(length, stringArrayClass, nullptr);
-        if (result == nullptr) {
+        // Zero-copy: wrap the raw pointer in StringPiece
+        const char* text = reinterpret_cast<const char*>(textAddress);
+        re2::StringPiece input(text, static_cast<size_t>(textLength));
+
+        return find_all_matches(env, re, input, trace);
+
+    } catch (const std::exception& e) {
+        set_error("Direct find all matches exception: ", e.what());
+        return nullptr;
+    }
+}
+
+// ========== Group-By Aggregation ==========
+//
+// Count rows by a captured key (and optionally sum/min/max an integer value
+// group) without creating a Java String per row. Only distinct keys cross
+// back into Java.
+
+/**
+ * Aggregate a batch of Java Strings by captured key.
+ *
+ * @param keyGroup group whose text is the key (0 = whole match)
+ * @param valueGroup group parsed as an integer for sum/min/max, or -1
+ * @return Object[] { String[] keys, long[] stats } (see aggregation_result), or null on error
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_aggregateBulk(
+    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts, jint keyGroup, jint valueGroup) {
+
+    TraceScope trace(TRACE_AGGREGATE_BULK, handle, -1);
+
+    if (handle == 0 || texts == nullptr) {
+        last_error = "Null pointer";
+        return nullptr;
+    }
+
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+        if (!valid_aggregation_groups(re, keyGroup, valueGroup)) {
             return nullptr;
         }
 
-        // Process each text
+        jsize length = env->GetArrayLength(texts);
+        trace.setLength(length);
+
+        GroupTable table;
+        std::vector<re2::StringPiece>& groups = scratch_groups(std::max(keyGroup, valueGroup) + 1);
+        jlong unmatched = 0;
+
         for (jsize i = 0; i < length; i++) {
             jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
             if (jstr == nullptr) {
+                unmatched++;
                 continue;
             }
 
             JStringGuard guard(env, jstr);
-            if (!guard.valid()) {
-                env->DeleteLocalRef(jstr);
-                continue;
-            }
-
-            std::vector<re2::StringPiece> groups(numGroups + 1);
-            if (re->Match(guard.get(), 0, strlen(guard.get()), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
-                // Create string array for this match's groups
-                jclass stringClass = env->FindClass("java/lang/String");
-                jobjectArray groupArray = env->NewObjectArray(numGroups + 1, stringClass, nullptr);
-
-                for (int j = 0; j <= numGroups; j++) {
-                    if (groups[j].data() != nullptr) {
-                        jstring groupStr = env->NewStringUTF(std::string(groups[j].data(), groups[j].size()).c_str());
-                        env->SetObjectArrayElement(groupArray, j, groupStr);
-                        env->DeleteLocalRef(groupStr);
-                    }
-                }
-
-                env->SetObjectArrayElement(result, i, groupArray);
-                env->DeleteLocalRef(groupArray);
+            if (!guard.valid() ||
+                !aggregate_row(re, re2::StringPiece(guard.get()), keyGroup, valueGroup, groups, table)) {
+                unmatched++;
             }
 
             env->DeleteLocalRef(jstr);
         }
 
-        return result;
+        trace.setResult(length - unmatched);
+        return aggregation_result(env, table, unmatched);
 
     } catch (const std::exception& e) {
-        last_error = std::string("Extract groups bulk exception: ") + e.what();
+        set_error("Aggregate bulk exception: ", e.what());
         return nullptr;
     }
 }
 
-JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_findAllMatches(
-    JNIEnv *env, jclass cls, jlong handle, jstring text) {
+/**
+ * Aggregate a batch of off-heap memory regions by captured key (zero-copy).
+ * Packed buffers are passed as one address per record by the Java side.
+ *
+ * @return Object[] { String[] keys, long[] stats } (see aggregation_result), or null on error
+ */
+JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_aggregateDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths,
+    jint keyGroup, jint valueGroup) {
 
-    if (handle == 0 || text == nullptr) {
+    TraceScope trace(TRACE_AGGREGATE_DIRECT_BULK, handle, -1);
+
+    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
+        last_error = "Null pointer";
         return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        JStringGuard guard(env, text);
-        if (!guard.valid()) {
+        if (!valid_aggregation_groups(re, keyGroup, valueGroup)) {
             return nullptr;
         }
 
-        int numGroups = re->NumberOfCapturingGroups();
-        std::vector<std::vector<std::string>> allMatches;
-
-        // Find all non-overlapping matches
-        re2::StringPiece input(guard.get());
-        std::vector<re2::StringPiece> groups(numGroups + 1);
-
-        while (re->Match(input, 0, input.size(), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
-            std::vector<std::string> matchGroups;
-            for (int i = 0; i <= numGroups; i++) {
-                if (groups[i].data() != nullptr) {
-                    matchGroups.push_back(std::string(groups[i].data(), groups[i].size()));
-                } else {
-                    matchGroups.push_back("");
-                }
-            }
-            allMatches.push_back(matchGroups);
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
 
-            // Advance past this match
-            if (groups[0].size() == 0) {
-                break;  // Avoid infinite loop on zero-length match
-            }
-            input.remove_prefix(groups[0].data() - input.data() + groups[0].size());
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same size";
+            return nullptr;
         }
 
-        if (allMatches.empty()) {
+        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
+
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
             return nullptr;
         }
 
-        // Create Java array of arrays
-        jclass stringArrayClass = env->FindClass("[Ljava/lang/String;");
-        jobjectArray result = env->NewObjectArray(allMatches.size(), stringArrayClass, nullptr);
-
-        for (size_t i = 0; i < allMatches.size(); i++) {
-            jclass stringClass = env->FindClass("java/lang/String");
-            jobjectArray groupArray = env->NewObjectArray(allMatches[i].size(), stringClass, nullptr);
+        GroupTable table;
+        std::vector<re2::StringPiece>& groups = scratch_groups(std::max(keyGroup, valueGroup) + 1);
+        jlong unmatched = 0;
 
-            for (size_t j = 0; j < allMatches[i].size(); j++) {
-                jstring jstr = env->NewStringUTF(allMatches[i][j].c_str());
-                env->SetObjectArrayElement(groupArray, j, jstr);
-                env->DeleteLocalRef(jstr);
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
+                unmatched++;
+                continue;
             }
 
-            env->SetObjectArrayElement(result, i, groupArray);
-            env->DeleteLocalRef(groupArray);
+            const char* text = reinterpret_cast<const char*>(addresses[i]);
+            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
+            if (!aggregate_row(re, input, keyGroup, valueGroup, groups, table)) {
+                unmatched++;
+            }
         }
 
-        return result;
+        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+
+        trace.setResult(addressCount - unmatched);
+        return aggregation_result(env, table, unmatched);
 
     } catch (const std::exception& e) {
-        last_error = std::string("Find all matches exception: ") + e.what();
+        set_error("Aggregate direct bulk exception: ", e.what());
         return nullptr;
     }
 }
 
-JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_getNamedGroups(
-    JNIEnv *env, jclass cls, jlong handle) {
+// ========== Split ==========
 
-    if (handle == 0) {
+/**
+ * Split a batch of Java Strings around matches of the pattern.
+ *
+ * Offsets are UTF-16 char indexes into each input. Null inputs have 0 fields.
+ *
+ * @param limit java.lang.String#split limit
+ * @return int[] { fieldCount per input, then start, end per field }, or null on error
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_splitBulk(
+    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts, jint limit) {
+
+    TraceScope trace(TRACE_SPLIT_BULK, handle, -1);
+
+    if (handle == 0 || texts == nullptr) {
+        last_error = "Null pointer";
         return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        const std::map<std::string, int>& namedGroups = re->NamedCapturingGroups();
-
-        if (namedGroups.empty()) {
-            return nullptr;
-        }
+        jsize length = env->GetArrayLength(texts);
+        trace.setLength(length);
 
-        // Flatten to array: [name1, index1_as_string, name2, index2_as_string, ...]
-        jclass stringClass = env->FindClass("java/lang/String");
-        jobjectArray result = env->NewObjectArray(namedGroups.size() * 2, stringClass, nullptr);
+        std::vector<jint>& packed = scratch_ints(static_cast<size_t>(length));
+        jlong totalFields = 0;
 
-        int idx = 0;
-        for (const auto& entry : namedGroups) {
-            jstring name = env->NewStringUTF(entry.first.c_str());
-            jstring index = env->NewStringUTF(std::to_string(entry.second).c_str());
+        for (jsize i = 0; i < length; i++) {
+            jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
+            if (jstr == nullptr) {
+                continue;
+            }
 
-            env->SetObjectArrayElement(result, idx++, name);
-            env->SetObjectArrayElement(result, idx++, index);
+            JStringGuard guard(env, jstr);
+            if (guard.valid()) {
+                re2::StringPiece text(guard.get());
+                size_t first = packed.size();
+                jint fields = split_fields(re, text, limit, packed);
+                utf8_offsets_to_utf16(text, packed.data() + first, packed.size() - first);
+                packed[i] = fields;
+                totalFields += fields;
+            }
 
-            env->DeleteLocalRef(name);
-            env->DeleteLocalRef(index);
+            env->DeleteLocalRef(jstr);
         }
 
-        return result;
+        trace.setResult(totalFields);
+        return packed_int_array(env, packed);
 
     } catch (const std::exception& e) {
-        last_error = std::string("Get named groups exception: ") + e.what();
+        set_error("Split bulk exception: ", e.what());
         return nullptr;
     }
 }
 
-// ========== Replace Operations ==========
+/**
+ * Split a batch of off-heap memory regions around matches of the pattern (zero-copy).
+ *
+ * Offsets are byte offsets relative to each region's address. Regions with a
+ * zero address have 0 fields.
+ *
+ * @return int[] { fieldCount per input, then start, end per field }, or null on error
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_splitDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths,
+    jint limit) {
 
-JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceFirst(
-    JNIEnv *env, jclass cls, jlong handle, jstring text, jstring replacement) {
+    TraceScope trace(TRACE_SPLIT_DIRECT_BULK, handle, -1);
 
-    if (handle == 0 || text == nullptr || replacement == nullptr) {
-        return text;  // Return original if invalid
+    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
+        last_error = "Null pointer";
+        return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        JStringGuard textGuard(env, text);
-        JStringGuard replGuard(env, replacement);
-
-        if (!textGuard.valid() || !replGuard.valid()) {
-            return text;
-        }
 
-        std::string result(textGuard.get());
-        RE2::Replace(&result, *re, replGuard.get());
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
 
-        return env->NewStringUTF(result.c_str());
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same size";
+            return nullptr;
+        }
 
-    } catch (const std::exception& e) {
-        last_error = std::string("Replace first exception: ") + e.what();
-        return text;
-    }
-}
+        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
 
-JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAll(
-    JNIEnv *env, jclass cls, jlong handle, jstring text, jstring replacement) {
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
+            return nullptr;
+        }
 
-    if (handle == 0 || text == nullptr || replacement == nullptr) {
-        return text;
-    }
+        std::vector<jint>& packed = scratch_ints(static_cast<size_t>(addressCount));
+        jlong totalFields = 0;
 
-    try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        JStringGuard textGuard(env, text);
-        JStringGuard replGuard(env, replacement);
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
+                continue;
+            }
 
-        if (!textGuard.valid() || !replGuard.valid()) {
-            return text;
+            const char* text = reinterpret_cast<const char*>(addresses[i]);
+            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
+            jint fields = split_fields(re, input, limit, packed);
+            packed[i] = fields;
+            totalFields += fields;
         }
 
-        std::string result(textGuard.get());
-        RE2::GlobalReplace(&result, *re, replGuard.get());
+        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
 
-        return env->NewStringUTF(result.c_str());
+        trace.setResult(totalFields);
+        return packed_int_array(env, packed);
 
     } catch (const std::exception& e) {
-        last_error = std::string("Replace all exception: ") + e.what();
-        return text;
+        set_error("Split direct bulk exception: ", e.what());
+        return nullptr;
     }
 }
 
-JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAllBulk(
-    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts, jstring replacement) {
+// ========== Bulk Match Offsets ==========
 
-    if (handle == 0 || texts == nullptr || replacement == nullptr) {
-        return texts;
+/**
+ * Extract capture group offsets for the first match in each off-heap memory region (zero-copy).
+ *
+ * @return int[] { matchCount (0 or 1) per input, then group offsets }, or null on error
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractGroupsDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths) {
+    return match_offsets_direct_bulk(env, TRACE_EXTRACT_GROUPS_DIRECT_BULK, handle,
+                                     textAddresses, textLengths, false);
+}
+
+/**
+ * Find all non-overlapping matches in each off-heap memory region (zero-copy).
+ *
+ * @return int[] { matchCount per input, then group offsets per match }, or null on error
+ */
+JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_findAllMatchesDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths) {
+    return match_offsets_direct_bulk(env, TRACE_FIND_ALL_DIRECT_BULK, handle,
+                                     textAddresses, textLengths, true);
+}
+
+// ========== Sorted Batch Matching ==========
+
+/**
+ * Full or partial match of keys walked in order, resuming each from the DFA
+ * state at the prefix shared with the previous key.
+ */
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchSortedBulk(
+    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts, jboolean fullMatch) {
+
+    TraceScope trace(TRACE_MATCH_SORTED_BULK, handle, -1);
+
+    if (handle == 0 || texts == nullptr) {
+        last_error = "Null pointer";
+        return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        JStringGuard replGuard(env, replacement);
-        if (!replGuard.valid()) {
-            return texts;
-        }
-
         jsize length = env->GetArrayLength(texts);
-        jclass stringClass = env->FindClass("java/lang/String");
-        jobjectArray result = env->NewObjectArray(length, stringClass, nullptr);
+        trace.setLength(length);
+
+        jbooleanArray results = env->NewBooleanArray(length);
+        if (results == nullptr) {
+            last_error = "Failed to allocate result array";
+            return nullptr;
+        }
 
+        SortedBatchMatcher matcher(re, fullMatch == JNI_TRUE);
+        std::vector<jboolean>& matches = scratch_booleans(length);
+        jlong matchCount = 0;
         for (jsize i = 0; i < length; i++) {
             jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
             if (jstr == nullptr) {
+                matches[i] = JNI_FALSE;
                 continue;
             }
 
-            JStringGuard textGuard(env, jstr);
-            if (textGuard.valid()) {
-                std::string replaced(textGuard.get());
-                RE2::GlobalReplace(&replaced, *re, replGuard.get());
-
-                jstring resultStr = env->NewStringUTF(replaced.c_str());
-                env->SetObjectArrayElement(result, i, resultStr);
-                env->DeleteLocalRef(resultStr);
+            JStringGuard guard(env, jstr);
+            if (guard.valid()) {
+                const char* key = guard.get();
+                matches[i] = matcher.match(key, std::strlen(key)) ? JNI_TRUE : JNI_FALSE;
+                matchCount += matches[i];
             } else {
-                env->SetObjectArrayElement(result, i, jstr);
+                matches[i] = JNI_FALSE;
             }
 
             env->DeleteLocalRef(jstr);
         }
 
-        return result;
+        env->SetBooleanArrayRegion(results, 0, length, matches.data());
+        trace.setResult(matchCount);
+        return results;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Replace all bulk exception: ") + e.what();
-        return texts;
+        set_error("Sorted bulk match exception: ", e.what());
+        return nullptr;
     }
 }
 
 /**
- * Replace first match using direct memory address (zero-copy).
- * Uses StringPiece to wrap the raw pointer without copying for input.
- * Note: Output must be copied to std::string since Replace modifies in place.
+ * Full or partial match of off-heap keys walked in order (zero-copy), resuming
+ * each from the DFA state at the prefix shared with the previous key.
  */
-JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceFirstDirect(
-    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength, jstring replacement) {
-
-    if (handle == 0) {
-        last_error = "Pattern handle is null";
-        return nullptr;
-    }
-
-    if (textAddress == 0) {
-        last_error = "Text address is null";
-        return nullptr;
-    }
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchSortedDirectBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths,
+    jboolean fullMatch) {
 
-    if (textLength < 0) {
-        last_error = "Text length is negative";
-        return nullptr;
-    }
+    TraceScope trace(TRACE_MATCH_SORTED_DIRECT_BULK, handle, -1);
 
-    if (replacement == nullptr) {
-        last_error = "Replacement string is null";
+    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
+        last_error = "Null pointer";
         return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        JStringGuard replGuard(env, replacement);
+        jsize addressCount = env->GetArrayLength(textAddresses);
+        jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
 
-        if (!replGuard.valid()) {
+        if (addressCount != lengthCount) {
+            last_error = "Address and length arrays must have same size";
             return nullptr;
         }
 
-        // Zero-copy input: wrap the raw pointer in StringPiece
-        const char* text = reinterpret_cast<const char*>(textAddress);
-        re2::StringPiece input(text, static_cast<size_t>(textLength));
+        jbooleanArray results = env->NewBooleanArray(addressCount);
+        if (results == nullptr) {
+            last_error = "Failed to allocate result array";
+            return nullptr;
+        }
 
-        // Copy to std::string since Replace modifies in place
-        std::string result(input.data(), input.size());
-        RE2::Replace(&result, *re, replGuard.get());
+        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
 
-        return env->NewStringUTF(result.c_str());
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
+            return nullptr;
+        }
+
+        SortedBatchMatcher matcher(re, fullMatch == JNI_TRUE);
+        std::vector<jboolean>& matches = scratch_booleans(addressCount);
+        jlong matchCount = 0;
+        for (jsize i = 0; i < addressCount; i++) {
+            if (addresses[i] == 0 || lengths[i] < 0) {
+                matches[i] = JNI_FALSE;
+                continue;
+            }
+
+            const char* key = reinterpret_cast<const char*>(addresses[i]);
+            matches[i] = matcher.match(key, static_cast<size_t>(lengths[i])) ? JNI_TRUE : JNI_FALSE;
+            matchCount += matches[i];
+        }
+
+        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+        env->SetBooleanArrayRegion(results, 0, addressCount, matches.data());
+
+        trace.setResult(matchCount);
+        return results;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Direct replace first exception: ") + e.what();
+        set_error("Sorted direct bulk match exception: ", e.what());
         return nullptr;
     }
 }
 
+// ========== Result Arena ==========
+
+// Layout of the per-thread result arena - keep in sync with MatchView
+enum ArenaHeader {
+    kArenaMatchCount = 0,
+    kArenaGroupsPerMatch,
+    kArenaRequiredInts,
+    kArenaHeaderInts
+};
+
 /**
- * Replace all matches using direct memory address (zero-copy).
- * Uses StringPiece to wrap the raw pointer without copying for input.
- * Note: Output must be copied to std::string since GlobalReplace modifies in place.
+ * Writes group offsets for the first match (all == false) or every match of a
+ * pattern in off-heap text into a caller-owned off-heap arena. No Java objects
+ * are created, so extraction loops reusing one arena allocate nothing per call.
+ *
+ * Arena: { matchCount, groupsPerMatch, requiredInts, then start/end byte offset
+ * pairs per group per match (-1 for groups that did not participate) }.
+ *
+ * @return 0 if the results fit, 1 if the arena is too small (the header still
+ *         holds the required size), -1 on error
  */
-JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAllDirect(
-    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength, jstring replacement) {
+JNIEXPORT jint JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchToArena(
+    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength,
+    jlong arenaAddress, jint arenaInts, jboolean all) {
 
-    if (handle == 0) {
-        last_error = "Pattern handle is null";
-        return nullptr;
+    TraceScope trace(all == JNI_TRUE ? TRACE_FIND_ALL_ARENA : TRACE_EXTRACT_GROUPS_ARENA,
+                     handle, textLength);
+
+    if (handle == 0 || textAddress == 0 || arenaAddress == 0) {
+        last_error = "Null pointer";
+        return -1;
+    }
+    if (textLength < 0 || arenaInts < kArenaHeaderInts) {
+        last_error = "Invalid text length or arena size";
+        return -1;
     }
 
-    if (textAddress == 0) {
-        last_error = "Text address is null";
-        return nullptr;
+    try {
+        RE2* re = reinterpret_cast<RE2*>(handle);
+
+        std::vector<re2::StringPiece>& groups =
+            scratch_groups(static_cast<size_t>(re->NumberOfCapturingGroups()) + 1);
+        std::vector<jint>& offsets = scratch_ints(0);
+
+        re2::StringPiece text(reinterpret_cast<const char*>(textAddress),
+                              static_cast<size_t>(textLength));
+        jint matches = append_match_offsets(re, text, all == JNI_TRUE, groups, offsets);
+        trace.setResult(matches);
+
+        size_t required = kArenaHeaderInts + offsets.size();
+        jint* arena = reinterpret_cast<jint*>(arenaAddress);
+        arena[kArenaMatchCount] = matches;
+        arena[kArenaGroupsPerMatch] = static_cast<jint>(groups.size());
+        arena[kArenaRequiredInts] = static_cast<jint>(
+            std::min(required, static_cast<size_t>(std::numeric_limits<jint>::max())));
+
+        jint status = 1;
+        if (required <= static_cast<size_t>(arenaInts)) {
+            std::memcpy(arena + kArenaHeaderInts, offsets.data(), offsets.size() * sizeof(jint));
+            status = 0;
+        }
+        return status;
+
+    } catch (const std::exception& e) {
+        set_error("Arena match exception: ", e.what());
+        return -1;
     }
+}
 
-    if (textLength < 0) {
-        last_error = "Text length is negative";
-        return nullptr;
+// ========== Scatter-Gather Matching ==========
+
+/**
+ * Full or partial match over segments that form one logical input. With a
+ * materialized DFA the automaton steps straight across segment boundaries, so
+ * fragmented input is matched in place; otherwise the segments are gathered
+ * into per-thread scratch and matched with RE2.
+ */
+static bool match_segments(const RE2* re, const jlong* addresses, const jint* lengths,
+                           jsize count, bool fullMatch) {
+    // Empty segments carry no bytes and may have address 0
+    jsize nonEmpty = 0;
+    jsize last = -1;
+    size_t total = 0;
+    for (jsize i = 0; i < count; i++) {
+        if (lengths[i] > 0) {
+            nonEmpty++;
+            last = i;
+            total += static_cast<size_t>(lengths[i]);
+        }
     }
 
-    if (replacement == nullptr) {
-        last_error = "Replacement string is null";
-        return nullptr;
+    const MaterializedDfa* dfa = nonEmpty > 1 ? materialized_dfa(re, fullMatch) : nullptr;
+    if (dfa != nullptr) {
+        // A partial match seen mid-input is final unless the pattern ends with $
+        bool latchMatches = !fullMatch && !dfa->anchorEnd;
+        int32_t state = 0;
+        for (jsize i = 0; i < count; i++) {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(addresses[i]);
+            for (jint j = 0; j < lengths[i]; j++) {
+                state = dfa->step(state, bytes[j]);
+                if (state < 0) {
+                    return false;
+                }
+                if (latchMatches && dfa->isMatch(state)) {
+                    return true;
+                }
+            }
+        }
+        return dfa->matchesAtEnd(state);
+    }
+
+    re2::StringPiece text("");
+    if (nonEmpty == 1) {
+        text = re2::StringPiece(reinterpret_cast<const char*>(addresses[last]), total);
+    } else if (nonEmpty > 1) {
+        std::vector<char>& gathered = scratch_bytes(total);
+        size_t pos = 0;
+        for (jsize i = 0; i < count; i++) {
+            if (lengths[i] > 0) {
+                std::memcpy(gathered.data() + pos, reinterpret_cast<const char*>(addresses[i]),
+                            static_cast<size_t>(lengths[i]));
+                pos += static_cast<size_t>(lengths[i]);
+            }
+        }
+        text = re2::StringPiece(gathered.data(), total);
+    }
+    return fullMatch ? RE2::FullMatch(text, *re) : RE2::PartialMatch(text, *re);
+}
+
+/**
+ * Matches the concatenation of (address, length) segments as one input
+ * without the caller copying them together. Zero-length segments may have
+ * address 0.
+ *
+ * @return match result; false with last_error set on error
+ */
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchSegments(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray segmentAddresses,
+    jintArray segmentLengths, jboolean fullMatch) {
+
+    TraceScope trace(TRACE_MATCH_SEGMENTS, handle, -1);
+
+    if (handle == 0 || segmentAddresses == nullptr || segmentLengths == nullptr) {
+        last_error = "Null pointer";
+        return JNI_FALSE;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
-        JStringGuard replGuard(env, replacement);
 
-        if (!replGuard.valid()) {
-            return nullptr;
+        jsize count = env->GetArrayLength(segmentAddresses);
+        if (count != env->GetArrayLength(segmentLengths)) {
+            last_error = "Address and length arrays must have same size";
+            return JNI_FALSE;
         }
 
-        // Zero-copy input: wrap the raw pointer in StringPiece
-        const char* text = reinterpret_cast<const char*>(textAddress);
-        re2::StringPiece input(text, static_cast<size_t>(textLength));
+        jlong* addresses = env->GetLongArrayElements(segmentAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(segmentLengths, nullptr);
 
-        // Copy to std::string since GlobalReplace modifies in place
-        std::string result(input.data(), input.size());
-        RE2::GlobalReplace(&result, *re, replGuard.get());
+        if (addresses == nullptr || lengths == nullptr) {
+            if (addresses != nullptr) env->ReleaseLongArrayElements(segmentAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(segmentLengths, lengths, JNI_ABORT);
+            last_error = "Failed to get array elements";
+            return JNI_FALSE;
+        }
 
-        return env->NewStringUTF(result.c_str());
+        jlong total = 0;
+        bool valid = true;
+        for (jsize i = 0; i < count; i++) {
+            if (lengths[i] < 0 || (addresses[i] == 0 && lengths[i] > 0)) {
+                valid = false;
+                break;
+            }
+            total += lengths[i];
+        }
+        trace.setLength(total);
+
+        bool matched = false;
+        if (valid) {
+            matched = match_segments(re, addresses, lengths, count, fullMatch == JNI_TRUE);
+        } else {
+            last_error = "Segment address is null or length is negative";
+        }
+
+        env->ReleaseLongArrayElements(segmentAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(segmentLengths, lengths, JNI_ABORT);
+
+        trace.setResult(valid ? (matched ? 1 : 0) : -1);
+        return matched ? JNI_TRUE : JNI_FALSE;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Direct replace all exception: ") + e.what();
-        return nullptr;
+        set_error("Segment match exception: ", e.what());
+        return JNI_FALSE;
     }
 }
 
+// ========== Field-Aware Record Matching ==========
+
 /**
- * Bulk replace all using direct memory addresses (zero-copy bulk).
- * Processes multiple memory regions in a single JNI call.
+ * Matches one field of each raw JSON or CSV record (zero-copy), locating the
+ * field with the structural scanner instead of parsing records into objects.
+ *
+ * Selector: JSON - the object key path, keys separated by NUL bytes; CSV - a
+ * single delimiter byte, with column selecting the field.
+ *
+ * @return bitmap with bit i (word i / 64, bit i % 64) set if record i has the
+ *         field and it matches; null on error
  */
-JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_replaceAllDirectBulk(
-    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths, jstring replacement) {
+JNIEXPORT jlongArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_matchFieldBulk(
+    JNIEnv *env, jclass cls, jlong handle, jlongArray recordAddresses, jintArray recordLengths,
+    jint format, jbyteArray selector, jint column, jboolean fullMatch) {
 
-    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr || replacement == nullptr) {
-        last_error = "Invalid arguments for bulk direct replace";
+    TraceScope trace(TRACE_MATCH_FIELD_BULK, handle, -1);
+
+    if (handle == 0 || recordAddresses == nullptr || recordLengths == nullptr ||
+        selector == nullptr) {
+        last_error = "Null pointer";
         return nullptr;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
+        jsize count = env->GetArrayLength(recordAddresses);
+        trace.setLength(count);
 
-        jsize addressCount = env->GetArrayLength(textAddresses);
-        jsize lengthCount = env->GetArrayLength(textLengths);
+        if (count != env->GetArrayLength(recordLengths)) {
+            last_error = "Address and length arrays must have same size";
+            return nullptr;
+        }
 
-        if (addressCount != lengthCount) {
-            last_error = "Address and length arrays must have same length";
+        jsize selectorLength = env->GetArrayLength(selector);
+        bool validSelector = format == kRecordJson
+            ? selectorLength > 0
+            : format == kRecordCsv && selectorLength == 1 && column >= 0;
+        if (!validSelector) {
+            last_error = "Invalid record field selector";
             return nullptr;
         }
 
-        JStringGuard replGuard(env, replacement);
-        if (!replGuard.valid()) {
+        std::vector<char>& selectorBytes = scratch_bytes(static_cast<size_t>(selectorLength));
+        env->GetByteArrayRegion(selector, 0, selectorLength,
+                                reinterpret_cast<jbyte*>(selectorBytes.data()));
+
+        // JSON path keys point into selectorBytes
+        std::vector<re2::StringPiece>& path = scratch_groups(0);
+        if (format == kRecordJson) {
+            size_t keyStart = 0;
+            for (size_t i = 0; i <= selectorBytes.size(); i++) {
+                if (i == selectorBytes.size() || selectorBytes[i] == '\0') {
+                    scratch_push(path, re2::StringPiece(selectorBytes.data() + keyStart,
+                                                        i - keyStart));
+                    keyStart = i + 1;
+                }
+            }
+        }
+
+        jsize words = (count + 63) / 64;
+        jlongArray results = env->NewLongArray(words);
+        if (results == nullptr) {
+            last_error = "Failed to allocate result array";
             return nullptr;
         }
 
-        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
-        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
+        jlong* addresses = env->GetLongArrayElements(recordAddresses, nullptr);
+        jint* lengths = env->GetIntArrayElements(recordLengths, nullptr);
 
         if (addresses == nullptr || lengths == nullptr) {
-            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
-            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+            if (addresses != nullptr) env->ReleaseLongArrayElements(recordAddresses, addresses, JNI_ABORT);
+            if (lengths != nullptr) env->ReleaseIntArrayElements(recordLengths, lengths, JNI_ABORT);
             last_error = "Failed to get array elements";
             return nullptr;
         }
 
-        jclass stringClass = env->FindClass("java/lang/String");
-        jobjectArray results = env->NewObjectArray(addressCount, stringClass, nullptr);
-
-        for (jsize i = 0; i < addressCount; i++) {
+        RecordFieldMatcher matcher(re, fullMatch == JNI_TRUE, format, path, selectorBytes[0],
+                                   column);
+        std::vector<jlong>& bitmap = scratch_longs(static_cast<size_t>(words));
+        jlong matchCount = 0;
+        for (jsize i = 0; i < count; i++) {
             if (addresses[i] == 0 || lengths[i] < 0) {
-                // Skip invalid entries
-                env->SetObjectArrayElement(results, i, nullptr);
                 continue;
-            }
-
-            // Zero-copy input: wrap raw pointer in StringPiece
-            const char* text = reinterpret_cast<const char*>(addresses[i]);
-            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
-
-            // Copy to std::string for modification
-            std::string result(input.data(), input.size());
-            RE2::GlobalReplace(&result, *re, replGuard.get());
-
-            jstring resultStr = env->NewStringUTF(result.c_str());
-            env->SetObjectArrayElement(results, i, resultStr);
-            env->DeleteLocalRef(resultStr);
+            }
+
+            const char* record = reinterpret_cast<const char*>(addresses[i]);
+            if (matcher.match(record, static_cast<size_t>(lengths[i]))) {
+                bitmap[i / 64] |= static_cast<jlong>(uint64_t{1} << (i % 64));
+                matchCount++;
+            }
         }
 
-        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
-        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
+        env->ReleaseLongArrayElements(recordAddresses, addresses, JNI_ABORT);
+        env->ReleaseIntArrayElements(recordLengths, lengths, JNI_ABORT);
+        env->SetLongArrayRegion(results, 0, words, bitmap.data());
 
+        trace.setResult(matchCount);
         return results;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Direct bulk replace all exception: ") + e.what();
+        set_error("Field match exception: ", e.what());
         return nullptr;
     }
 }
 
-// ========== Utility Operations ==========
+// ========== Pattern Expressions ==========
 
-JNIEXPORT jstring JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_quoteMeta(
-    JNIEnv *env, jclass cls, jstring text) {
+/**
+ * Compiles a boolean expression over patterns, literals and length predicates.
+ * The patterns must stay alive until freeExpression (the Java side holds a
+ * reference on each).
+ *
+ * @return expression handle, or 0 with last_error set on error
+ */
+JNIEXPORT jlong JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_compileExpression(
+    JNIEnv *env, jclass cls, jintArray program, jlongArray patternHandles, jbyteArray literals) {
 
-    if (text == nullptr) {
-        return nullptr;
+    if (program == nullptr || patternHandles == nullptr || literals == nullptr) {
+        last_error = "Null pointer";
+        return 0;
     }
 
     try {
-        JStringGuard guard(env, text);
-        if (!guard.valid()) {
-            return nullptr;
+        jsize programInts = env->GetArrayLength(program);
+        jsize handleCount = env->GetArrayLength(patternHandles);
+        jsize literalBytes = env->GetArrayLength(literals);
+
+        std::vector<jint> ops(static_cast<size_t>(programInts));
+        std::vector<jlong> handles(static_cast<size_t>(handleCount));
+        std::string text(static_cast<size_t>(literalBytes), '\0');
+        env->GetIntArrayRegion(program, 0, programInts, ops.data());
+        env->GetLongArrayRegion(patternHandles, 0, handleCount, handles.data());
+        env->GetByteArrayRegion(literals, 0, literalBytes, reinterpret_cast<jbyte*>(&text[0]));
+
+        std::string error;
+        std::unique_ptr<ExpressionProgram> expression = ExpressionProgram::build(
+            ops.data(), ops.size(), handles.data(), handles.size(), text.data(), text.size(),
+            &error);
+        if (expression == nullptr) {
+            last_error = error;
+            return 0;
         }
-
-        std::string escaped = RE2::QuoteMeta(guard.get());
-        return env->NewStringUTF(escaped.c_str());
+        return reinterpret_cast<jlong>(expression.release());
 
     } catch (const std::exception& e) {
-        last_error = std::string("Quote meta exception: ") + e.what();
-        return nullptr;
+        set_error("Expression compile exception: ", e.what());
+        return 0;
     }
 }
 
-JNIEXPORT jintArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_programFanout(
+JNIEXPORT void JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_freeExpression(
     JNIEnv *env, jclass cls, jlong handle) {
 
-    if (handle == 0) {
-        return nullptr;
-    }
-
-    try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        std::vector<int> histogram;
-
-        // Get fanout histogram (RE2 fills the vector)
-        int numFanout = re->ProgramFanout(&histogram);
-        if (numFanout == 0 || histogram.empty()) {
-            return nullptr;
-        }
-
-        // Convert vector<int> to Java int array
-        jintArray result = env->NewIntArray(histogram.size());
-        if (result == nullptr) {
-            return nullptr;
-        }
-
-        // Copy data (cast to jint if needed)
-        std::vector<jint> jintData(histogram.begin(), histogram.end());
-        env->SetIntArrayRegion(result, 0, jintData.size(), jintData.data());
-        return result;
-
-    } catch (const std::exception& e) {
-        last_error = std::string("Program fanout exception: ") + e.what();
-        return nullptr;
+    if (handle != 0) {
+        delete reinterpret_cast<ExpressionProgram*>(handle);
     }
 }
 
-// ========== Zero-Copy Direct Memory Operations ==========
-//
-// These methods accept raw memory addresses instead of Java Strings,
-// enabling true zero-copy regex matching with Chronicle Bytes or
-// other off-heap memory systems.
-//
-// The memory at the provided address is wrapped in RE2::StringPiece
-// which is a zero-copy string view - no data is copied.
-//
-// CRITICAL: The caller MUST ensure the memory remains valid for
-// the duration of the call.
-
-/**
- * Full match using direct memory address (zero-copy).
- * Uses StringPiece to wrap the raw pointer without copying.
- */
-JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_fullMatchDirect(
-    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength) {
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_evaluateExpression(
+    JNIEnv *env, jclass cls, jlong handle, jstring text) {
 
-    if (handle == 0) {
-        last_error = "Pattern handle is null";
-        return JNI_FALSE;
-    }
+    // handle is an ExpressionProgram: eval_node attributes DFA failures per operand
+    TraceScope trace(TRACE_EVALUATE_EXPRESSION, handle, nullptr, -1);
 
-    if (textAddress == 0) {
-        last_error = "Text address is null";
+    if (handle == 0 || text == nullptr) {
+        last_error = "Null pointer";
         return JNI_FALSE;
     }
 
-    if (textLength < 0) {
-        last_error = "Text length is negative";
+    JStringGuard guard(env, text);
+    if (!guard.valid()) {
+        last_error = "Failed to get text string";
         return JNI_FALSE;
     }
 
     try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-
-        // Zero-copy: wrap the raw pointer in StringPiece
-        // StringPiece does NOT copy data - it's just a pointer + length
-        const char* text = reinterpret_cast<const char*>(textAddress);
-        re2::StringPiece input(text, static_cast<size_t>(textLength));
-
-        // Use RE2::FullMatch with StringPiece - no copies involved
-        return RE2::FullMatch(input, *re) ? JNI_TRUE : JNI_FALSE;
+        ExpressionProgram* expression = reinterpret_cast<ExpressionProgram*>(handle);
+        re2::StringPiece input(guard.get());
+        trace.setLength(static_cast<jlong>(input.size()));
 
+        bool matched = expression->evaluate(input);
+        trace.setResult(matched ? 1 : 0);
+        return matched ? JNI_TRUE : JNI_FALSE;
     } catch (const std::exception& e) {
-        last_error = std::string("Direct full match exception: ") + e.what();
+        set_error("Expression exception: ", e.what());
         return JNI_FALSE;
     }
 }
 
-/**
- * Partial match using direct memory address (zero-copy).
- * Uses StringPiece to wrap the raw pointer without copying.
- */
-JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partialMatchDirect(
+JNIEXPORT jboolean JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_evaluateExpressionDirect(
     JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength) {
 
-    if (handle == 0) {
-        last_error = "Pattern handle is null";
-        return JNI_FALSE;
-    }
+    TraceScope trace(TRACE_EVALUATE_EXPRESSION_DIRECT, handle, nullptr, textLength);
 
-    if (textAddress == 0) {
-        last_error = "Text address is null";
+    if (handle == 0 || textAddress == 0) {
+        last_error = "Null pointer";
         return JNI_FALSE;
     }
-
     if (textLength < 0) {
         last_error = "Text length is negative";
         return JNI_FALSE;
     }
 
     try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-
-        // Zero-copy: wrap the raw pointer in StringPiece
-        const char* text = reinterpret_cast<const char*>(textAddress);
-        re2::StringPiece input(text, static_cast<size_t>(textLength));
-
-        // Use RE2::PartialMatch with StringPiece - no copies involved
-        return RE2::PartialMatch(input, *re) ? JNI_TRUE : JNI_FALSE;
+        ExpressionProgram* expression = reinterpret_cast<ExpressionProgram*>(handle);
+        re2::StringPiece input(reinterpret_cast<const char*>(textAddress),
+                               static_cast<size_t>(textLength));
 
+        bool matched = expression->evaluate(input);
+        trace.setResult(matched ? 1 : 0);
+        return matched ? JNI_TRUE : JNI_FALSE;
     } catch (const std::exception& e) {
-        last_error = std::string("Direct partial match exception: ") + e.what();
+        set_error("Expression exception: ", e.what());
         return JNI_FALSE;
     }
 }
 
-/**
- * Bulk full match using direct memory addresses (zero-copy bulk).
- * Processes multiple memory regions in a single JNI call.
- */
-JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_fullMatchDirectBulk(
-    JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths) {
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_evaluateExpressionBulk(
+    JNIEnv *env, jclass cls, jlong handle, jobjectArray texts) {
 
-    if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
+    TraceScope trace(TRACE_EVALUATE_EXPRESSION_BULK, handle, nullptr, -1);
+
+    if (handle == 0 || texts == nullptr) {
         last_error = "Null pointer";
         return nullptr;
     }
 
     try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-        jsize addressCount = env->GetArrayLength(textAddresses);
-        jsize lengthCount = env->GetArrayLength(textLengths);
-
-        if (addressCount != lengthCount) {
-            last_error = "Address and length arrays must have same size";
-            return nullptr;
-        }
+        ExpressionProgram* expression = reinterpret_cast<ExpressionProgram*>(handle);
+        jsize length = env->GetArrayLength(texts);
+        trace.setLength(length);
 
-        // Allocate result array
-        jbooleanArray results = env->NewBooleanArray(addressCount);
+        jbooleanArray results = env->NewBooleanArray(length);
         if (results == nullptr) {
             last_error = "Failed to allocate result array";
             return nullptr;
         }
 
-        // Get array elements (this does copy the arrays, but not the text data)
-        jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
-        jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
-
-        if (addresses == nullptr || lengths == nullptr) {
-            if (addresses != nullptr) env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
-            if (lengths != nullptr) env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
-            last_error = "Failed to get array elements";
-            return nullptr;
-        }
-
-        // Process all inputs with zero-copy text access
-        std::vector<jboolean> matches(addressCount);
-        for (jsize i = 0; i < addressCount; i++) {
-            if (addresses[i] == 0 || lengths[i] < 0) {
+        std::vector<jboolean>& matches = scratch_booleans(length);
+        jlong matchCount = 0;
+        for (jsize i = 0; i < length; i++) {
+            jstring jstr = (jstring)env->GetObjectArrayElement(texts, i);
+            if (jstr == nullptr) {
                 matches[i] = JNI_FALSE;
                 continue;
             }
 
-            // Zero-copy: wrap each address in StringPiece
-            const char* text = reinterpret_cast<const char*>(addresses[i]);
-            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
-            matches[i] = RE2::FullMatch(input, *re) ? JNI_TRUE : JNI_FALSE;
-        }
+            JStringGuard guard(env, jstr);
+            if (guard.valid()) {
+                matches[i] = expression->evaluate(re2::StringPiece(guard.get())) ? JNI_TRUE
+                                                                                 : JNI_FALSE;
+                matchCount += matches[i];
+            } else {
+                matches[i] = JNI_FALSE;
+            }
 
-        // Release arrays and write results
-        env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
-        env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
-        env->SetBooleanArrayRegion(results, 0, addressCount, matches.data());
+            env->DeleteLocalRef(jstr);
+        }
 
+        env->SetBooleanArrayRegion(results, 0, length, matches.data());
+        trace.setResult(matchCount);
         return results;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Direct bulk full match exception: ") + e.what();
+        set_error("Expression bulk exception: ", e.what());
         return nullptr;
     }
 }
 
-/**
- * Bulk partial match using direct memory addresses (zero-copy bulk).
- * Processes multiple memory regions in a single JNI call.
- */
-JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partialMatchDirectBulk(
+JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_evaluateExpressionDirectBulk(
     JNIEnv *env, jclass cls, jlong handle, jlongArray textAddresses, jintArray textLengths) {
 
+    TraceScope trace(TRACE_EVALUATE_EXPRESSION_DIRECT_BULK, handle, nullptr, -1);
+
     if (handle == 0 || textAddresses == nullptr || textLengths == nullptr) {
         last_error = "Null pointer";
         return nullptr;
     }
 
     try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
+        ExpressionProgram* expression = reinterpret_cast<ExpressionProgram*>(handle);
         jsize addressCount = env->GetArrayLength(textAddresses);
         jsize lengthCount = env->GetArrayLength(textLengths);
+        trace.setLength(addressCount);
 
         if (addressCount != lengthCount) {
             last_error = "Address and length arrays must have same size";
             return nullptr;
         }
 
-        // Allocate result array
         jbooleanArray results = env->NewBooleanArray(addressCount);
         if (results == nullptr) {
             last_error = "Failed to allocate result array";
             return nullptr;
         }
 
-        // Get array elements
         jlong* addresses = env->GetLongArrayElements(textAddresses, nullptr);
         jint* lengths = env->GetIntArrayElements(textLengths, nullptr);
 
@@ -1065,152 +5203,144 @@ JNIEXPORT jbooleanArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_partial
             return nullptr;
         }
 
-        // Process all inputs with zero-copy text access
-        std::vector<jboolean> matches(addressCount);
+        std::vector<jboolean>& matches = scratch_booleans(addressCount);
+        jlong matchCount = 0;
         for (jsize i = 0; i < addressCount; i++) {
             if (addresses[i] == 0 || lengths[i] < 0) {
                 matches[i] = JNI_FALSE;
                 continue;
             }
 
-            // Zero-copy: wrap each address in StringPiece
-            const char* text = reinterpret_cast<const char*>(addresses[i]);
-            re2::StringPiece input(text, static_cast<size_t>(lengths[i]));
-            matches[i] = RE2::PartialMatch(input, *re) ? JNI_TRUE : JNI_FALSE;
+            re2::StringPiece input(reinterpret_cast<const char*>(addresses[i]),
+                                   static_cast<size_t>(lengths[i]));
+            matches[i] = expression->evaluate(input) ? JNI_TRUE : JNI_FALSE;
+            matchCount += matches[i];
         }
 
-        // Release arrays and write results
         env->ReleaseLongArrayElements(textAddresses, addresses, JNI_ABORT);
         env->ReleaseIntArrayElements(textLengths, lengths, JNI_ABORT);
         env->SetBooleanArrayRegion(results, 0, addressCount, matches.data());
 
+        trace.setResult(matchCount);
         return results;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Direct bulk partial match exception: ") + e.what();
+        set_error("Expression direct bulk exception: ", e.what());
         return nullptr;
     }
 }
 
 /**
- * Extract capture groups using direct memory address (zero-copy input).
- * Output strings are necessarily new Java strings.
+ * Sampled statistics of every expression node in preorder:
+ * { samples, trueSamples, costNanos, childOrder } per node, where childOrder
+ * packs the current evaluation order of an AND/OR node's children 4 bits each.
+ *
+ * @return statistics, or null on error
  */
-JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_extractGroupsDirect(
-    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength) {
+JNIEXPORT jlongArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_expressionStats(
+    JNIEnv *env, jclass cls, jlong handle) {
 
-    if (handle == 0 || textAddress == 0) {
+    if (handle == 0) {
+        last_error = "Null pointer";
         return nullptr;
     }
 
     try {
-        RE2* re = reinterpret_cast<RE2*>(handle);
-
-        // Zero-copy: wrap the raw pointer in StringPiece
-        const char* text = reinterpret_cast<const char*>(textAddress);
-        re2::StringPiece input(text, static_cast<size_t>(textLength));
-
-        int numGroups = re->NumberOfCapturingGroups();
-        std::vector<re2::StringPiece> groups(numGroups + 1);  // +1 for full match
-
-        // Match and extract groups
-        if (!re->Match(input, 0, input.size(), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
-            return nullptr;  // No match
+        const ExpressionProgram* expression = reinterpret_cast<const ExpressionProgram*>(handle);
+        std::vector<jlong> stats;
+        stats.reserve(expression->size() * 4);
+        for (size_t i = 0; i < expression->size(); i++) {
+            const ExprNode& node = expression->node(i);
+            stats.push_back(static_cast<jlong>(node.samples.load(std::memory_order_relaxed)));
+            stats.push_back(static_cast<jlong>(node.trueSamples.load(std::memory_order_relaxed)));
+            stats.push_back(static_cast<jlong>(node.costNanos.load(std::memory_order_relaxed)));
+            stats.push_back(static_cast<jlong>(node.order.load(std::memory_order_relaxed)));
         }
 
-        // Create Java string array
-        jclass stringClass = env->FindClass("java/lang/String");
-        jobjectArray result = env->NewObjectArray(numGroups + 1, stringClass, nullptr);
+        jlongArray result = env->NewLongArray(static_cast<jsize>(stats.size()));
         if (result == nullptr) {
+            last_error = "Failed to allocate result array";
             return nullptr;
         }
-
-        // Fill array with groups (output must be Java strings)
-        for (int i = 0; i <= numGroups; i++) {
-            if (groups[i].data() != nullptr) {
-                jstring jstr = env->NewStringUTF(std::string(groups[i].data(), groups[i].size()).c_str());
-                env->SetObjectArrayElement(result, i, jstr);
-                env->DeleteLocalRef(jstr);
-            }
-        }
-
+        env->SetLongArrayRegion(result, 0, static_cast<jsize>(stats.size()), stats.data());
         return result;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Direct extract groups exception: ") + e.what();
+        set_error("Expression stats exception: ", e.what());
         return nullptr;
     }
 }
 
+// ========== Record Mapping ==========
+
 /**
- * Find all matches using direct memory address (zero-copy input).
- * Output strings are necessarily new Java strings.
+ * Match a Java String and extract the groups behind a record's components.
+ *
+ * fieldSpec holds (group index, FieldKind) per component; fields receives
+ * { start, end, status, value } per component: UTF-16 offsets of the group
+ * (-1 when it did not participate), a FieldStatus and, for numeric kinds
+ * parsed natively, the long value or the double's bits.
+ *
+ * @return 1 if matched (fields written), 0 if no match, -1 on error
  */
-JNIEXPORT jobjectArray JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_findAllMatchesDirect(
-    JNIEnv *env, jclass cls, jlong handle, jlong textAddress, jint textLength) {
+JNIEXPORT jint JNICALL Java_com_axonops_libre2_jni_RE2NativeJNI_mapFields(
+    JNIEnv *env, jclass cls, jlong handle, jstring text, jboolean fullMatch,
+    jintArray fieldSpec, jlongArray fields) {
 
-    if (handle == 0 || textAddress == 0) {
-        return nullptr;
+    TraceScope trace(TRACE_MAP_FIELDS, handle, -1);
+
+    if (handle == 0 || text == nullptr || fieldSpec == nullptr || fields == nullptr) {
+        last_error = "Null pointer";
+        return -1;
     }
 
     try {
         RE2* re = reinterpret_cast<RE2*>(handle);
+        jsize specLength = env->GetArrayLength(fieldSpec);
+        size_t count = static_cast<size_t>(specLength) / 2;
+        if (specLength % 2 != 0 || count > kMaxMappedFields ||
+            static_cast<size_t>(env->GetArrayLength(fields)) < count * kFieldSlots) {
+            last_error = "Invalid field spec";
+            return -1;
+        }
 
-        // Zero-copy: wrap the raw pointer in StringPiece
-        const char* text = reinterpret_cast<const char*>(textAddress);
-        re2::StringPiece input(text, static_cast<size_t>(textLength));
-
+        std::vector<jint>& spec = scratch_ints(static_cast<size_t>(specLength));
+        env->GetIntArrayRegion(fieldSpec, 0, specLength, spec.data());
         int numGroups = re->NumberOfCapturingGroups();
-        std::vector<std::vector<std::string>> allMatches;
-
-        // Find all non-overlapping matches
-        std::vector<re2::StringPiece> groups(numGroups + 1);
-
-        while (re->Match(input, 0, input.size(), RE2::UNANCHORED, groups.data(), numGroups + 1)) {
-            std::vector<std::string> matchGroups;
-            for (int i = 0; i <= numGroups; i++) {
-                if (groups[i].data() != nullptr) {
-                    matchGroups.push_back(std::string(groups[i].data(), groups[i].size()));
-                } else {
-                    matchGroups.push_back("");
-                }
+        int maxGroup = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (spec[2 * i] < 0 || spec[2 * i] > numGroups ||
+                spec[2 * i + 1] < kFieldText || spec[2 * i + 1] > kFieldDouble) {
+                last_error = "Invalid field spec";
+                return -1;
             }
-            allMatches.push_back(matchGroups);
-
-            // Advance past this match
-            if (groups[0].size() == 0) {
-                break;  // Avoid infinite loop on zero-length match
-            }
-            input.remove_prefix(groups[0].data() - input.data() + groups[0].size());
+            maxGroup = std::max(maxGroup, static_cast<int>(spec[2 * i]));
         }
 
-        if (allMatches.empty()) {
-            return nullptr;
+        JStringGuard guard(env, text);
+        if (!guard.valid()) {
+            last_error = "Failed to get text string";
+            return -1;
         }
+        re2::StringPiece input(guard.get());
+        trace.setLength(static_cast<jlong>(input.size()));
 
-        // Create Java array of arrays
-        jclass stringArrayClass = env->FindClass("[Ljava/lang/String;");
-        jobjectArray result = env->NewObjectArray(allMatches.size(), stringArrayClass, nullptr);
-
-        for (size_t i = 0; i < allMatches.size(); i++) {
-            jclass stringClass = env->FindClass("java/lang/String");
-            jobjectArray groupArray = env->NewObjectArray(allMatches[i].size(), stringClass, nullptr);
-
-            for (size_t j = 0; j < allMatches[i].size(); j++) {
-                jstring jstr = env->NewStringUTF(allMatches[i][j].c_str());
-                env->SetObjectArrayElement(groupArray, j, jstr);
-                env->DeleteLocalRef(jstr);
-            }
-
-            env->SetObjectArrayElement(result, i, groupArray);
-            env->DeleteLocalRef(groupArray);
+        std::vector<re2::StringPiece>& groups = scratch_groups(maxGroup + 1);
+        RE2::Anchor anchor = fullMatch ? RE2::ANCHOR_BOTH : RE2::UNANCHORED;
+        if (!re->Match(input, 0, input.size(), anchor, groups.data(), maxGroup + 1)) {
+            trace.setResult(0);
+            return 0;
         }
 
-        return result;
+        std::vector<jlong>& out = scratch_longs(count * kFieldSlots);
+        map_fields(input, groups, spec.data(), count, out.data());
+        env->SetLongArrayRegion(fields, 0, static_cast<jsize>(out.size()), out.data());
+        trace.setResult(1);
+        return 1;
 
     } catch (const std::exception& e) {
-        last_error = std::string("Direct find all matches exception: ") + e.what();
-        return nullptr;
+        set_error("Map fields exception: ", e.what());
+        return -1;
     }
 }
 